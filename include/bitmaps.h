@@ -1,7 +1,28 @@
-const uint16_t qrcode_bmp[] PROGMEM = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xffff,0xffff,0xffff,0xffff,0xffff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,};
-const uint16_t main_app_bmp[] PROGMEM = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x39c7,0x738e,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x738e,0x39c7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xbdd7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdd7,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xe71c,0xffff,0xef7d,0x9cf3,0x6b6d,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x6b6d,0x9cf3,0xef7d,0xffff,0xe71c,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xc638,0xffff,0xbdf7,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xc618,0xffff,0xc638,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6b6d,0xffff,0xd6ba,0x841,0x0,0x21,0x21,0x21,0x20,0x20,0x20,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x0,0x20,0x20,0x0,0x841,0xd6ba,0xffff,0x632c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc638,0xffff,0x4a69,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20e3,0x6ac9,0x8bac,0x93ed,0xa40d,0xac0d,0xabec,0x93ab,0x5a68,0x1061,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x528a,0xffff,0xb5b6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xf79e,0xf7be,0x10a2,0x0,0x62,0x1acf,0x1af0,0x1a8e,0x122c,0x988,0xc4,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x840,0x72ea,0xbd10,0xee34,0xfed7,0xfef7,0xfef6,0xeed7,0x8e79,0x8679,0xe6d7,0xfed6,0xe5f4,0x7b4b,0x0,0x0,0x0,0x0,0x0,0x0,0x10a2,0xffdf,0xdedb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x8c4,0x3dff,0x3e3f,0x3e1f,0x3dff,0x3dbf,0x359f,0x353d,0x2c58,0x1b10,0x11c9,0x83,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6aa9,0xe593,0xfed7,0xfeb7,0xfe96,0xf655,0xfe55,0xbe36,0xd99,0x59a,0x59a,0x599,0xae36,0xfe95,0xfef7,0x72e9,0x0,0x0,0x0,0x0,0x0,0x20,0xe73c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdedb,0x20,0x0,0xa4,0x357e,0x35bf,0x359f,0x35bf,0x35bf,0x3dbf,0x3ddf,0x3dff,0x3e1f,0x3ddf,0x355e,0x23d5,0x11ea,0x41,0x0,0x0,0x0,0x10a2,0xbcb0,0xded2,0x5ea7,0x3e64,0x6668,0xde73,0xfe76,0xf675,0x2dd9,0x5ba,0x5ba,0x5ba,0x5ba,0x1db9,0xe655,0xfed6,0xb48f,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xc4,0x359e,0x3dbf,0x35bf,0x35bf,0x35bf,0x35bf,0x35bf,0x35bf,0x359f,0x35bf,0x3ddf,0x3e1f,0x3dff,0x351c,0x2310,0x42,0x2924,0xe5b3,0xe6d3,0x1661,0x660,0x680,0x680,0x3664,0xf674,0xee76,0x5b9,0x5ba,0x5ba,0x5ba,0x5ba,0x5ba,0xce36,0xfed6,0xa44e,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xc4,0x359e,0x3dbf,0x35bf,0x3dbf,0x3dbf,0x3dbf,0x35bf,0x3dbf,0x35bf,0x35bf,0x35bf,0x359f,0x35bf,0x3ddf,0x361f,0x555a,0xe5f3,0xfeb8,0x7e4a,0x680,0xe80,0xe80,0xe80,0x680,0xae6e,0xfe76,0x2dd9,0x5ba,0x5ba,0x5ba,0x5ba,0x15b9,0xee55,0xfed6,0x5a47,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xc4,0x357e,0x3dbf,0x35bf,0x35bf,0x35bf,0x35bf,0x3dbf,0x35bf,0x3dbf,0x35bf,0x35bf,0x35bf,0x3dbf,0x35bf,0x45be,0xde77,0xfe95,0xfe56,0x7e6a,0x680,0xe80,0x680,0xe80,0x680,0x9e6d,0xfe76,0xb636,0x5ba,0x59a,0x59a,0x5ba,0xa616,0xfed6,0xa44e,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xc4,0x35bf,0x3ddf,0x3ddf,0x3dbf,0x35bf,0x359f,0x359f,0x35bf,0x35bf,0x35bf,0x3dbf,0x3dbf,0x3dbf,0x2dbf,0xb639,0xfe74,0xf675,0xfe76,0xc670,0x680,0x680,0x680,0x680,0x1e82,0xe673,0xfe76,0xfe75,0xce56,0x7e17,0x7e17,0xc636,0xfe95,0xf655,0x18c2,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xa3,0x2cda,0x353d,0x355d,0x359f,0x3ddf,0x3e1f,0x3dff,0x3ddf,0x35bf,0x359f,0x35bf,0x3dbf,0x2dbf,0x65dd,0xfe75,0xfe75,0xfe76,0xfe76,0xfe76,0xa66e,0x2e83,0x1681,0x3e85,0xc671,0xfe76,0xf675,0xfe75,0xfe75,0xfe95,0xfe95,0xfe75,0xf675,0xfe75,0x93cc,0x20c2,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x20,0x21,0x41,0x8e5,0x11ca,0x1aaf,0x23f6,0x353d,0x3ddf,0x3e1f,0x3ddf,0x3d9f,0x359f,0xbe38,0xfe96,0xf674,0xf650,0xfe73,0xfe76,0xfe76,0xf675,0xe674,0xfe75,0xfe76,0xfe75,0xfe75,0xfe75,0xf675,0xf675,0xf675,0xf675,0xfe75,0xfe75,0xff17,0xfeb6,0xb4af,0x41a5,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x42,0x11a9,0x2393,0x353d,0x35ff,0x4dff,0xee57,0xfe4f,0xf602,0xf600,0xf601,0xf64c,0xf676,0xfe75,0xfe76,0xfe75,0xf675,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe96,0xac4e,0x730a,0x9bed,0xf634,0x836b,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x62,0xa4d,0x6d39,0xfe94,0xf602,0xf600,0xf600,0xf600,0xf600,0xf651,0xfe76,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xf675,0xfeb6,0x8bac,0x0,0x0,0x0,0x41c5,0xfeb6,0x41c5,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x72ea,0xfed2,0xede0,0xf600,0xf600,0xf601,0xf600,0xf62b,0xfe77,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe95,0xf655,0x2103,0x0,0x20,0x0,0x0,0xcd51,0x836b,0x0,0x840,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x21,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7b2b,0xfef4,0xede0,0xf600,0xf601,0xf600,0xf600,0xf64e,0xfe76,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe55,0xfe75,0xf655,0x20e3,0x0,0x20,0x0,0x0,0xc510,0x62a8,0x0,0x820,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xa3,0x351c,0x351c,0x2c99,0x23d5,0x1af0,0x11a9,0x62,0x0,0x0,0x0,0x20,0x0,0x72e9,0xfef7,0xf62b,0xf600,0xf600,0xf600,0xf628,0xfe96,0xfe96,0xfe96,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfed7,0xfeb6,0xfed7,0xfe96,0xfeb6,0x8b8b,0x0,0x0,0x0,0x41c6,0xe5f4,0x20c2,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xc4,0x35bf,0x3dff,0x3dff,0x3e1f,0x3e1f,0x3ddf,0x355d,0x23d5,0x122b,0x62,0x0,0x0,0x5227,0xfeb6,0xf676,0xf650,0xf62b,0xf64f,0xfe96,0xfe13,0xf5af,0xfe12,0xfe96,0xfe75,0xfe75,0xfe95,0xfe75,0xf46d,0xf308,0xf38a,0xfdd3,0xfe96,0xfe96,0xac6e,0x5a68,0x834b,0xfe95,0x93ed,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xc4,0x357e,0x3dbf,0x359f,0x359f,0x359f,0x35bf,0x3ddf,0x3e1f,0x3e1f,0x351c,0x1a8e,0x0,0x1040,0xee14,0xfe95,0xfe76,0xfe77,0xfe97,0xf54d,0xf3a0,0xf3a0,0xf3a0,0xf52b,0xfe96,0xfe75,0xfeb6,0xf38a,0xf080,0xf0c0,0xf080,0xf1c3,0xfe13,0xfe96,0xfed6,0xfeb6,0xff37,0xd572,0x820,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xc4,0x359e,0x3dbf,0x35bf,0x3dbf,0x35bf,0x35bf,0x35bf,0x359f,0x359f,0x3ddf,0x3e1f,0x34fb,0x9ca,0xa40d,0xfed6,0xf655,0xfe95,0xf612,0xf3a0,0xf380,0xf3a0,0xf3a0,0xf380,0xf5d0,0xfeb6,0xfe14,0xf141,0xf100,0xf120,0xf120,0xf0c0,0xf4ae,0xfed6,0xf634,0xfe96,0xee14,0x2923,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xc4,0x359e,0x3dbf,0x35bf,0x3dbf,0x35bf,0x35bf,0x35bf,0x35bf,0x35bf,0x35bf,0x359f,0x3dff,0x35df,0x4cb8,0xee14,0xfe75,0xf696,0xf58f,0xf380,0xf3a0,0xf3a0,0xf3a0,0xf380,0xf56d,0xfeb7,0xfe13,0xf141,0xf100,0xf120,0xf120,0xf0c0,0xf48e,0xf6b6,0xfeb6,0xee34,0x41a5,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xc4,0x357e,0x35bf,0x359f,0x359f,0x35bf,0x35bf,0x3dbf,0x35bf,0x35bf,0x3dbf,0x3dbf,0x35bf,0x3dbf,0x2ddf,0x7ddb,0xfe75,0xfe96,0xf612,0xf3a0,0xf380,0xf3a0,0xf3a0,0xf380,0xf5d0,0xfe96,0xfeb6,0xf36a,0xf080,0xf0c0,0xf080,0xf1a3,0xf5f3,0xfef7,0xd592,0x3144,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xc4,0x35bf,0x3e1f,0x3e1f,0x3e1f,0x3ddf,0x35bf,0x359f,0x35bf,0x3dbf,0x35bf,0x35bf,0x3dbf,0x35bf,0x3dbf,0x2dbf,0x85fb,0xf675,0xfeb6,0xf56d,0xeba0,0xf380,0xf3a0,0xf50b,0xfe96,0xfe75,0xfe75,0xf655,0xf42d,0xf2c7,0xf369,0xfdd2,0xfeb6,0x9c0d,0x1061,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x21,0x11ca,0x124c,0x1af0,0x23d5,0x351c,0x3ddf,0x3e1f,0x35bf,0x359f,0x35bf,0x3dbf,0x3dbf,0x35bf,0x3dbf,0x3dbf,0x2dbf,0x5ddd,0xc5d5,0xfe75,0xfe94,0xfdd0,0xfe12,0xfe96,0xfe95,0xfe75,0xfe75,0xfe75,0xfed6,0xfeb5,0xf6d7,0xbe58,0x663f,0x126d,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x988,0x23d5,0x3dbf,0x3e1f,0x35bf,0x35bf,0x3dbf,0x3dbf,0x35bf,0x3dbf,0x3dbf,0x35bf,0x357e,0x4aec,0x93ac,0xe5f4,0xee55,0xf654,0xf655,0xf675,0xf696,0xee76,0xce37,0x8dfb,0x5ddd,0x359f,0x35df,0x351c,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x926,0x23f5,0x3ddf,0x3ddf,0x359f,0x3dbf,0x35bf,0x35bf,0x35bf,0x3dbf,0x3dff,0x24db,0x21,0x820,0x18a2,0x20e3,0x20e3,0x2104,0x44fa,0x4dff,0x35bf,0x2dbf,0x35bf,0x3dbf,0x3d9f,0x3e1f,0x1a6d,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11a9,0x353d,0x3dff,0x359f,0x3dbf,0x35bf,0x3dbf,0x3dbf,0x359f,0x3e1f,0x2c16,0x0,0x0,0x0,0x0,0x0,0x9eb,0x35ff,0x35bf,0x3dbf,0x3dbf,0x3dbf,0x35bf,0x3dff,0x2cba,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa3,0x2cda,0x3dff,0x359f,0x3dbf,0x35bf,0x35bf,0x3dbf,0x359f,0x3e1f,0x124c,0x0,0x20,0x0,0x0,0x0,0x2cb9,0x3dff,0x35bf,0x35bf,0x3dbf,0x35bf,0x35bf,0x3ddf,0x967,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x62,0x2cda,0x3dff,0x359f,0x3dbf,0x35bf,0x3dbf,0x35bf,0x3ddf,0x353d,0x62,0x0,0x0,0x0,0x0,0x122c,0x3dff,0x35bf,0x35bf,0x35bf,0x35bf,0x359f,0x3e1f,0x2352,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc4,0x355d,0x3ddf,0x35bf,0x3dbf,0x35bf,0x3dbf,0x359f,0x3e1f,0x1af0,0x0,0x0,0x0,0x0,0x41,0x351c,0x3ddf,0x35bf,0x3dbf,0x35bf,0x35bf,0x3ddf,0x351c,0x41,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x20,0x988,0x1a8e,0x122c,0x906,0x0,0x0,0x0,0x0,0x0,0x0,0x11ea,0x3dff,0x35bf,0x35bf,0x35bf,0x35bf,0x35bf,0x3ddf,0x355d,0x82,0x0,0x0,0x0,0x0,0x1b31,0x3e1f,0x359f,0x35bf,0x35bf,0x35bf,0x3dbf,0x3dbf,0x947,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x926,0x2cba,0x3ddf,0x3e1f,0x3dff,0x35bf,0x2373,0x21,0x0,0x0,0x0,0x0,0x0,0x23b4,0x3e1f,0x359f,0x3dbf,0x35bf,0x35bf,0x359f,0x3e1f,0x1a6d,0x0,0x0,0x0,0x0,0x926,0x3dbf,0x3dbf,0x35bf,0x35bf,0x35bf,0x359f,0x3e1f,0x1aae,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x8e5,0x359e,0x3dff,0x35bf,0x359f,0x359f,0x35bf,0x3e3f,0x23f6,0x0,0x0,0x0,0x0,0x0,0xa3,0x357e,0x3ddf,0x35bf,0x3dbf,0x3dbf,0x35bf,0x3dff,0x2c78,0x0,0x0,0x0,0x0,0x20,0x34fb,0x3ddf,0x35bf,0x35bf,0x3dbf,0x359f,0x3e1f,0x23f6,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x2416,0x3e1f,0x359f,0x35bf,0x35bf,0x35bf,0x35bf,0x359f,0x3e1f,0x120b,0x0,0x0,0x0,0x0,0x0,0x1b31,0x3e1f,0x359f,0x35bf,0x35bf,0x35bf,0x3dbf,0x359f,0x8e5,0x0,0x0,0x0,0x0,0x2394,0x3e1f,0x359f,0x3dbf,0x35bf,0x35bf,0x3ddf,0x351c,0x21,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x42,0x355d,0x3ddf,0x35bf,0x35bf,0x35bf,0x35bf,0x3dbf,0x359f,0x3e1f,0x2393,0x0,0x0,0x0,0x0,0x0,0x905,0x35bf,0x3dbf,0x35bf,0x35bf,0x35bf,0x359f,0x3dff,0x124c,0x0,0x0,0x0,0x0,0x126d,0x3e1f,0x359f,0x35bf,0x3dbf,0x35bf,0x3dbf,0x359e,0xa3,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0xa4,0x357e,0x3dbf,0x35bf,0x35bf,0x3dbf,0x3dbf,0x35bf,0x35bf,0x3ddf,0x2c99,0x0,0x0,0x0,0x0,0x0,0x0,0x2c79,0x3dff,0x35bf,0x3dbf,0x3dbf,0x359f,0x3e1f,0x2393,0x0,0x0,0x0,0x0,0x988,0x3dbf,0x35bf,0x35bf,0x3dbf,0x35bf,0x35bf,0x3dbf,0x988,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x83,0x357e,0x3dbf,0x35bf,0x35bf,0x3dbf,0x35bf,0x35bf,0x359f,0x3dff,0x2c16,0x0,0x0,0x0,0x0,0x0,0x0,0x1b11,0x3e1f,0x359f,0x35bf,0x35bf,0x35bf,0x3dff,0x2c78,0x0,0x0,0x0,0x0,0xa3,0x359e,0x3dbf,0x35bf,0x3dbf,0x35bf,0x359f,0x3dff,0x124c,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdedb,0x20,0x0,0x0,0x2cba,0x3dff,0x359f,0x35bf,0x35bf,0x35bf,0x35bf,0x359f,0x3e1f,0x1aaf,0x0,0x0,0x0,0x0,0x0,0x0,0x11eb,0x3dff,0x35bf,0x35bf,0x35bf,0x35bf,0x3ddf,0x353d,0x21,0x0,0x0,0x0,0x21,0x351c,0x3ddf,0x35bf,0x35bf,0x35bf,0x359f,0x3e1f,0x1acf,0x0,0x20,0x0,0x20,0xdefb,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xe73c,0x841,0x0,0x0,0x988,0x3dff,0x3ddf,0x35bf,0x35bf,0x35bf,0x359f,0x3e1f,0x2cda,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x926,0x359f,0x3dbf,0x35bf,0x35bf,0x35bf,0x3dbf,0x359e,0xa3,0x0,0x0,0x0,0x0,0x2c99,0x3ddf,0x359f,0x35bf,0x35bf,0x359f,0x3e3f,0x1af0,0x0,0x20,0x0,0x20,0xef5d,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xf79e,0xffff,0x18e3,0x0,0x0,0x0,0x1aaf,0x35bf,0x3ddf,0x3ddf,0x3ddf,0x3ddf,0x351c,0x906,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x82,0x359f,0x3dff,0x3ddf,0x3ddf,0x3ddf,0x3ddf,0x3dbf,0x926,0x0,0x0,0x0,0x0,0x2c58,0x3e1f,0x3ddf,0x3ddf,0x3ddf,0x3dbf,0x3e5f,0x1b10,0x0,0x20,0x0,0x2104,0xffff,0xd6ba,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xbdd7,0xffff,0x5aeb,0x0,0x20,0x0,0x0,0x8c4,0x11c9,0x11a9,0x11c9,0x989,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x988,0x11c9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x62,0x0,0x0,0x0,0x0,0x926,0x11ca,0x11a9,0x11a9,0x11a9,0x11a9,0x11ca,0x8e5,0x0,0x20,0x0,0x630c,0xffff,0xb596,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x528a,0xffff,0xef5d,0x2945,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2945,0xef5d,0xffff,0x5aeb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb5b6,0xffff,0xef5d,0x5acb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5acb,0xef5d,0xffff,0xb596,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1082,0xc638,0xffff,0xffff,0xdefb,0xad55,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0xad75,0xdefb,0xffff,0xffff,0xc618,0x861,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7bef,0xe73c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe73c,0x7bef,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x841,0x3186,0x4228,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4228,0x3186,0x841,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10a2,0x841,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10a2,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3186,0xad75,0xce59,0x9cd3,0x18c3,0x0,0xe71c,0x5acb,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18e3,0xef5d,0x31a6,0x0,0x0,0x0,0x841,0x8430,0xc638,0xb5b6,0x4a49,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2945,0x18e3,0x0,0x0,0x0,0x2965,0xffff,0xb5b6,0x6b4d,0xdefb,0xbdd7,0x0,0xef7d,0x630c,0x0,0x0,0x10a2,0x2104,0x0,0x0,0x20,0x1082,0x0,0x0,0x1082,0x20,0x0,0x20,0x18e3,0x2104,0xf7be,0x39c7,0x0,0x0,0x0,0xbdf7,0xef7d,0x738e,0xa514,0xffdf,0x2945,0x0,0x18c3,0x2945,0x0,0x0,0x20,0x861,0x0,0x2124,0x0,0x0,0x10a2,0x0,0x0,0x0,0x10a2,0x0,0x0,0x2124,0x18e3,0x0,0x0,0xa514,0xd6ba,0xe73c,0x630c,0x0,0x0,0x9cd3,0xdefb,0x0,0x0,0x1082,0x2945,0x0,0xef5d,0x630c,0x0,0x7bef,0xf79e,0xf79e,0xbdd7,0x0,0x39e7,0xef7d,0x861,0x1082,0xef7d,0x31a6,0x1082,0xdedb,0xf79e,0xc638,0xf7be,0x31a6,0x0,0x0,0x39c7,0xffff,0x31a6,0x0,0x0,0x31a6,0x0,0x8410,0xe73c,0xdefb,0xbdd7,0x0,0x4a49,0xe73c,0xb596,0xffdf,0xc618,0x20,0xd69a,0x8410,0x0,0x52aa,0xe71c,0x2124,0xbdf7,0xdedb,0xe73c,0x6b4d,0x861,0xffff,0x73ae,0x2965,0x10a2,0x0,0x0,0xbdf7,0xad55,0x0,0x841,0x0,0x0,0x20,0xef7d,0x52aa,0x18c3,0xffff,0x52aa,0x1082,0xffdf,0x738e,0x3186,0xffff,0x1082,0x10a2,0xffff,0x2965,0x8430,0xf79e,0x861,0x6b6d,0xffff,0x3186,0x0,0x0,0x5aeb,0xffdf,0x861,0x0,0x20,0x0,0x0,0x4a69,0x31a6,0x630c,0xffff,0x18e3,0x4228,0xffff,0x4a49,0x2965,0xffff,0x2945,0x7bcf,0xe71c,0x0,0xb596,0xad75,0x0,0x630c,0x18e3,0xbdf7,0xce59,0x0,0x5aeb,0xdedb,0xdefb,0x52aa,0x0,0x0,0xb596,0xc618,0x0,0x0,0x20,0x2124,0x20,0xef7d,0x4a49,0x4208,0xffdf,0x0,0x0,0xb596,0xa514,0x31a6,0xf7be,0x20,0x861,0xf7be,0x3186,0xad55,0xad55,0x0,0x10a2,0xf7be,0x31a6,0x0,0x0,0x4a69,0xffff,0x18c3,0x0,0x0,0x2124,0x20,0x5aeb,0xbdd7,0xa514,0xf79e,0x2104,0x4228,0xf7be,0x0,0x841,0xf7be,0x39e7,0x18c3,0xf7be,0x4228,0xe73c,0x4a49,0x0,0x9cd3,0xad55,0xc638,0xc618,0x1082,0x5aeb,0x861,0xad75,0xe71c,0x0,0x0,0x52aa,0xffff,0x5aeb,0x861,0x9cd3,0xdedb,0x20,0xf79e,0x6b4d,0x18c3,0xffff,0x5aeb,0x10a2,0xffdf,0x738e,0x2945,0xffff,0x2965,0x5acb,0xffff,0x2945,0x8430,0xf79e,0x1082,0x738e,0xffff,0x31a6,0x0,0x0,0x841,0xef7d,0xad75,0x10a2,0x4a69,0xf7be,0x4a69,0xffdf,0x6b6d,0x3186,0xffff,0x2965,0x4a49,0xffdf,0x841,0x1082,0xffdf,0x4a49,0x0,0xbdd7,0xf7be,0xd69a,0x0,0x630c,0xffff,0x841,0x9cf3,0xdedb,0x73ae,0xbdd7,0xe73c,0xe71c,0x632c,0x0,0x0,0x0,0x7bef,0xf79e,0xef7d,0xe73c,0x4a49,0x0,0xa514,0xf79e,0x861,0x738e,0xf79e,0xf79e,0xb5b6,0x841,0x20,0xc618,0xf7be,0xad75,0xe73c,0x31a6,0x1082,0xd6ba,0xf79e,0xb5b6,0xe73c,0x31a6,0x0,0x20,0x0,0x39c7,0xdedb,0xef7d,0xf7be,0x8c71,0x0,0x9cf3,0xef5d,0xa514,0xd69a,0xa534,0x4228,0xe73c,0x20,0x861,0xef5d,0x4228,0x0,0x5acb,0xffff,0x7bef,0x0,0x2945,0xdedb,0xd69a,0x9cf3,0xef5d,0x20,0x0,0x2104,0x10a2,0x0,0x0,0x0,0x0,0x0,0x861,0x2104,0x0,0x0,0x0,0x0,0x18e3,0x20,0x0,0x1082,0x18e3,0x0,0x0,0x0,0x0,0x18e3,0x0,0x841,0x20,0x0,0x20,0x18e3,0x0,0x841,0x0,0x0,0x0,0x0,0x0,0x0,0x18e3,0x1082,0x0,0x0,0x0,0x2104,0x20,0x0,0x1082,0x0,0x861,0x0,0x0,0x861,0x0,0x0,0x0,0x841,0x0,0x0,0x0,0x861,0x2104,0x0,0x861,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2945,0x2945,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18e3,0xf7be,0xf7be,0x18e3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x73ae,0xe71c,0xef5d,0x738e,0x0,0x861,0x7bcf,0x52aa,0xa514,0x7bcf,0x0,0x841,0x7bcf,0x52aa,0xa514,0x7bcf,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd69a,0x6b6d,0x7bcf,0xd69a,0x0,0x10a2,0xffff,0xd6ba,0x8c71,0xffff,0x7bef,0x20,0xffff,0xd6ba,0x8c71,0xffff,0x8410,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2124,0xffff,0x5acb,0x632c,0xffff,0x2104,0x841,0xffdf,0x528a,0x0,0x94b2,0xd69a,0x841,0xf7be,0x528a,0x0,0x94b2,0xd6ba,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x738e,0xffff,0xe71c,0xe71c,0xffff,0x6b4d,0x0,0xffff,0x52aa,0x0,0x9cd3,0xd69a,0x841,0xffdf,0x52aa,0x0,0x94b2,0xd6ba,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xef5d,0x9cd3,0x0,0x0,0xa534,0xe73c,0x1082,0xffdf,0xd6ba,0x94b2,0xffff,0x73ae,0x0,0xffff,0xd6ba,0x94b2,0xffff,0x7bcf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0x8410,0x2124,0x0,0x0,0x2945,0x7bef,0x2104,0xe73c,0x7bef,0x9cf3,0x738e,0x0,0x1082,0xef5d,0x7bef,0x9cf3,0x738e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1082,0xffff,0x4208,0x0,0x0,0x0,0x10a2,0xffff,0x4208,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x841,0x8410,0x2124,0x0,0x20,0x0,0x841,0x8410,0x2124,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xf800,0x0,0x7e0,0x0,0x1f,0x0,};
-const uint16_t settings_app_bmp[] PROGMEM = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x39c7,0x738e,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x738e,0x39c7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xbdd7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdd7,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xe71c,0xffff,0xef7d,0x9cf3,0x6b6d,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x6b6d,0x9cf3,0xef7d,0xffff,0xe71c,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xc638,0xffff,0xbdf7,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xc618,0xffff,0xc638,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6b6d,0xffff,0xd6ba,0x841,0x0,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x0,0x841,0xd6ba,0xffff,0x632c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc638,0xffff,0x4a69,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x528a,0xffff,0xb5b6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xf79e,0xf7be,0x10a2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x840,0x32ea,0x26c,0x26b,0x26b,0x26b,0x26b,0x26b,0x26b,0x28b,0x20c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10a2,0xffdf,0xdedb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3162,0x5d51,0x415,0x454,0x434,0x434,0x434,0x434,0x434,0x454,0xbb5,0x64,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe73c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdedb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4a64,0x6530,0x3b3,0x3f2,0x3f3,0x413,0x413,0x3f3,0x3f2,0x412,0xb95,0x8c8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6b05,0x6d91,0x3b3,0x413,0x3d2,0x3d2,0x3d2,0x3d2,0x3f3,0x412,0xb96,0x10eb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x8385,0x75b1,0x3b3,0x412,0xe4,0x0,0x0,0xe4,0x3f3,0x412,0x1396,0x18cc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5ae5,0xa4c8,0x3183,0x0,0x0,0x0,0x0,0x0,0xa487,0x7590,0x3d3,0x3d2,0x41,0x0,0x0,0x21,0x3d2,0x432,0x1376,0x1930,0x0,0x0,0x0,0x0,0x0,0x886,0x2172,0x10ea,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x8a1,0xe66b,0xff8b,0xff0b,0xbd69,0x5aa5,0x41,0x41,0x7ba7,0xfeca,0x6510,0x3f4,0x370,0x0,0x0,0x0,0x0,0x370,0x433,0xb74,0x31b8,0x192e,0x21,0x21,0x10ca,0x2174,0x31ba,0x39bb,0x29b7,0x42,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x8c27,0xff6b,0xf6aa,0xfeca,0xff2b,0xff6b,0xd60a,0xcdea,0xff6b,0xff0a,0x5cef,0x414,0x30e,0x0,0x0,0x0,0x0,0x30e,0x453,0xb54,0x3199,0x39bb,0x2996,0x2996,0x39bb,0x31ba,0x3199,0x3198,0x39bb,0x192f,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x2983,0xff0b,0xfeeb,0xfeeb,0xff0b,0xfeeb,0xfeaa,0xff0b,0xff2b,0xf6aa,0xff0a,0x6571,0x3f4,0x229,0x0,0x0,0x0,0x0,0x20a,0x453,0xb95,0x3199,0x3198,0x319a,0x319a,0x3198,0x3199,0x319a,0x3199,0x3199,0x31b9,0x885,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0xb529,0xff4b,0xfeca,0xff0b,0xcdea,0xf6ab,0xff6b,0xff0b,0xfeca,0xff2b,0xf6cb,0x3b09,0x83,0x0,0x0,0x0,0x0,0x0,0x0,0xc3,0x1ec,0x31b9,0x319a,0x3198,0x3199,0x39bb,0x31b9,0x29b6,0x3199,0x3199,0x39ba,0x2173,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x4a64,0xff4c,0xfeca,0xff2b,0xd60a,0x41,0x2122,0x83e7,0xe64a,0xff6c,0xcdca,0x2122,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x85,0x2996,0x39bb,0x2997,0x192f,0x64,0x41,0x2996,0x319a,0x3199,0x31bb,0x8c9,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x41,0xd60a,0xff2b,0xfeca,0xff2b,0x5285,0x0,0x0,0x0,0x881,0x5ac5,0x10a1,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x43,0x10ea,0x42,0x0,0x0,0x0,0x10ca,0x31ba,0x3199,0x319a,0x2996,0x21,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x7ba7,0xff4b,0xfeca,0xff2b,0xcdea,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x146,0x28c,0x32f,0x32f,0x2ac,0x167,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x29b6,0x319a,0x3199,0x31bb,0x190d,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x40,0xde4b,0xff4b,0xfeca,0xfeeb,0xfeeb,0x9468,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x62,0x30e,0x434,0x434,0x433,0x433,0x434,0x434,0x350,0xc3,0x0,0x0,0x0,0x0,0x0,0x0,0x21,0x1950,0x31b9,0x3199,0x3199,0x39bb,0x29b7,0x21,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x2963,0xcdca,0xff6b,0xfeca,0xfeeb,0xff6b,0xcdca,0x2142,0x0,0x0,0x0,0x0,0x18a0,0x3c2f,0x434,0x3f2,0x3f2,0x3f3,0x3f3,0x3f2,0x3f2,0x453,0xb73,0x64,0x0,0x0,0x0,0x0,0x885,0x2996,0x39bb,0x3199,0x3199,0x39bb,0x2995,0x885,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x40,0x9468,0xff4c,0xff0b,0xfeca,0xff2b,0xfeeb,0x39e3,0x0,0x20,0x0,0x9427,0x75b1,0x3b3,0x413,0x413,0x3f3,0x3f3,0x3f3,0x3f3,0x412,0x1396,0x2173,0x0,0x0,0x0,0x8a7,0x31da,0x319a,0x3199,0x3199,0x31bb,0x1950,0x20,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x5ae5,0xf6ab,0xfeeb,0xfeca,0xff4b,0x5285,0x0,0x0,0x861,0xf68a,0x6530,0x3d3,0x413,0x3f3,0x413,0x413,0x3f3,0x3f3,0x412,0xb74,0x31b9,0x885,0x0,0x0,0x10ea,0x31db,0x3199,0x3199,0x31b8,0x10eb,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x83c6,0xff6b,0xfeca,0xfecb,0x2163,0x0,0x0,0x2983,0xff0a,0x6510,0x3d3,0x413,0x413,0x413,0x413,0x413,0x3f3,0x412,0xb74,0x31da,0x10ea,0x0,0x0,0x885,0x31b9,0x3199,0x39bb,0x18ed,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7b85,0xff6b,0xfeca,0xf6cb,0x1902,0x0,0x0,0x3a04,0xff2b,0x6510,0x3d3,0x413,0x413,0x413,0x413,0x413,0x3f3,0x412,0xb74,0x31db,0x10eb,0x0,0x0,0x64,0x31b9,0x3199,0x39bb,0x18cc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9c47,0xff4b,0xfeca,0xfecb,0x2983,0x0,0x0,0x2142,0xff0a,0x6530,0x3d3,0x413,0x413,0x413,0x413,0x413,0x3f3,0x412,0xb74,0x31ba,0x8e9,0x0,0x0,0x8a6,0x31b9,0x3199,0x39bb,0x190f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x20,0x9c68,0xff0b,0xfeeb,0xfeca,0xff8c,0x5ae6,0x0,0x0,0x0,0xde0a,0x6d50,0x3d3,0x413,0x3f3,0x413,0x413,0x3f3,0x3f3,0x412,0xb74,0x31b8,0x42,0x0,0x0,0x110b,0x39db,0x3198,0x3199,0x31ba,0x1950,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x2143,0xcdea,0xff6b,0xfeca,0xfeca,0xff6b,0xcdea,0x2142,0x0,0x20,0x0,0x6b25,0x6db1,0x3b3,0x413,0x413,0x3f3,0x3f3,0x413,0x3f3,0x412,0x1396,0x1950,0x0,0x0,0x0,0x865,0x2996,0x39bb,0x3199,0x3199,0x39bb,0x2995,0x64,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x5ae5,0xf6cb,0xff2b,0xfeca,0xff0b,0xff4c,0x9468,0x20,0x0,0x0,0x0,0x0,0x820,0x234c,0x434,0x413,0x3f2,0x3f3,0x3f3,0x3f2,0x3f3,0x454,0x2f0,0x1,0x0,0x0,0x0,0x0,0x21,0x1950,0x31db,0x3199,0x3199,0x31ba,0x31b9,0x10c9,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x40,0xe64b,0xff2b,0xfeca,0xfeeb,0xeeab,0x5ac5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x22a,0x413,0x454,0x434,0x434,0x454,0x413,0x28c,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10ea,0x31b8,0x3199,0x3199,0x399a,0x29b6,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x5285,0xff4b,0xfeca,0xff0b,0xd60a,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0xc3,0x22a,0x2ad,0x2cd,0x22a,0xe4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x29b6,0x319a,0x3199,0x31ba,0x8a8,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0xbd49,0xff4b,0xfeca,0xff6b,0x7386,0x0,0x0,0x0,0x31c3,0x9c88,0x31a3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x8a7,0x1951,0x886,0x0,0x0,0x0,0x190d,0x39bb,0x3198,0x39ba,0x2172,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x31a3,0xff0b,0xfeea,0xff0b,0xee8b,0x2163,0x5285,0xc589,0xff0b,0xff6b,0xeeab,0x52a5,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x110c,0x31ba,0x39bb,0x31ba,0x2194,0x10c9,0x885,0x31b8,0x3199,0x3199,0x31b9,0x64,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x9447,0xff6b,0xfeca,0xfeeb,0xf6cb,0xff4b,0xff2b,0xfeca,0xf6aa,0xff0b,0xff4b,0x53ec,0x126,0x41,0x0,0x0,0x0,0x0,0x41,0x166,0xa8f,0x31da,0x3199,0x3198,0x3199,0x31ba,0x31ba,0x31b9,0x3199,0x3199,0x39bb,0x192e,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x10c1,0xee8b,0xff0b,0xfeeb,0xfeeb,0xfeca,0xfeea,0xff4b,0xff4b,0xfeca,0xfeea,0x6550,0x435,0x28b,0x0,0x0,0x0,0x0,0x28c,0x474,0xb95,0x3199,0x3199,0x31bb,0x39ba,0x3199,0x3198,0x3199,0x3199,0x319a,0x29b7,0x42,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x6b26,0xff4b,0xfeca,0xff0b,0xff6b,0xfeeb,0x9c88,0x9c68,0xff4c,0xff2a,0x5cef,0x3f4,0x30e,0x0,0x0,0x0,0x0,0x32f,0x433,0xb54,0x319a,0x31da,0x1930,0x2151,0x31b9,0x39bb,0x3199,0x3198,0x31bb,0x10ea,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xcdea,0xff8c,0xde2a,0x83c7,0x2122,0x0,0x0,0x4224,0xe64a,0x6530,0x3f4,0x390,0x20,0x0,0x0,0x20,0x391,0x433,0xb75,0x2996,0x8c8,0x0,0x0,0x64,0x192f,0x2997,0x39dc,0x2194,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x39c3,0x6305,0x61,0x0,0x0,0x0,0x20,0x0,0x9426,0x7590,0x3d3,0x3d2,0x20,0x0,0x0,0x41,0x3d2,0x412,0x1396,0x190e,0x0,0x0,0x0,0x0,0x0,0x21,0x10eb,0x886,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x8365,0x7591,0x3b3,0x412,0x1a7,0x104,0x104,0x1c8,0x3f3,0x412,0x1396,0x10ec,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x62e5,0x6d71,0x3b3,0x413,0x413,0x413,0x413,0x413,0x3f3,0x412,0xb96,0x10ea,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdedb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4224,0x5d30,0x3d3,0x3f2,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,0x412,0xb95,0x8c7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xdefb,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xe73c,0x841,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2921,0x5d31,0x414,0x434,0x434,0x434,0x434,0x434,0x434,0x454,0xb94,0x43,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xef5d,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xf79e,0xffff,0x18e3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x820,0x19e6,0x187,0x187,0x187,0x187,0x187,0x187,0x187,0x187,0x147,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xffff,0xd6ba,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xbdd7,0xffff,0x5aeb,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x630c,0xffff,0xb596,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x528a,0xffff,0xef5d,0x2945,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2945,0xef5d,0xffff,0x5aeb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb5b6,0xffff,0xef5d,0x5acb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5acb,0xef5d,0xffff,0xb596,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1082,0xc638,0xffff,0xffff,0xdefb,0xad55,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0xad75,0xdefb,0xffff,0xffff,0xc618,0x861,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7bef,0xe73c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe73c,0x7bef,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x841,0x3186,0x4228,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4228,0x3186,0x841,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1082,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x73ae,0xb596,0xb5b6,0xa514,0x39e7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xef5d,0x6b4d,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd69a,0xdefb,0x738e,0xb5b6,0xffff,0x52aa,0x0,0x0,0x861,0x2965,0x20,0x0,0x10a2,0x0,0x0,0x0,0x1082,0x20,0x5aeb,0x2945,0x0,0x0,0x2104,0x18c3,0x0,0x0,0x0,0x18c3,0x2945,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xce79,0x8c71,0x0,0x0,0xad55,0xdefb,0x0,0x4a49,0xdefb,0xd6ba,0xce79,0x18e3,0xce59,0x8410,0x0,0x528a,0xe71c,0x10a2,0xce59,0x5aeb,0x0,0xad75,0xf79e,0xf7be,0x8c71,0x0,0x7bef,0xdefb,0xdedb,0xad75,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xce79,0x9cd3,0x0,0x0,0x6b4d,0xf7be,0x841,0xe73c,0xa514,0x10a2,0xf79e,0x8430,0x738e,0xe71c,0x0,0xb596,0xad75,0x0,0xf79e,0x5acb,0x52aa,0xffff,0x2104,0x39e7,0x5aeb,0x2124,0xffff,0x630c,0x31a6,0xffff,0x528a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xce79,0x9492,0x0,0x0,0x8430,0xe73c,0x10a2,0xf7be,0xbdf7,0xa514,0xb5b6,0x5aeb,0x18c3,0xf7be,0x4228,0xe73c,0x4a49,0x0,0xef5d,0x4a69,0x8430,0xce79,0x0,0x0,0x0,0x528a,0xffff,0xa534,0xa534,0xad75,0x39e7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xce79,0xad75,0x10a2,0x52aa,0xffff,0x8c71,0x0,0xef5d,0x9cd3,0x0,0x738e,0x31a6,0x0,0xbdd7,0xf7be,0xd69a,0x20,0x0,0xef7d,0x52aa,0x528a,0xffff,0x2124,0x4a49,0x94b2,0x2945,0xffff,0x5acb,0x10a2,0x7bcf,0x1082,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb596,0xffdf,0xe73c,0xef5d,0x9492,0x841,0x0,0x4a49,0xe73c,0xef5d,0xdefb,0x31a6,0x0,0x52aa,0xffff,0x7bef,0x0,0x20,0xdedb,0x630c,0x0,0xa534,0xf79e,0xf79e,0x8410,0x0,0x7bcf,0xef7d,0xef7d,0xbdf7,0x861,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x841,0x861,0x861,0x20,0x0,0x0,0x0,0x0,0x20,0x2104,0x0,0x0,0x0,0x0,0x841,0x0,0x0,0x0,0x861,0x20,0x0,0x0,0x18c3,0x1082,0x0,0x0,0x0,0x1082,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x39e7,0x4a49,0x1082,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x1082,0x9492,0x2945,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x841,0xbdf7,0xef7d,0xe73c,0xef7d,0x2124,0x0,0x0,0x0,0x0,0x0,0x0,0x528a,0x6b6d,0x0,0x0,0x6b4d,0x5acb,0x0,0x18c3,0xc618,0x39e7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x841,0x2124,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4a49,0xffff,0x2104,0x0,0x4208,0x1082,0x0,0x39e7,0xa534,0x9cf3,0x18c3,0x2945,0xef7d,0xf79e,0x8430,0x5aeb,0xffdf,0xe71c,0x8410,0x1082,0x7bcf,0x18c3,0x2124,0x73ae,0x5acb,0xad55,0x52aa,0x0,0x0,0x6b6d,0x9cd3,0xbdd7,0x7bef,0x0,0x6b6d,0xad75,0x7bef,0x841,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18e3,0xef7d,0xd69a,0x8410,0x2945,0x0,0x31a6,0xf79e,0x73ae,0xad55,0xce79,0x2965,0xd6ba,0xe71c,0x7bcf,0x52aa,0xe73c,0xd69a,0x73ae,0x18e3,0xffff,0x39e7,0x4228,0xffff,0xa534,0xad55,0xffff,0x1082,0x5aeb,0xf79e,0x5aeb,0xef7d,0x39e7,0x52aa,0xffdf,0x6b6d,0x9cd3,0x18c3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18e3,0x9cd3,0xdefb,0xffff,0x31a6,0x7bcf,0xffff,0x738e,0x9cd3,0xffff,0x0,0x9492,0xb5b6,0x0,0x0,0xbdd7,0x9492,0x0,0x10a2,0xf7be,0x31a6,0x4208,0xffff,0x20,0x0,0xffdf,0x31a6,0x630c,0xdedb,0x2124,0xef7d,0x632c,0x39c7,0xf79e,0x9cf3,0x4228,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18c3,0x39e7,0x0,0x0,0xe73c,0x8c71,0x738e,0xf7be,0x4a69,0x4a69,0x5acb,0x0,0xa534,0xb5b6,0x0,0x0,0xc638,0x94b2,0x0,0x10a2,0xf7be,0x31a6,0x4208,0xf79e,0x20,0x1082,0xf79e,0x39e7,0x18c3,0xd6ba,0xb596,0x73ae,0x0,0x0,0x31a6,0x8410,0xffff,0x5aeb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4228,0xffff,0xbdf7,0xad55,0xffff,0x52aa,0x2124,0xffdf,0x9cd3,0xa514,0xb596,0x0,0x7bcf,0xffff,0xa514,0x861,0x94b2,0xffdf,0x8c51,0x2104,0xffff,0x39e7,0x4a49,0xffff,0x20,0x1082,0xffff,0x39c7,0x4228,0xffdf,0x9cf3,0x7bef,0x10a2,0x632c,0xce59,0x6b6d,0xffdf,0x5aeb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x39e7,0x9cd3,0xa534,0x52aa,0x0,0x0,0x31a6,0xa514,0x9cf3,0x3186,0x0,0x861,0x7bef,0x9cd3,0x10a2,0x1082,0x8c71,0x8c71,0x10a2,0x7bcf,0x18e3,0x2104,0x7bcf,0x0,0x20,0x7bcf,0x18e3,0x7bef,0xb5b6,0x7bef,0xd69a,0xdedb,0x18c3,0x7bcf,0xad75,0x630c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xef5d,0xb596,0x31a6,0xb5b6,0xd6ba,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x20,0x0,0x0,0x20,0x0,0x0,0x20,0x0,0x0,0x20,0x0,0x2965,0x9cd3,0xad55,0x8c71,0x18e3,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,};
-const uint16_t information_app_bmp[] PROGMEM = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1904,0x31e8,0x3a49,0x3a49,0x3a49,0x3a49,0x3a49,0x3a4a,0x3a4a,0x3a4a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a2a,0x3a0a,0x3a0a,0x3a0a,0x3a0a,0x3a0a,0x3a0a,0x420a,0x3a0a,0x31c9,0x18e4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3a28,0xbe39,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xc619,0x39e9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x636d,0xffff,0xffff,0xf7df,0xc6fd,0xa65b,0x9e3b,0xa63b,0xa63b,0xa63b,0xa63b,0xa63b,0xa63b,0xa61b,0xa61b,0xa61b,0xa61b,0xa61b,0xa61b,0xa61b,0xa5fb,0xa5fc,0xa5fc,0xa5fc,0xa5fc,0xa5fc,0xaddc,0xaddc,0xaddc,0xaddc,0xaddc,0xaddc,0xaddc,0xadbc,0xadbc,0xadbc,0xadbc,0xadbc,0xadbc,0xadbc,0xce9e,0xf7bf,0xffff,0xffff,0x6b6f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3a29,0xffff,0xffff,0xae7b,0x1c35,0x3b3,0x373,0x353,0x353,0x353,0x334,0x334,0x314,0x314,0x314,0x2f4,0x2f4,0xad5,0xad5,0xab5,0xab5,0xab5,0xa95,0xa95,0x1276,0x1276,0x1276,0x1256,0x1256,0x1236,0x1236,0x1a17,0x1a17,0x1a17,0x19f7,0x19f7,0x19d7,0x19d7,0x21d8,0x21b8,0x21b8,0x29d8,0x4279,0xb5dd,0xffff,0xffff,0x528b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x21,0xcedb,0xffff,0x9e5a,0x393,0x3b3,0xbb4,0xbb4,0xbb4,0xb94,0xb94,0xb74,0x1374,0x1375,0x1355,0x1355,0x1335,0x1335,0x1335,0x1315,0x1b16,0x1af6,0x1af6,0x1af6,0x1ad6,0x1ad6,0x1ab6,0x22b6,0x22b7,0x2297,0x2297,0x2297,0x2277,0x2277,0x2257,0x2a57,0x2a58,0x2a38,0x2a38,0x2a18,0x2a18,0x2a18,0x29f8,0x29b8,0x2178,0xad7c,0xffff,0xd6bc,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x42aa,0xffff,0xe79e,0x1414,0x3b3,0xbd4,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb55,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x1af6,0x1af6,0x1ad6,0x1ad6,0x1ad6,0x1ab6,0x22b6,0x22b6,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2257,0x2a38,0x2a38,0x2a18,0x2a18,0x2a18,0x29f8,0x29f8,0x31f9,0x29b8,0x3a39,0xef5e,0xffff,0x422a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0xa67a,0x3b3,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af6,0x1ad6,0x1ad6,0x1ad6,0x1ab6,0x1277,0x1277,0x1a97,0x2297,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2978,0xb59c,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6d98,0x392,0xbd4,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af6,0x1ad6,0x1ad6,0x1297,0x22d6,0x53b4,0x5394,0x22b6,0x1a57,0x2277,0x2277,0x2257,0x2257,0x2257,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x8c5b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6577,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af6,0x1af6,0x12b6,0x5bf3,0xe66c,0xfeeb,0xfeeb,0xde4c,0x5bb3,0x1237,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x7c1b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af6,0x12b6,0x4bb4,0xfeeb,0xff0a,0xfeeb,0xfeeb,0xff2a,0xf6cb,0x4315,0x1a57,0x2277,0x2257,0x2237,0x2a38,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af6,0xab6,0xad6f,0xff2a,0xfecb,0xfeeb,0xfeeb,0xfecb,0xff4a,0xa4f0,0x1218,0x2277,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x1af6,0x1af6,0x1ad6,0xcded,0xff0a,0xfeeb,0xfeeb,0xfeeb,0xfeeb,0xff2a,0xbdae,0x1a57,0x2257,0x2257,0x2257,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x1af6,0x1af6,0x12b6,0xb58e,0xff2a,0xfecb,0xfeeb,0xfeeb,0xfecb,0xff2a,0xb54f,0x1a38,0x2277,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af6,0xab6,0x5bf3,0xff2a,0xff0a,0xfecb,0xfecb,0xff0a,0xff2a,0x63b3,0x1a38,0x2277,0x2257,0x2237,0x2a38,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af6,0x1af6,0x12b6,0x7c71,0xfecb,0xff4a,0xff2a,0xf6ab,0x7c52,0x1a57,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af6,0x1ad6,0x1ad6,0xa97,0x3b54,0x8cd1,0x7452,0x32f5,0x1257,0x2277,0x2277,0x2257,0x2257,0x2257,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af6,0x1af6,0x1ad6,0x22d6,0x1297,0xa57,0x1257,0x1a77,0x2297,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af6,0x12b6,0xa97,0x1296,0x1ab6,0x22d6,0x22b6,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2a38,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f5,0x12f6,0x1af5,0x9510,0x7c91,0x4374,0x22b6,0x1277,0x1277,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x1b15,0x12d6,0x3b94,0xff0a,0xff2a,0xfecb,0xd62d,0xa52f,0x5bd3,0x1a97,0x2297,0x2277,0x2277,0x2257,0x2257,0x2257,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x1b15,0x2b6,0x7491,0xff0a,0xfecb,0xfeeb,0xff0a,0xff89,0xa52f,0x1257,0x2297,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x1b15,0xad6,0xad6f,0xff2a,0xfecb,0xfeeb,0xfeeb,0xff0a,0x63f3,0x1257,0x2297,0x2277,0x2277,0x2257,0x2257,0x2237,0x2a38,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f6,0x1b15,0xe66c,0xff0a,0xfeeb,0xfeeb,0xfeea,0xf6ab,0x3315,0x1a77,0x2297,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0xad6,0x4bd3,0xfeeb,0xfeeb,0xfeeb,0xfeeb,0xff2a,0xc5ce,0x1a97,0x2297,0x2297,0x2277,0x2277,0x2257,0x2257,0x2257,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1b15,0x2b6,0x84d0,0xff2a,0xfeeb,0xfeeb,0xfecb,0xff2a,0x8cd0,0xa57,0x2296,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x12f6,0xbdce,0xff2a,0xfeeb,0xfeeb,0xfeeb,0xff0a,0x5bd3,0x1277,0x2296,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2a38,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x12f5,0x2355,0xeeab,0xff0a,0xfeeb,0xfeeb,0xff0a,0xee8c,0x2af6,0x1a97,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1335,0xad6,0x5c12,0xff0a,0xfeeb,0xfeeb,0xfeeb,0xff2a,0xb58e,0x1297,0x22b6,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2257,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1b35,0x2d6,0x9510,0xff2a,0xfecb,0xfeeb,0xfeeb,0xff2a,0x8491,0xa57,0x22b6,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0xce0d,0xff0a,0xfeeb,0xfeeb,0xfeeb,0xfeeb,0x4b94,0x1277,0x22b6,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2a38,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0xb15,0x2b74,0xf6cb,0xfeeb,0xfeeb,0xfeeb,0xff0a,0xde4c,0x22d6,0x1a96,0x2296,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x2d6,0x6471,0xff0a,0xfeeb,0xfeeb,0xfecb,0xff2a,0xa54f,0x1277,0x22b6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2257,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x2f6,0x9d4f,0xff2a,0xfecb,0xfeeb,0xfeeb,0xff2a,0x7452,0xa77,0x22b6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1b35,0xde4c,0xff0a,0xfeeb,0xfeeb,0xfeeb,0xfecb,0x3b55,0x1296,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2a38,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0xb15,0x3bd3,0xfeeb,0xfeeb,0xfeeb,0xfeeb,0xff0a,0xd60d,0x1ab6,0x1ab6,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1355,0x2f6,0x74b1,0xff2a,0xfeeb,0xfeeb,0xfecb,0xff2a,0x9d10,0xa77,0x22d6,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2257,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0xb15,0xad8e,0xff2a,0xfeeb,0xfeeb,0xfeeb,0xff0a,0x6412,0xa97,0x22b6,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1355,0xb35,0x1b55,0xe68c,0xff0a,0xfeeb,0xfeeb,0xfeea,0xf6ab,0x2b35,0x12b6,0x1ab6,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2a38,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1355,0xb15,0x43f3,0xfeeb,0xfeeb,0xfeeb,0xfeeb,0xff2a,0xc5ce,0x12b6,0x1ad6,0x1ab6,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6578,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1355,0x2f6,0x952f,0xff4a,0xfeeb,0xfeeb,0xf6cb,0xff2a,0x8cd0,0xa97,0x1ad6,0x1ab6,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2257,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6577,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1355,0xb15,0x6c91,0xde4c,0xf6cb,0xff2a,0xff2a,0xff0a,0x53d3,0x1296,0x1ad6,0x1ab6,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x841b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bef,0xffff,0x6d78,0x392,0xbd3,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0xb15,0x1315,0x3394,0x6c91,0xad8e,0xce0d,0x2315,0x12b6,0x1ad6,0x1ab6,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2a38,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x843b,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7bf0,0xffff,0x85f9,0x392,0xbd4,0x3b3,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0xaf6,0x2b6,0xad6,0x1af6,0x1ad6,0x1ad6,0x1ab6,0x1ab6,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2237,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x29d8,0x31f9,0x2158,0x9cfc,0xffff,0x6b4f,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x530c,0xffff,0xc6fc,0x3d3,0x3d3,0xbd4,0x3b4,0xbb4,0xb94,0xb94,0xb74,0xb74,0xb74,0xb54,0x1355,0x1335,0x1335,0x1335,0x1315,0x1315,0x1b15,0x1af5,0x12f6,0x1ad6,0x1ad6,0x1ab6,0x1ab6,0x1ab6,0x1a96,0x2297,0x2277,0x2277,0x2277,0x2257,0x2257,0x2257,0x2238,0x2a38,0x2a18,0x2a18,0x29f8,0x29f8,0x29f8,0x31f9,0x31d9,0x29b9,0xce9d,0xffff,0x4a6c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x882,0xe75d,0xffff,0x7598,0x372,0x3b3,0xbb4,0xbb4,0xbb4,0xb94,0xb94,0x1394,0x1375,0x1375,0x1355,0x1355,0x1355,0x1335,0x1b35,0x1b15,0x1b16,0x1b16,0x1af6,0x1af6,0x1af6,0x1ad6,0x22d6,0x22b6,0x22b7,0x22b7,0x2297,0x2297,0x2277,0x2a77,0x2a77,0x2a58,0x2a58,0x2a38,0x2a38,0x2a38,0x2a18,0x3218,0x31f8,0x29d8,0x1938,0x8c7b,0xffff,0xe73d,0x862,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x636e,0xffff,0xffdf,0x7598,0xbd4,0x373,0x353,0x353,0x353,0x333,0x333,0x314,0x314,0x2f4,0x2f4,0x2f4,0x2d4,0x2d4,0x2b5,0x2b5,0xa95,0xa95,0xa95,0xa75,0xa75,0xa56,0xa56,0x1256,0x1236,0x1236,0x1216,0x1216,0x11f7,0x11f7,0x19d7,0x19d7,0x19d7,0x19b7,0x19b7,0x1998,0x1998,0x2198,0x31f9,0x8c7b,0xffdf,0xffff,0x6b4e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7c51,0xffff,0xffff,0xdf5d,0x961a,0x6538,0x6538,0x6518,0x6518,0x6518,0x6518,0x6d18,0x6cf8,0x6cf8,0x6cf8,0x6cf8,0x6cd9,0x6cd9,0x6cd9,0x6cd9,0x6cb9,0x6cb9,0x6cb9,0x6cb9,0x7499,0x7499,0x7499,0x7499,0x747a,0x747a,0x747a,0x747a,0x745a,0x745a,0x745a,0x745a,0x7c3a,0x7c3a,0x7c3a,0x7c3a,0xa57c,0xe71e,0xffff,0xffff,0x8432,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x52ec,0xd6fc,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedc,0x5acc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x426a,0x73cf,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x8410,0x73af,0x422a,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1082,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x73ae,0xb596,0xb5b6,0xa514,0x39e7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xef5d,0x6b4d,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd69a,0xdefb,0x738e,0xb5b6,0xffff,0x52aa,0x0,0x0,0x861,0x2965,0x20,0x0,0x10a2,0x0,0x0,0x0,0x1082,0x20,0x5aeb,0x2945,0x0,0x0,0x2104,0x18c3,0x0,0x0,0x0,0x18c3,0x2945,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xce79,0x8c71,0x0,0x0,0xad55,0xdefb,0x0,0x4a49,0xdefb,0xd6ba,0xce79,0x18e3,0xce59,0x8410,0x0,0x528a,0xe71c,0x10a2,0xce59,0x5aeb,0x0,0xad75,0xf79e,0xf7be,0x8c71,0x0,0x7bef,0xdefb,0xdedb,0xad75,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xce79,0x9cd3,0x0,0x0,0x6b4d,0xf7be,0x841,0xe73c,0xa514,0x10a2,0xf79e,0x8430,0x738e,0xe71c,0x0,0xb596,0xad75,0x0,0xf79e,0x5acb,0x52aa,0xffff,0x2104,0x39e7,0x5aeb,0x2124,0xffff,0x630c,0x31a6,0xffff,0x528a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xce79,0x9492,0x0,0x0,0x8430,0xe73c,0x10a2,0xf7be,0xbdf7,0xa514,0xb5b6,0x5aeb,0x18c3,0xf7be,0x4228,0xe73c,0x4a49,0x0,0xef5d,0x4a69,0x8430,0xce79,0x0,0x0,0x0,0x528a,0xffff,0xa534,0xa534,0xad75,0x39e7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xce79,0xad75,0x10a2,0x52aa,0xffff,0x8c71,0x0,0xef5d,0x9cd3,0x0,0x738e,0x31a6,0x0,0xbdd7,0xf7be,0xd69a,0x20,0x0,0xef7d,0x52aa,0x528a,0xffff,0x2124,0x4a49,0x94b2,0x2945,0xffff,0x5acb,0x10a2,0x7bcf,0x1082,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb596,0xffdf,0xe73c,0xef5d,0x9492,0x841,0x0,0x4a49,0xe73c,0xef5d,0xdefb,0x31a6,0x0,0x52aa,0xffff,0x7bef,0x0,0x20,0xdedb,0x630c,0x0,0xa534,0xf79e,0xf79e,0x8410,0x0,0x7bcf,0xef7d,0xef7d,0xbdf7,0x861,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x841,0x861,0x861,0x20,0x0,0x0,0x0,0x0,0x20,0x2104,0x0,0x0,0x0,0x0,0x841,0x0,0x0,0x0,0x861,0x20,0x0,0x0,0x18c3,0x1082,0x0,0x0,0x0,0x1082,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18c3,0x2945,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1082,0x8430,0xb5b6,0x39c7,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x4228,0x8c51,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x8c51,0xd6ba,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x73ae,0xf7be,0x6b6d,0x3186,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9492,0x10a2,0x0,0x630c,0xb5b6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x8c71,0xdefb,0x0,0x4a49,0x632c,0x738e,0xa534,0x2965,0x10a2,0xdedb,0xe71c,0x7bef,0x10a2,0x18c3,0x9492,0xad55,0x4228,0x0,0x2965,0x738e,0x632c,0x73ae,0x2945,0x738e,0x630c,0xad55,0x39e7,0x52aa,0xad75,0x4228,0x0,0x18e3,0x8c51,0xad75,0x5aeb,0x0,0x8c71,0xffff,0xbdf7,0x4a69,0x2965,0x738e,0x0,0x0,0x6b4d,0xad75,0x73ae,0x20,0x0,0x6b4d,0x52aa,0x8c51,0x94b2,0x18c3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x8c51,0xdefb,0x0,0x9492,0xffff,0x8c51,0xd69a,0xdedb,0x10a2,0xce59,0xef7d,0x8c71,0x2965,0xd6ba,0xce59,0x9cd3,0xffff,0x31a6,0x4228,0xffff,0xd69a,0x6b6d,0x528a,0xffff,0xa514,0xbdf7,0xffff,0x9cf3,0xc618,0xf79e,0x0,0x7bef,0xad55,0x7bcf,0xffff,0x3186,0x7bcf,0xffff,0xb5b6,0x39c7,0x738e,0xf7be,0x0,0x8430,0xffdf,0x8c51,0xf79e,0x9cf3,0x0,0xd6ba,0xf79e,0x8410,0xf7be,0x9cf3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x8c51,0xdefb,0x0,0x8c51,0xdedb,0x0,0x4208,0xffff,0x0,0x7bcf,0xce79,0x0,0x4208,0xffff,0x1082,0x0,0xce59,0x94b2,0x39c7,0xffff,0x18e3,0x0,0x4a69,0xffdf,0x0,0x3186,0xffff,0x0,0x2945,0xffdf,0x1082,0x861,0x5aeb,0x8c51,0xffff,0x4a49,0x0,0xf7be,0x2945,0x0,0x73ae,0xdedb,0x0,0xe73c,0x7bcf,0x0,0x630c,0xf7be,0x0,0xce59,0x9cd3,0x0,0x8c71,0xce59,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x8c51,0xdedb,0x0,0x8c71,0xc638,0x0,0x528a,0xf79e,0x0,0x8430,0xd69a,0x0,0x4a49,0xffff,0x1082,0x0,0xce59,0x94b2,0x39e7,0xf79e,0x861,0x0,0x4a69,0xf79e,0x0,0x4a49,0xf79e,0x20,0x4208,0xf79e,0x1082,0xb596,0xbdd7,0x39e7,0xef7d,0x39c7,0x10a2,0xffff,0x3186,0x0,0x738e,0xdedb,0x0,0xe73c,0x7bef,0x0,0x630c,0xf7be,0x0,0xce59,0x8c51,0x0,0x94b2,0xc638,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x94b2,0xf79e,0x0,0x9cf3,0xdefb,0x0,0x5acb,0xffff,0x0,0x9492,0xe71c,0x0,0x841,0xdedb,0xce79,0xa514,0xffff,0x3186,0x4a49,0xffff,0x1082,0x0,0x5acb,0xffff,0x0,0x4a69,0xffff,0x20,0x4208,0xffff,0x10a2,0xce79,0xbdf7,0x6b6d,0xffff,0xa534,0x20,0xef7d,0xdedb,0x4a49,0x738e,0xf7be,0x0,0x8410,0xffdf,0x8c71,0xf79e,0x9cd3,0x0,0xe73c,0x9cd3,0x0,0xa514,0xdedb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4228,0x6b6d,0x0,0x4a49,0x632c,0x0,0x2945,0x7bef,0x0,0x4208,0x6b4d,0x0,0x0,0x18c3,0x8c71,0xa514,0x4208,0x0,0x2945,0x7bcf,0x20,0x0,0x2945,0x7bcf,0x0,0x2104,0x7bef,0x0,0x18e3,0x7bef,0x20,0x2945,0xa514,0x6b4d,0x4a49,0x8410,0x0,0x39e7,0xad55,0x528a,0x3186,0x738e,0x0,0x0,0x632c,0xad55,0x738e,0x0,0x0,0x6b4d,0x4228,0x0,0x4a49,0x632c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x20,0x0,0x0,0x20,0x0,0x0,0x20,0x0,0x0,0x20,0x0,0x0,0x20,0x0,0x0,0x20,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,};
-const uint16_t main_app_bmp2[] PROGMEM = {0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x39c7,0x738e,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x7bef,0x738e,0x39c7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xbdd7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdd7,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xe71c,0xffff,0xef7d,0x9cf3,0x6b6d,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x5aeb,0x6b6d,0x9cf3,0xef7d,0xffff,0xe71c,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xc638,0xffff,0xbdf7,0x2104,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xc618,0xffff,0xc638,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6b6d,0xffff,0xd6ba,0x841,0x0,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x0,0x20,0x20,0x0,0x841,0xd6ba,0xffff,0x632c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xc638,0xffff,0x4a69,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20e3,0x6ac9,0x8bac,0x93ed,0xa40d,0xac0d,0xabec,0x93ab,0x5a68,0x1061,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x528a,0xffff,0xb5b6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xf79e,0xf7be,0x10a2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x840,0x72ea,0xbd10,0xee34,0xfed7,0xfef7,0xfef6,0xeed7,0x8e79,0x8679,0xe6d7,0xfed6,0xe5f4,0x7b4b,0x0,0x0,0x0,0x0,0x0,0x0,0x10a2,0xffdf,0xdedb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6aa9,0xe593,0xfed7,0xfeb7,0xfe96,0xf655,0xfe55,0xbe36,0xd99,0x59a,0x59a,0x599,0xae36,0xfe95,0xfef7,0x72e9,0x0,0x0,0x0,0x0,0x0,0x20,0xe73c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdedb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10a2,0xbcb0,0xded2,0x5ea7,0x3e64,0x6668,0xde73,0xfe76,0xf675,0x2dd9,0x5ba,0x5ba,0x5ba,0x5ba,0x1db9,0xe655,0xfed6,0xb48f,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2923,0xe5b3,0xe6d3,0x1661,0x660,0x680,0x680,0x3664,0xf674,0xee76,0x5b9,0x5ba,0x5ba,0x5ba,0x5ba,0x5ba,0xce36,0xfed6,0xa44e,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2923,0xe5f3,0xfeb8,0x7e4a,0x680,0xe80,0xe80,0xe80,0x680,0xae6e,0xfe76,0x2dd9,0x5ba,0x5ba,0x5ba,0x5ba,0x15b9,0xee55,0xfed6,0x5a47,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1061,0xd572,0xfed6,0xfe56,0x7e6a,0x680,0xe80,0x680,0xe80,0x680,0x9e6d,0xfe76,0xb636,0x5ba,0x59a,0x59a,0x5ba,0xa616,0xfed6,0xa44e,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9c0d,0xfef7,0xf654,0xfe76,0xc670,0x680,0x680,0x680,0x680,0x1e82,0xe673,0xfe76,0xfe75,0xce56,0x7e17,0x7e17,0xc636,0xfe95,0xf655,0x18c2,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3985,0xfe75,0xfe75,0xfe76,0xfe76,0xfe76,0xa66e,0x2e83,0x1681,0x3e85,0xc671,0xfe76,0xf675,0xfe75,0xfe75,0xfe95,0xfe95,0xfe75,0xf675,0xfe75,0x93cc,0x20c2,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xac6e,0xfed7,0xf653,0xf650,0xfe73,0xfe76,0xfe76,0xf675,0xe674,0xfe75,0xfe76,0xfe75,0xfe75,0xfe75,0xf675,0xf675,0xf675,0xf675,0xfe75,0xfe75,0xff17,0xfeb6,0xb4af,0x41a5,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18a2,0xe5f4,0xfe6f,0xf602,0xf600,0xf601,0xf64c,0xf676,0xfe75,0xfe76,0xfe75,0xf675,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe96,0xac4e,0x730a,0x9bed,0xf634,0x836b,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x49e6,0xfe94,0xf602,0xf600,0xf600,0xf600,0xf600,0xf651,0xfe76,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xf675,0xfeb6,0x8bac,0x0,0x0,0x0,0x41c5,0xfeb6,0x41c5,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x72ea,0xfed2,0xede0,0xf600,0xf600,0xf601,0xf600,0xf62b,0xfe77,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe95,0xf655,0x2103,0x0,0x20,0x0,0x0,0xcd51,0x836b,0x0,0x840,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x7b0a,0xfef4,0xede0,0xf600,0xf601,0xf600,0xf600,0xf64e,0xfe76,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfe55,0xfe75,0xf655,0x20e3,0x0,0x20,0x0,0x0,0xc510,0x62a8,0x0,0x820,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x730a,0xfef7,0xf62b,0xf600,0xf600,0xf600,0xf628,0xfe96,0xfe96,0xfe96,0xfe75,0xfe75,0xfe75,0xfe75,0xfe75,0xfed7,0xfeb6,0xfed7,0xfe96,0xfeb6,0x8b8b,0x0,0x0,0x0,0x41c6,0xe5f4,0x20c2,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11c9,0x1bb5,0x7559,0xfe95,0xf676,0xf651,0xf62b,0xf64f,0xfe96,0xfe13,0xf5af,0xfe12,0xfe96,0xfe75,0xfe75,0xfe95,0xfe75,0xf46d,0xf308,0xf38a,0xfdd3,0xfe96,0xfe96,0xac6e,0x5a68,0x834b,0xfe95,0x93ed,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x905,0x2c58,0x3dff,0x35ff,0x4dff,0xee76,0xfe75,0xfe76,0xfe77,0xfe97,0xf54d,0xf3a0,0xf3a0,0xf3a0,0xf52b,0xfe96,0xfe75,0xfeb6,0xf38a,0xf080,0xf0c0,0xf080,0xf1c3,0xfe13,0xfe96,0xfed6,0xfeb6,0xff37,0xd572,0x820,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11c9,0x359f,0x3dff,0x3ddf,0x3dff,0x2d3d,0xb5d6,0xfe95,0xf655,0xfe95,0xf612,0xf3a0,0xf380,0xf3a0,0xf3a0,0xf380,0xf5d0,0xfeb6,0xfe14,0xf141,0xf100,0xf120,0xf120,0xf0c0,0xf4ae,0xfed6,0xf634,0xfe96,0xee14,0x2923,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x967,0x3ddf,0x3dbf,0x3dff,0x34fc,0x124c,0x42,0x2103,0xee34,0xfe95,0xf696,0xf58f,0xf380,0xf3a0,0xf3a0,0xf3a0,0xf380,0xf56d,0xfeb7,0xfe13,0xf141,0xf100,0xf120,0xf120,0xf0c0,0xf48e,0xf6b6,0xfeb6,0xee34,0x41a5,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x21,0x34fb,0x3ddf,0x3dff,0x2c16,0x41,0x0,0x0,0x0,0x5a68,0xfeb6,0xfe96,0xf5f2,0xf3a0,0xf380,0xf3a0,0xf3a0,0xf380,0xf5d0,0xfe96,0xfeb6,0xf36a,0xf080,0xf0c0,0xf080,0xf1a2,0xfdf3,0xfef7,0xd592,0x3144,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x1a8e,0x3e1f,0x3ddf,0x2c79,0x0,0x0,0x0,0x0,0x0,0x0,0x5a68,0xf655,0xfef7,0xf54d,0xeba0,0xf380,0xf3a0,0xf52b,0xfe96,0xfe75,0xfe75,0xf655,0xf42c,0xf2a6,0xf369,0xfe14,0xfeb6,0x93ed,0x1061,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2cba,0x3dff,0x35bf,0x906,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3144,0xbcd0,0xfeb6,0xfe74,0xfdd0,0xfe12,0xfe96,0xfe75,0xfe75,0xfe95,0xfe96,0xff17,0xff17,0xf6b6,0xacaf,0x3964,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x11a9,0x23d5,0x35bf,0x3dff,0x2c37,0x0,0x0,0x0,0x0,0x0,0x8c4,0x2c17,0x8e4,0x0,0x0,0x41a5,0x93ed,0xddf4,0xf676,0xf676,0xf675,0xf655,0xee34,0xee14,0xc4f0,0x72c9,0x2903,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x0,0xc4,0x2c57,0x3dff,0x3dff,0x359f,0x3e5f,0x1acf,0x0,0x0,0x0,0x0,0x83,0x2cdb,0x3e3f,0x2cdb,0x8a3,0x0,0x0,0x0,0x800,0x3330,0x561f,0x55ff,0x32ad,0x1860,0x10a2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0xc4,0x353d,0x3dff,0x3dbf,0x3ddf,0x357e,0x353d,0x11ea,0x0,0x20,0x0,0x83,0x2cfb,0x3dff,0x359e,0x3dff,0x2cfb,0x83,0x0,0x21,0x0,0x122c,0x35ff,0x35ff,0x12cf,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x2c79,0x3dff,0x3dbf,0x355d,0x126d,0xa4,0x21,0x0,0x0,0x0,0x83,0x2cdb,0x3dff,0x359f,0x3dbf,0x359f,0x3dff,0x2cdb,0x83,0x0,0x0,0x122c,0x3dff,0x3d9f,0x3d9f,0x34fb,0x1b31,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x21,0x0,0x122c,0x3dff,0x3ddf,0x351c,0xa3,0x0,0x0,0x0,0x0,0x0,0x83,0x2cdb,0x3dff,0x35bf,0x3ddf,0x35bf,0x3ddf,0x35bf,0x3dff,0x2cda,0x83,0x0,0x124d,0x3e5f,0x3dff,0x3dff,0x3ddf,0x3e1f,0x351c,0x8e4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x2c79,0x3dff,0x3dbf,0x11a9,0x0,0x20,0x0,0x0,0x0,0x20,0x2cdb,0x3e1f,0x3ddf,0x353c,0x355d,0x3ddf,0x355d,0x353c,0x3ddf,0x3e1f,0x2cdb,0x0,0x988,0x2c58,0x2c16,0x2cda,0x3ddf,0x3dbf,0x3dff,0x2cdb,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x0,0x62,0x357e,0x3dff,0x2cba,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1a6d,0x3e1f,0x2cdb,0x905,0x2cda,0x3e1f,0x2cda,0x905,0x34fb,0x3e1f,0x1a6d,0x0,0x0,0x0,0x0,0x0,0x968,0x351c,0x3dbf,0x3e1f,0x1af0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x0,0xe5,0x359f,0x3e1f,0x23f6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x11ea,0xa4,0x0,0x351c,0x3dff,0x351c,0x0,0xc4,0x11ea,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x947,0x35bf,0x3ddf,0x34fb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x0,0xc4,0x359f,0x3dff,0x2c58,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x34fb,0x3dff,0x34fb,0x41,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2c57,0x3dff,0x357e,0xc4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x0,0x41,0x355d,0x3ddf,0x355d,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x21,0x34fb,0x3dff,0x34fb,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23f6,0x3e1f,0x359e,0x905,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x2416,0x3dff,0x3ddf,0x1aae,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x21,0x34fb,0x3dff,0x34fb,0x21,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x41,0x353c,0x3ddf,0x357e,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x21,0x0,0x11a9,0x3dff,0x35bf,0x35bf,0x124d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x21,0x34fb,0x3dff,0x34fb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2352,0x3dff,0x3dff,0x2c16,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdefb,0x20,0x0,0x0,0x1b32,0x3e3f,0x359f,0x3dff,0x23f6,0x120b,0x926,0x8e5,0x8e5,0x8e5,0x41,0x0,0x21,0x34fb,0x3dff,0x351c,0x906,0x8e5,0x8e5,0x8e5,0x8e5,0x8e5,0x8e5,0x8e5,0x11ca,0x2c37,0x3ddf,0x35bf,0x3dff,0x988,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xe71c,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xdedb,0x20,0x0,0x0,0x0,0x23b4,0x3e1f,0x3ddf,0x3dff,0x3ddf,0x359f,0x357e,0x357e,0x359f,0x967,0x0,0x0,0x2c99,0x3dff,0x359e,0x357e,0x357e,0x357e,0x357e,0x357e,0x357e,0x357e,0x357e,0x3ddf,0x3dff,0x3ddf,0x3e1f,0x1af0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xdefb,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xffdf,0xe73c,0x841,0x0,0x0,0x0,0x0,0x126d,0x34fb,0x3ddf,0x3e1f,0x3e1f,0x3e1f,0x3e1f,0x3e3f,0x988,0x0,0x0,0x120b,0x3dff,0x3e1f,0x3e1f,0x3e1f,0x3e1f,0x3e1f,0x3e1f,0x3e1f,0x3e1f,0x3e1f,0x3e1f,0x3dff,0x355d,0x126d,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0xef5d,0xdefb,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0xf79e,0xffff,0x18e3,0x0,0x0,0x0,0x0,0x0,0x21,0x11ca,0x1b10,0x2372,0x2373,0x2373,0x2373,0x8e4,0x0,0x0,0x0,0x989,0x2352,0x2373,0x2373,0x2373,0x2373,0x2373,0x2373,0x2373,0x2373,0x1b31,0x122c,0x62,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2104,0xffff,0xd6ba,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xbdd7,0xffff,0x5aeb,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x630c,0xffff,0xb596,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x528a,0xffff,0xef5d,0x2945,0x0,0x0,0x0,0x0,0x0,0x20,0x20,0x20,0x20,0x20,0x20,0x0,0x0,0x0,0x0,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2945,0xef5d,0xffff,0x5aeb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xb5b6,0xffff,0xef5d,0x5acb,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x5acb,0xef5d,0xffff,0xb596,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1082,0xc638,0xffff,0xffff,0xdefb,0xad55,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0xad75,0xdefb,0xffff,0xffff,0xc618,0x861,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x7bef,0xe73c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe73c,0x7bef,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x841,0x3186,0x4228,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4a49,0x4228,0x3186,0x841,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10a2,0x841,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x10a2,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3186,0xad75,0xce59,0x9cd3,0x18c3,0x0,0xe71c,0x5acb,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18e3,0xef5d,0x31a6,0x0,0x0,0x0,0x841,0x8430,0xc638,0xb5b6,0x4a49,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2965,0xffff,0xb5b6,0x6b4d,0xdefb,0xbdd7,0x0,0xef7d,0x630c,0x0,0x0,0x10a2,0x2104,0x0,0x0,0x20,0x1082,0x0,0x0,0x1082,0x20,0x0,0x20,0x18e3,0x2104,0xf7be,0x39c7,0x0,0x0,0x0,0xbdf7,0xef7d,0x738e,0xa514,0xffdf,0x2945,0x0,0x18c3,0x2945,0x0,0x0,0x20,0x861,0x0,0x2124,0x0,0x0,0x10a2,0x0,0x0,0x0,0x10a2,0x0,0x0,0x2124,0x18e3,0x0,0x0,0x0,0x2945,0x18e3,0x0,0x0,0x0,0x9cd3,0xdefb,0x0,0x0,0x1082,0x2945,0x0,0xef5d,0x630c,0x0,0x7bef,0xf79e,0xf79e,0xbdd7,0x0,0x39e7,0xef7d,0x861,0x1082,0xef7d,0x31a6,0x1082,0xdedb,0xf79e,0xc638,0xf7be,0x31a6,0x0,0x0,0x39c7,0xffff,0x31a6,0x0,0x0,0x31a6,0x0,0x8410,0xe73c,0xdefb,0xbdd7,0x0,0x4a49,0xe73c,0xb596,0xffdf,0xc618,0x20,0xd69a,0x8410,0x0,0x52aa,0xe71c,0x2124,0xbdf7,0xdedb,0xe73c,0x6b4d,0x0,0xa514,0xd6ba,0xe73c,0x630c,0x0,0x0,0xbdf7,0xad55,0x0,0x841,0x0,0x0,0x20,0xef7d,0x52aa,0x18c3,0xffff,0x52aa,0x1082,0xffdf,0x738e,0x3186,0xffff,0x1082,0x10a2,0xffff,0x2965,0x8430,0xf79e,0x861,0x6b6d,0xffff,0x3186,0x0,0x0,0x5aeb,0xffdf,0x861,0x0,0x20,0x0,0x0,0x4a69,0x31a6,0x630c,0xffff,0x18e3,0x4228,0xffff,0x4a49,0x2965,0xffff,0x2945,0x7bcf,0xe71c,0x0,0xb596,0xad75,0x0,0x630c,0x18e3,0xbdf7,0xce59,0x861,0xffff,0x73ae,0x2965,0x10a2,0x0,0x0,0xb596,0xc618,0x0,0x0,0x20,0x2124,0x20,0xef7d,0x4a49,0x4208,0xffdf,0x0,0x0,0xb596,0xa514,0x31a6,0xf7be,0x20,0x861,0xf7be,0x3186,0xad55,0xad55,0x0,0x10a2,0xf7be,0x31a6,0x0,0x0,0x4a69,0xffff,0x18c3,0x0,0x0,0x2124,0x20,0x5aeb,0xbdd7,0xa514,0xf79e,0x2104,0x4228,0xf7be,0x0,0x841,0xf7be,0x39e7,0x18c3,0xf7be,0x4228,0xe73c,0x4a49,0x0,0x9cd3,0xad55,0xc638,0xc618,0x0,0x5aeb,0xdedb,0xdefb,0x52aa,0x0,0x0,0x52aa,0xffff,0x5aeb,0x861,0x9cd3,0xdedb,0x20,0xf79e,0x6b4d,0x18c3,0xffff,0x5aeb,0x10a2,0xffdf,0x738e,0x2945,0xffff,0x2965,0x5acb,0xffff,0x2945,0x8430,0xf79e,0x1082,0x738e,0xffff,0x31a6,0x0,0x0,0x841,0xef7d,0xad75,0x10a2,0x4a69,0xf7be,0x4a69,0xffdf,0x6b6d,0x3186,0xffff,0x2965,0x4a49,0xffdf,0x841,0x1082,0xffdf,0x4a49,0x0,0xbdd7,0xf7be,0xd69a,0x0,0x630c,0xffff,0x841,0x9cf3,0xdedb,0x1082,0x5aeb,0x861,0xad75,0xe71c,0x0,0x0,0x0,0x7bef,0xf79e,0xef7d,0xe73c,0x4a49,0x0,0xa514,0xf79e,0x861,0x738e,0xf79e,0xf79e,0xb5b6,0x841,0x20,0xc618,0xf7be,0xad75,0xe73c,0x31a6,0x1082,0xd6ba,0xf79e,0xb5b6,0xe73c,0x31a6,0x0,0x20,0x0,0x39c7,0xdedb,0xef7d,0xf7be,0x8c71,0x0,0x9cf3,0xef5d,0xa514,0xd69a,0xa534,0x4228,0xe73c,0x20,0x861,0xef5d,0x4228,0x0,0x5acb,0xffff,0x7bef,0x0,0x2945,0xdedb,0xd69a,0x9cf3,0xef5d,0x73ae,0xbdd7,0xe73c,0xe71c,0x632c,0x0,0x0,0x0,0x0,0x861,0x2104,0x0,0x0,0x0,0x0,0x18e3,0x20,0x0,0x1082,0x18e3,0x0,0x0,0x0,0x0,0x18e3,0x0,0x841,0x20,0x0,0x20,0x18e3,0x0,0x841,0x0,0x0,0x0,0x0,0x0,0x0,0x18e3,0x1082,0x0,0x0,0x0,0x2104,0x20,0x0,0x1082,0x0,0x861,0x0,0x0,0x861,0x0,0x0,0x0,0x841,0x0,0x0,0x0,0x861,0x2104,0x0,0x861,0x20,0x0,0x2104,0x10a2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2945,0x2945,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x18e3,0xf7be,0xf7be,0x18e3,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x73ae,0xe71c,0xef5d,0x738e,0x0,0x861,0x7bcf,0x52aa,0xa514,0x7bcf,0x0,0x841,0x7bcf,0x52aa,0xa514,0x7bcf,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xd69a,0x6b6d,0x7bcf,0xd69a,0x0,0x10a2,0xffff,0xd6ba,0x8c71,0xffff,0x7bef,0x20,0xffff,0xd6ba,0x8c71,0xffff,0x8410,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2124,0xffff,0x5acb,0x632c,0xffff,0x2104,0x841,0xffdf,0x528a,0x0,0x94b2,0xd69a,0x841,0xf7be,0x528a,0x0,0x94b2,0xd6ba,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x738e,0xffff,0xe71c,0xe71c,0xffff,0x6b4d,0x0,0xffff,0x52aa,0x0,0x9cd3,0xd69a,0x841,0xffdf,0x52aa,0x0,0x94b2,0xd6ba,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xef5d,0x9cd3,0x0,0x0,0xa534,0xe73c,0x1082,0xffdf,0xd6ba,0x94b2,0xffff,0x73ae,0x0,0xffff,0xd6ba,0x94b2,0xffff,0x7bcf,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x861,0x8410,0x2124,0x0,0x0,0x2945,0x7bef,0x2104,0xe73c,0x7bef,0x9cf3,0x738e,0x0,0x1082,0xef5d,0x7bef,0x9cf3,0x738e,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1082,0xffff,0x4208,0x0,0x0,0x0,0x10a2,0xffff,0x4208,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x841,0x8410,0x2124,0x0,0x20,0x0,0x841,0x8410,0x2124,0x0,0x20,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,};
+/**
+ * @file                    bitmaps.h
+ * @brief                   Bitmaps used by the app, compressed by `tools/bitmapconv` (generated, do not edit)
+ *
+ */
 
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_BITMAPS_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_BITMAPS_H__
 
+#include "bitmapasset.h"
+
+const uint16_t qrcode_bmp_palette[] PROGMEM = {0x0,0xffff};
+const uint8_t qrcode_bmp_data[] PROGMEM = {0xff,0xa8,0x2,0x0,0xa2,0x1,0x89,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0xa2,0x1,0x89,0x0,0xa2,0x1,0x89,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0xa2,0x1,0x89,0x0,0xa2,0x1,0x89,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0xa2,0x1,0x89,0x0,0xa2,0x1,0x89,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0xa2,0x1,0x89,0x0,0xa2,0x1,0x89,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0xa2,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x93,0x0,0x8e,0x1,0x93,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x93,0x0,0x8e,0x1,0x93,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x93,0x0,0x8e,0x1,0x93,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x93,0x0,0x8e,0x1,0x93,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x93,0x0,0x8e,0x1,0x93,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x89,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x89,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x89,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x89,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x89,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x8e,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x8e,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x8e,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x8e,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x8e,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0xa2,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0xa2,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0xa2,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0xa2,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0xa2,0x1,0xb6,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0xde,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0xde,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0xde,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0xde,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0xb1,0x0,0x89,0x1,0x8e,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x98,0x0,0x89,0x1,0x98,0x0,0x89,0x1,0x8e,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x98,0x0,0x89,0x1,0x98,0x0,0x89,0x1,0x8e,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x98,0x0,0x89,0x1,0x98,0x0,0x89,0x1,0x8e,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x98,0x0,0x89,0x1,0x98,0x0,0x89,0x1,0x8e,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x98,0x0,0x89,0x1,0x98,0x0,0x84,0x1,0x9d,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x98,0x1,0x8e,0x0,0x84,0x1,0x9d,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x98,0x1,0x8e,0x0,0x84,0x1,0x9d,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x98,0x1,0x8e,0x0,0x84,0x1,0x9d,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x98,0x1,0x8e,0x0,0x84,0x1,0x9d,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x98,0x1,0x98,0x0,0x84,0x1,0x89,0x0,0x98,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x98,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x98,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x98,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x98,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x98,0x1,0x93,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x98,0x1,0x93,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x98,0x1,0x93,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x98,0x1,0x93,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x98,0x1,0x93,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x8e,0x0,0x8e,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x98,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x8e,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x98,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x8e,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x98,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x8e,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x98,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x8e,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x98,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x8e,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x8e,0x0,0xac,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x8e,0x0,0xac,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x8e,0x0,0xac,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x8e,0x0,0xac,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x8e,0x0,0xac,0x1,0x84,0x0,0x84,0x1,0xbb,0x0,0x84,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0xc5,0x0,0x84,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0xc5,0x0,0x84,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0xc5,0x0,0x84,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0xc5,0x0,0x84,0x1,0x93,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x9d,0x0,0xa2,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x8e,0x0,0x84,0x1,0x9d,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x8e,0x0,0x84,0x1,0x9d,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x8e,0x0,0x84,0x1,0x9d,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x8e,0x0,0x84,0x1,0x9d,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x8e,0x0,0x84,0x1,0x9d,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x8e,0x0,0x9d,0x1,0x84,0x0,0x8e,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x8e,0x0,0x9d,0x1,0x84,0x0,0x8e,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x8e,0x0,0x9d,0x1,0x84,0x0,0x8e,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x8e,0x0,0x9d,0x1,0x84,0x0,0x8e,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x8e,0x1,0x8e,0x0,0x9d,0x1,0x84,0x0,0x8e,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x8e,0x1,0x93,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x8e,0x1,0x93,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x8e,0x1,0x93,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x8e,0x1,0x93,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x8e,0x1,0x93,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x89,0x1,0x89,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x93,0x0,0x89,0x1,0x84,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x98,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x84,0x1,0x84,0x0,0x89,0x1,0x89,0x0,0x84,0x1,0x84,0x0,0x8e,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x9d,0x1,0x89,0x0,0x89,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x9d,0x1,0x89,0x0,0x89,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x9d,0x1,0x89,0x0,0x89,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x9d,0x1,0x89,0x0,0x89,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0x89,0x0,0xa2,0x1,0x84,0x0,0x9d,0x1,0x89,0x0,0x89,0x1,0x8e,0x0,0x84,0x1,0x89,0x0,0x84,0x1,0xff,0xa8,0x2,0x0};
+constexpr bitmap_asset_t qrcode_bmp {135, 135, qrcode_bmp_palette, qrcode_bmp_data, 3326};
+
+const uint16_t main_app_bmp2_palette[] PROGMEM = {0x0,0x20,0xffff,0xdefb,0xfe75,0x861,0xffdf,0x7bef,0x3dff,0x4a49,0x5aeb,0xe71c,0x9cd3,0x3e1f,0x3ddf,0x841,0x1082,0xfe96,0x10a2,0x2104,0xe73c,0xf7be,0xfe76,0x5ba,0x21,0x18e3,0x34fb,0x357e,0xf600,0xf79e,0x2945,0xef5d,0xf3a0,0xfeb6,0xfe95,0x680,0x2373,0x31a6,0x738e,0xd6ba,0xef7d,0xf675,0x8e5,0xdedb,0x2124,0x2cdb,0x359f,0x35bf,0x52aa,0xbdd7,0xa514,0xd69a,0xf655,0xfed6,0x83,0x3186,0x3dbf,0x4228,0x630c,0x7bcf,0x9cf3,0xc638,0xf380,0x41,0x18c3,0x2965,0x351c,0x355d,0x5acb,0x6b6d,0x8410,0xad75,0xb596,0xb5b6,0xc618,0xfef7,0xc4,0xe80,0x39c7,0x4a69,0x94b2,0xad55,0xbdf7,0xfed7,0x62,0x59a,0x905,0x122c,0x2cda,0x528a,0x5a68,0x6b4d,0x73ae,0x93ed,0xee34,0xf080,0xf0c0,0xf120,0xf676,0x8e4,0x988,0x1061,0x11a9,0x11ea,0x126d,0x23f6,0x2923,0x2c16,0x2c58,0x2c79,0x353c,0x359e,0x35ff,0x3e3f,0x41a5,0x4208,0x632c,0x8430,0x8c71,0xe5f4,0xf601,0xf62b,0xfe13,0xff17,0xa4,0x820,0x840,0x906,0x967,0x11c9,0x11ca,0x120b,0x124d,0x1a6d,0x1af0,0x1b31,0x20c2,0x20e3,0x2103,0x2352,0x2c37,0x2c57,0x2cba,0x2cfb,0x2dd9,0x3144,0x353d,0x39e7,0x3d9f,0x3e5f,0x41c5,0x72ea,0x730a,0x7e17,0x836b,0x8bac,0xa44e,0xa534,0xac6e,0xce59,0xd572,0xede0,0xee14,0xee76,0xf100,0xf141,0xf38a,0xf52b,0xf54d,0xf5d0,0xf602,0xf634,0xf651,0xf6b6,0xfe12,0xfe14,0xfe55,0xfe77,0xfeb7,0x42,0xa3,0xe5,0x599,0x5b9,0x660,0x800,0x8a3,0x8c4,0x926,0x947,0x968,0x989,0xd99,0x124c,0x12cf,0x15b9,0x1661,0x1681,0x1860,0x18a2,0x18c2,0x1a8e,0x1aae,0x1acf,0x1b10,0x1b32,0x1bb5,0x1db9,0x1e82,0x2372,0x23b4,0x23d5,0x2416,0x2903,0x2c17,0x2c99,0x2d3d,0x2e83,0x32ad,0x3330,0x34fc,0x3664,0x3964,0x3985,0x3e64,0x3e85,0x41c6,0x49e6,0x4dff,0x55ff,0x561f,0x5a47,0x5ea7,0x62a8,0x6668,0x6aa9,0x6ac9,0x72c9,0x72e9,0x7559,0x7b0a,0x7b4b,0x7e4a,0x7e6a,0x834b,0x8679,0x8b8b,0x8e79,0x93ab,0x93cc,0x9bed,0x9c0d,0x9e6d,0xa40d,0xa616};
+const uint8_t main_app_bmp2_data[] PROGMEM = {0xff,0xd,0x1,0x0,0xa5,0x1,0xd8,0x0,0x1,0x4e,0x26,0xa3,0x7,0x1,0x26,0x4e,0x95,0x0,0x1,0x13,0x31,0xa7,0x2,0x1,0x31,0x13,0x92,0x0,0x5,0x13,0xb,0x2,0x28,0x3c,0x45,0xa1,0xa,0x5,0x45,0x3c,0x28,0x2,0xb,0x13,0x90,0x0,0x4,0x1,0x3d,0x2,0x52,0x13,0xa5,0x0,0x3,0x13,0x4a,0x2,0x3d,0x90,0x0,0x4,0x45,0x2,0x27,0xf,0x0,0x81,0x1,0x91,0x0,0x81,0x1,0x8a,0x0,0x81,0x1,0x0,0x0,0x81,0x1,0x4,0x0,0xf,0x27,0x2,0x74,0x8f,0x0,0x4,0x3d,0x2,0x4f,0x0,0x1,0x96,0x0,0x9,0x89,0xec,0x9b,0x5d,0xfd,0xff,0xd,0xac,0xff,0xec,0xab,0xf8,0x5a,0x65,0x84,0x0,0x4,0x1,0x0,0x59,0x2,0x49,0x8e,0x0,0x3,0x5,0x1d,0x15,0x12,0x95,0x0,0xd,0x7e,0x97,0xff,0x10,0xbd,0x5e,0x53,0x4b,0xff,0xf6,0xfe,0xff,0xd7,0xee,0xf7,0xf5,0xff,0xd7,0xe6,0x35,0x77,0xf1,0x85,0x0,0x3,0x12,0x6,0x2b,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x94,0x0,0x8,0xeb,0xff,0x93,0xe5,0x53,0xb2,0x11,0x34,0xb0,0xff,0x36,0xbe,0xc0,0x81,0x55,0x4,0xb6,0xff,0x36,0xae,0x22,0x4b,0xee,0x84,0x0,0x3,0x1,0x14,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x2b,0x1,0x92,0x0,0x9,0x12,0xff,0xb0,0xbc,0xff,0xd2,0xde,0xe8,0xe0,0xea,0xff,0x73,0xde,0x16,0x29,0x90,0x83,0x17,0x3,0xcf,0xff,0x55,0xe6,0x35,0xff,0x8f,0xb4,0x84,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x91,0x0,0x4,0x6a,0xff,0xb3,0xe5,0xff,0xd3,0xe6,0xc4,0xb8,0x81,0x23,0x3,0xdd,0xff,0x74,0xf6,0xa3,0xb7,0x84,0x17,0x2,0xff,0x36,0xce,0x35,0x9c,0x84,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x90,0x0,0x4,0x6a,0xff,0xf3,0xe5,0xff,0xb8,0xfe,0xf2,0x23,0x82,0x4d,0x3,0x23,0xff,0x6e,0xae,0x16,0x90,0x83,0x17,0x3,0xc3,0xff,0x55,0xee,0x35,0xe7,0x84,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x8f,0x0,0xd,0x65,0xa0,0x35,0xff,0x56,0xfe,0xf3,0x23,0x4d,0x23,0x4d,0x23,0xfc,0x16,0xff,0x36,0xb6,0x17,0x81,0x55,0x3,0x17,0xfe,0x35,0x9c,0x85,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x8f,0x0,0x4,0xfb,0x4b,0xff,0x54,0xf6,0x16,0xff,0x70,0xc6,0x83,0x23,0x4,0xd0,0xff,0x73,0xe6,0x16,0x4,0xff,0x56,0xce,0x81,0x99,0x3,0xff,0x36,0xc6,0x22,0x34,0xc8,0x85,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x8e,0x0,0x0,0xdf,0x81,0x4,0x82,0x16,0x6,0xff,0x6e,0xa6,0xd9,0xc5,0xe1,0xff,0x71,0xc6,0x16,0x29,0x81,0x4,0x81,0x22,0x4,0x4,0x29,0x4,0xf9,0x88,0x84,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x8e,0x0,0x4,0x9e,0x53,0xff,0x53,0xf6,0xff,0x50,0xf6,0xff,0x73,0xfe,0x81,0x16,0x3,0x29,0xff,0x74,0xe6,0x4,0x16,0x82,0x4,0x83,0x29,0x81,0x4,0x3,0x7b,0x21,0xff,0xaf,0xb4,0x72,0x82,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x8d,0x0,0xb,0xc7,0x77,0xff,0x6f,0xfe,0xaa,0x1c,0x78,0xff,0x4c,0xf6,0x62,0x4,0x16,0x4,0x29,0x87,0x4,0x5,0x11,0xff,0x4e,0xac,0x98,0xfa,0xab,0x9a,0x81,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x8d,0x0,0x2,0xe3,0xff,0x94,0xfe,0xaa,0x83,0x1c,0x1,0xac,0x16,0x88,0x4,0x2,0x29,0x21,0x9b,0x82,0x0,0x7,0x96,0x21,0x96,0x0,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x8d,0x0,0x2,0x97,0xff,0xd2,0xfe,0xa1,0x81,0x1c,0x3,0x78,0x1c,0x79,0xb1,0x88,0x4,0x4,0x22,0x34,0x8a,0x0,0x1,0x81,0x0,0x6,0xff,0x51,0xcd,0x9a,0x0,0x7e,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x8b,0x0,0x6,0x1,0x0,0xf0,0xff,0xf4,0xfe,0xa1,0x1c,0x78,0x81,0x1c,0x1,0xff,0x4e,0xf6,0x16,0x87,0x4,0x5,0xb0,0x4,0x34,0x89,0x0,0x1,0x81,0x0,0x6,0xff,0x10,0xc5,0xe9,0x0,0x7d,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x8d,0x0,0x2,0x98,0x4b,0x79,0x82,0x1c,0x0,0xff,0x28,0xf6,0x82,0x11,0x84,0x4,0x5,0x53,0x21,0x53,0x11,0x21,0xf6,0x82,0x0,0x7,0xe2,0x77,0x88,0x0,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x8b,0x0,0xc,0x81,0xce,0xef,0x22,0x62,0xac,0x79,0xff,0x4f,0xf6,0x11,0x7a,0xff,0xaf,0xf5,0xae,0x11,0x81,0x4,0x5,0x22,0x4,0xff,0x6d,0xf4,0xff,0x8,0xf3,0xa6,0xff,0xd3,0xfd,0x81,0x11,0x4,0x9e,0x5a,0xf4,0x22,0x5d,0x81,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x89,0x0,0xa,0x56,0x6c,0x8,0x70,0xe4,0xa3,0x4,0x16,0xb1,0xff,0x97,0xfe,0xa8,0x82,0x20,0xf,0xa7,0x11,0x4,0x21,0xa6,0x5f,0x60,0x5f,0xff,0xc3,0xf1,0x7a,0x11,0x35,0x21,0xff,0x37,0xff,0xa0,0x7d,0x81,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x88,0x0,0xc,0x81,0x2e,0x8,0xe,0x8,0xd8,0xff,0xd6,0xb5,0x22,0x34,0x22,0xff,0x12,0xf6,0x20,0x3e,0x81,0x20,0x5,0x3e,0xa9,0x21,0xaf,0xa5,0xa4,0x81,0x61,0x6,0x60,0xff,0xae,0xf4,0x35,0xab,0x11,0xa2,0x6a,0x82,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x87,0x0,0xc,0x80,0xe,0x38,0x8,0xdc,0xc1,0xb3,0x8a,0x5e,0x22,0xff,0x96,0xf6,0xff,0x8f,0xf5,0x3e,0x82,0x20,0x5,0x3e,0xff,0x6d,0xf5,0xb2,0x7a,0xa5,0xa4,0x81,0x61,0x5,0x60,0xff,0x8e,0xf4,0xad,0x21,0x5e,0x72,0x83,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x86,0x0,0x5,0x18,0x1a,0xe,0x8,0x6b,0x3f,0x82,0x0,0x5,0x5a,0x21,0x11,0xff,0xf2,0xf5,0x20,0x3e,0x81,0x20,0xc,0x3e,0xa9,0x11,0x21,0xff,0x6a,0xf3,0x5f,0x60,0x5f,0xff,0xa2,0xf1,0xff,0xf3,0xfd,0x4b,0xff,0x92,0xd5,0x91,0x84,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x84,0x0,0x5,0x1,0x0,0xc9,0xd,0xe,0x6d,0x85,0x0,0x8,0x5a,0x34,0x4b,0xa8,0xff,0xa0,0xeb,0x3e,0x20,0xa7,0x11,0x81,0x4,0x7,0x34,0xff,0x2c,0xf4,0xff,0xa6,0xf2,0xff,0x69,0xf3,0xaf,0x21,0x5d,0x65,0x85,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x86,0x0,0x3,0x8e,0x8,0x2f,0x7f,0x86,0x0,0x6,0x91,0xff,0xd0,0xbc,0x21,0xff,0x74,0xfe,0xff,0xd0,0xfd,0xae,0x11,0x81,0x4,0x1,0x22,0x11,0x81,0x7b,0x2,0xad,0xff,0xaf,0xac,0xde,0x87,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x84,0x0,0x4,0x66,0xd3,0x2f,0x8,0x8c,0x84,0x0,0x2,0xbb,0xd6,0x63,0x81,0x0,0x2,0x72,0x5d,0xff,0xf4,0xdd,0x81,0x62,0x6,0x29,0x34,0x5e,0xa2,0xff,0xf0,0xc4,0xed,0xd5,0x89,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x82,0x0,0x1,0x4c,0x8d,0x81,0x8,0x2,0x2e,0x95,0xcb,0x83,0x0,0x4,0x36,0x2d,0x71,0x2d,0xba,0x82,0x0,0x6,0xb9,0xdb,0xe6,0xe5,0xda,0xc6,0x12,0x8c,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x81,0x0,0x15,0x4c,0x92,0x8,0x38,0xe,0x1b,0x92,0x67,0x0,0x1,0x0,0x36,0x8f,0x8,0x6f,0x8,0x8f,0x36,0x0,0x18,0x0,0x57,0x81,0x70,0x0,0xc2,0x82,0x0,0x0,0x1,0x8a,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x81,0x0,0x6,0x6d,0x8,0x38,0x43,0x68,0x7c,0x18,0x82,0x0,0x8,0x36,0x2d,0x8,0x2e,0x38,0x2e,0x8,0x2d,0x36,0x81,0x0,0x1,0x57,0x8,0x81,0x94,0x2,0x1a,0x87,0x54,0x8b,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x9,0x5,0x6,0x3,0x18,0x0,0x57,0x8,0xe,0x42,0xb4,0x84,0x0,0xd,0x36,0x2d,0x8,0x2f,0xe,0x2f,0xe,0x2f,0x8,0x58,0x36,0x0,0x84,0x95,0x81,0x8,0x3,0xe,0xd,0x42,0x63,0x8a,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0xa,0x5,0x6,0x3,0x1,0x0,0x6d,0x8,0x38,0x66,0x0,0x1,0x82,0x0,0x15,0x1,0x2d,0xd,0xe,0x6e,0x43,0xe,0x43,0x6e,0xe,0xd,0x2d,0x0,0x64,0x6c,0x6b,0x58,0xe,0x38,0x8,0x2d,0x18,0x89,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x7,0x5,0x6,0x3,0x0,0x54,0x1b,0x8,0x8e,0x86,0x0,0xa,0x85,0xd,0x2d,0x56,0x58,0xd,0x58,0x56,0x1a,0xd,0x85,0x84,0x0,0x4,0xbe,0x42,0x38,0xd,0x86,0x89,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x7,0x5,0x6,0x3,0x0,0xb5,0x2e,0xd,0x69,0x87,0x0,0x8,0x67,0x7c,0x0,0x42,0x8,0x42,0x0,0x4c,0x67,0x86,0x0,0x4,0xbd,0x2f,0xe,0x1a,0x1,0x88,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x7,0x5,0x6,0x3,0x0,0x4c,0x2e,0x8,0x6c,0x89,0x0,0x4,0x3f,0x1a,0x8,0x1a,0x3f,0x89,0x0,0x3,0x8d,0x8,0x1b,0x4c,0x88,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x8,0x5,0x6,0x3,0x0,0x3f,0x43,0xe,0x43,0x18,0x88,0x0,0x4,0x18,0x1a,0x8,0x1a,0x18,0x89,0x0,0x3,0x69,0xd,0x6f,0x56,0x88,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x8,0x5,0x6,0x3,0x1,0x0,0xd4,0x8,0xe,0xca,0x88,0x0,0x4,0x18,0x1a,0x8,0x1a,0x18,0x88,0x0,0x4,0x3f,0x6e,0xe,0x1b,0x54,0x88,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x6,0x5,0x6,0x3,0x18,0x0,0x66,0x8,0x81,0x2f,0x0,0x84,0x87,0x0,0x3,0x18,0x1a,0x8,0x1a,0x89,0x0,0x0,0x8b,0x81,0x8,0x0,0x6b,0x89,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x3,0x1,0x81,0x0,0x6,0xcd,0x71,0x2e,0x8,0x69,0x83,0xbc,0x82,0x2a,0x6,0x3f,0x0,0x18,0x1a,0x8,0x42,0x7f,0x86,0x2a,0x5,0x82,0x8c,0xe,0x2f,0x8,0x64,0x89,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x5,0x6,0x2b,0x1,0x82,0x0,0x5,0xd2,0xd,0xe,0x8,0xe,0x2e,0x81,0x1b,0x1,0x2e,0x80,0x81,0x0,0x2,0xd7,0x8,0x6f,0x87,0x1b,0x4,0xe,0x8,0xe,0xd,0x86,0x8a,0x0,0x0,0x1,0x81,0x3,0x0,0x1,0x8d,0x0,0x3,0x5,0x6,0x14,0xf,0x83,0x0,0x2,0x68,0x1a,0xe,0x83,0xd,0x1,0x71,0x64,0x81,0x0,0x1,0x83,0x8,0x89,0xd,0x2,0x8,0x43,0x68,0x8b,0x0,0x3,0x1,0x1f,0x3,0x1,0x8d,0x0,0x3,0x5,0x1d,0x2,0x19,0x84,0x0,0x3,0x18,0x82,0xcc,0xd1,0x82,0x24,0x0,0x63,0x82,0x0,0x1,0xbf,0x8b,0x87,0x24,0x2,0x87,0x57,0x54,0x8c,0x0,0x3,0x13,0x2,0x27,0x1,0x8e,0x0,0x4,0x31,0x2,0xa,0x0,0x1,0xa5,0x0,0x4,0x1,0x0,0x3a,0x2,0x48,0x8f,0x0,0x3,0x59,0x2,0x1f,0x1e,0x84,0x0,0x85,0x1,0x83,0x0,0x8b,0x1,0x8c,0x0,0x3,0x1e,0x1f,0x2,0xa,0x90,0x0,0x3,0x49,0x2,0x1f,0x44,0xa5,0x0,0x3,0x44,0x1f,0x2,0x48,0x91,0x0,0x1,0x10,0x3d,0x81,0x2,0x1,0x3,0x51,0xa1,0xc,0x1,0x47,0x3,0x81,0x2,0x1,0x4a,0x5,0x92,0x0,0x2,0x1,0x7,0x14,0xa5,0x2,0x2,0x14,0x7,0x1,0x95,0x0,0x2,0xf,0x37,0x39,0xa1,0x9,0x2,0x39,0x37,0xf,0xff,0x14,0x2,0x0,0x1,0x12,0xf,0x8f,0x0,0x1,0x12,0x1,0xa5,0x0,0x9,0x37,0x47,0x9f,0xc,0x40,0x0,0xb,0x44,0x0,0x1,0x8c,0x0,0x2,0x19,0x1f,0x25,0x82,0x0,0x4,0xf,0x75,0x3d,0x49,0x9,0x9c,0x0,0x8,0x41,0x2,0x49,0x5b,0x3,0x31,0x0,0x28,0x3a,0x81,0x0,0x1,0x12,0x13,0x81,0x0,0x1,0x1,0x10,0x81,0x0,0x7,0x10,0x1,0x0,0x1,0x19,0x13,0x15,0x4e,0x82,0x0,0x8,0x52,0x28,0x26,0x32,0x6,0x1e,0x0,0x40,0x1e,0x81,0x0,0x3,0x1,0x5,0x0,0x2c,0x81,0x0,0x0,0x12,0x82,0x0,0x0,0x12,0x81,0x0,0x1,0x2c,0x19,0x82,0x0,0x1,0x1e,0x19,0x82,0x0,0x1,0xc,0x3,0x81,0x0,0x6,0x10,0x1e,0x0,0x1f,0x3a,0x0,0x7,0x81,0x1d,0xd,0x31,0x0,0x93,0x28,0x5,0x10,0x28,0x25,0x10,0x2b,0x1d,0x3d,0x15,0x25,0x81,0x0,0x2,0x4e,0x2,0x25,0x81,0x0,0x1b,0x25,0x0,0x46,0x14,0x3,0x31,0x0,0x9,0x14,0x48,0x6,0x4a,0x1,0x33,0x46,0x0,0x30,0xb,0x2c,0x52,0x2b,0x14,0x5b,0x0,0x32,0x27,0x14,0x3a,0x81,0x0,0x3,0x52,0x51,0x0,0xf,0x81,0x0,0x14,0x1,0x28,0x30,0x40,0x2,0x30,0x10,0x6,0x26,0x37,0x2,0x10,0x12,0x2,0x41,0x75,0x1d,0x5,0x45,0x2,0x37,0x81,0x0,0x4,0xa,0x6,0x5,0x0,0x1,0x81,0x0,0x19,0x4f,0x25,0x3a,0x2,0x19,0x39,0x2,0x9,0x41,0x2,0x1e,0x3b,0xb,0x0,0x48,0x47,0x0,0x3a,0x19,0x52,0x9f,0x5,0x2,0x5c,0x41,0x12,0x81,0x0,0x1,0x48,0x4a,0x81,0x0,0x6,0x1,0x2c,0x1,0x28,0x9,0x73,0x6,0x81,0x0,0x7,0x48,0x32,0x25,0x15,0x1,0x5,0x15,0x37,0x81,0x51,0x3,0x0,0x12,0x15,0x25,0x81,0x0,0x2,0x4f,0x2,0x40,0x81,0x0,0x1b,0x2c,0x1,0xa,0x31,0x32,0x1d,0x13,0x39,0x15,0x0,0xf,0x15,0x93,0x40,0x15,0x39,0x14,0x9,0x0,0xc,0x51,0x3d,0x4a,0x0,0xa,0x2b,0x3,0x30,0x81,0x0,0x1a,0x30,0x2,0xa,0x5,0xc,0x2b,0x1,0x1d,0x5b,0x40,0x2,0xa,0x12,0x6,0x26,0x1e,0x2,0x41,0x44,0x2,0x1e,0x75,0x1d,0x10,0x26,0x2,0x25,0x81,0x0,0x20,0xf,0x28,0x47,0x12,0x4f,0x15,0x4f,0x6,0x45,0x37,0x2,0x41,0x9,0x6,0xf,0x10,0x6,0x9,0x0,0x31,0x15,0x33,0x0,0x3a,0x2,0xf,0x3c,0x2b,0x10,0xa,0x5,0x47,0xb,0x82,0x0,0x9,0x7,0x1d,0x28,0x14,0x9,0x0,0x32,0x1d,0x5,0x26,0x81,0x1d,0x30,0x49,0xf,0x1,0x4a,0x15,0x47,0x14,0x25,0x10,0x27,0x1d,0x49,0x14,0x25,0x0,0x1,0x0,0x4e,0x2b,0x28,0x15,0x76,0x0,0x3c,0x1f,0x32,0x33,0x9d,0x39,0x14,0x1,0x5,0x1f,0x39,0x0,0x44,0x2,0x7,0x0,0x1e,0x2b,0x33,0x3c,0x1f,0x5c,0x31,0x14,0xb,0x74,0x83,0x0,0x1,0x5,0x13,0x83,0x0,0x4,0x19,0x1,0x0,0x10,0x19,0x83,0x0,0x8,0x19,0x0,0xf,0x1,0x0,0x1,0x19,0x0,0xf,0x85,0x0,0x1,0x19,0x10,0x82,0x0,0x5,0x13,0x1,0x0,0x10,0x0,0x5,0x81,0x0,0x0,0x5,0x82,0x0,0x0,0xf,0x82,0x0,0x7,0x5,0x13,0x0,0x5,0x1,0x0,0x13,0x12,0xff,0x1b,0x1,0x0,0x81,0x1e,0x88,0x0,0x0,0x1,0xb2,0x0,0x0,0x19,0x81,0x15,0x0,0x19,0xbb,0x0,0x10,0x5c,0xb,0x1f,0x26,0x0,0x5,0x3b,0x30,0x32,0x3b,0x0,0xf,0x3b,0x30,0x32,0x3b,0x1,0xae,0x0,0x10,0x33,0x45,0x3b,0x33,0x0,0x12,0x2,0x27,0x76,0x2,0x7,0x1,0x2,0x27,0x76,0x2,0x46,0xad,0x0,0x11,0x2c,0x2,0x44,0x74,0x2,0x13,0xf,0x6,0x59,0x0,0x50,0x33,0xf,0x15,0x59,0x0,0x50,0x27,0xab,0x0,0x3,0x1,0x0,0x26,0x2,0x81,0xb,0xd,0x2,0x5b,0x0,0x2,0x30,0x0,0xc,0x33,0xf,0x6,0x30,0x0,0x50,0x27,0xad,0x0,0x1,0x1f,0xc,0x81,0x0,0xd,0x9d,0x14,0x10,0x6,0x27,0x50,0x2,0x5c,0x0,0x2,0x27,0x50,0x2,0x3b,0xac,0x0,0x2,0x5,0x46,0x2c,0x81,0x0,0xc,0x1e,0x7,0x13,0x14,0x7,0x3c,0x26,0x0,0x10,0x1f,0x7,0x3c,0x26,0xb4,0x0,0x2,0x10,0x2,0x73,0x82,0x0,0x2,0x12,0x2,0x73,0xb0,0x0,0x0,0x1,0x84,0x0,0xa,0xf,0x46,0x2c,0x0,0x1,0x0,0xf,0x46,0x2c,0x0,0x1,0xff,0x98,0x1,0x0};
+constexpr bitmap_asset_t main_app_bmp2 {64, 92, main_app_bmp2_palette, main_app_bmp2_data, 2538};
+
+const uint16_t settings_app_bmp_palette[] PROGMEM = {0x0,0x20,0xffff,0xdefb,0x861,0x7bef,0x5aeb,0x9cd3,0xffdf,0x3199,0x4a49,0xe71c,0x413,0x3f3,0xfeca,0x434,0x39bb,0x412,0xff0b,0x1082,0x2104,0xfeeb,0xff6b,0x10a2,0xf79e,0x841,0x31b9,0x39e7,0xe73c,0xff2b,0xff4b,0x18c3,0x319a,0x31a6,0x31ba,0xef5d,0xef7d,0x52aa,0x7bcf,0x41,0x3f2,0x3198,0xb5b6,0xf7be,0x21,0x187,0x3d2,0x3d3,0x18e3,0x2945,0x2996,0x6b6d,0xad75,0xb596,0x64,0x3b3,0x10ea,0x2124,0x4228,0x528a,0x5acb,0x738e,0x8c71,0xa534,0xad55,0xce79,0xd6ba,0xdedb,0x26b,0x454,0x885,0xb74,0x9cf3,0xa514,0xbdd7,0xcdea,0x433,0x1396,0x1950,0x31b8,0x31bb,0x630c,0x73ae,0x8410,0x9492,0xbdf7,0xc638,0xd69a,0x42,0x30e,0x3f4,0xb95,0x10eb,0x29b6,0x31da,0x39c7,0x4a69,0x5285,0x6530,0x8430,0xd60a,0xf6cb,0xff0a,0xff4c,0x40,0xc3,0xe4,0x22a,0x28c,0x32f,0x453,0x886,0x192f,0x2122,0x2142,0x2965,0x2983,0x29b7,0x3186,0x31db,0x39ba,0x4208,0x5ae5,0x632c,0x6510,0x6b4d,0x9468,0x94b2,0xc618,0xcdca,0xce59,0xf6aa,0xfeea,0x43,0x104,0x28b,0x370,0x414,0x820,0x8a7,0x8c8,0xb54,0xb96,0x10c9,0x10ca,0x18cc,0x190d,0x192e,0x1930,0x2163,0x2172,0x2173,0x2194,0x2995,0x2997,0x31a3,0x4224,0x4a64,0x5ac5,0x5cef,0x7590,0x75b1,0x7ba7,0x9c68,0x9c88,0xe64a,0xee8b,0xeeab,0xf6ab,0xfecb,0xff8c,0x1,0x61,0x62,0x83,0x85,0x126,0x146,0x147,0x166,0x167,0x1a7,0x1c8,0x1ec,0x20a,0x20c,0x229,0x26c,0x2ac,0x2ad,0x2cd,0x2f0,0x350,0x390,0x391,0x415,0x432,0x435,0x474,0x840,0x865,0x881,0x8a1,0x8a6,0x8a8,0x8c7,0x8c9,0x8e9,0xa8f,0xb73,0xb75,0xb94,0xbb5,0x10a1,0x10c1,0x10ec,0x110b,0x110c,0x1376,0x18a0,0x18ed,0x1902,0x190e,0x190f,0x1951,0x19e6,0x2143,0x2151,0x2174,0x234c,0x2921,0x2963,0x3162,0x3183,0x31c3,0x32ea,0x399a,0x39c3,0x39db,0x39dc,0x39e3,0x3a04,0x3b09,0x3c2f,0x52a5,0x53ec,0x5aa5,0x5ae6,0x5d30,0x5d31,0x5d51,0x62e5,0x6305,0x6550,0x6571};
+const uint8_t settings_app_bmp_data[] PROGMEM = {0xff,0xd,0x1,0x0,0xa5,0x1,0xd8,0x0,0x1,0x5f,0x3d,0xa3,0x5,0x1,0x3d,0x5f,0x95,0x0,0x1,0x14,0x4a,0xa7,0x2,0x1,0x4a,0x14,0x92,0x0,0x5,0x14,0xb,0x2,0x24,0x48,0x33,0xa1,0x6,0x5,0x33,0x48,0x24,0x2,0xb,0x14,0x90,0x0,0x4,0x1,0x56,0x2,0x55,0x14,0xa5,0x0,0x3,0x14,0x80,0x2,0x56,0x90,0x0,0x4,0x33,0x2,0x42,0x19,0x0,0x81,0x1,0x8a,0x0,0x8a,0x1,0x8b,0x0,0x81,0x1,0x4,0x0,0x19,0x42,0x2,0x7b,0x8f,0x0,0x4,0x56,0x2,0x60,0x0,0x1,0xa5,0x0,0x4,0x1,0x0,0x3b,0x2,0x2a,0x8e,0x0,0x3,0x4,0x18,0x2b,0x17,0x8e,0x0,0x2,0xc7,0xeb,0xbb,0x85,0x44,0x1,0x87,0xb9,0x8f,0x0,0x3,0x17,0x8,0x43,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x8e,0x0,0x3,0xe8,0xfa,0xc3,0x45,0x84,0xf,0x2,0x45,0xd4,0x36,0x8e,0x0,0x3,0x1,0x1c,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x43,0x1,0x8e,0x0,0x4,0x9d,0x62,0x37,0x28,0xd,0x81,0xc,0x4,0xd,0x28,0x11,0x5b,0x8c,0x8e,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x8e,0x0,0x3,0xff,0x5,0x6b,0xff,0x91,0x6d,0x37,0xc,0x83,0x2e,0x3,0xd,0x11,0x8e,0x5c,0x8e,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x8c,0x0,0x6,0x1,0x0,0xff,0x85,0x83,0xa1,0x37,0x11,0x6a,0x81,0x0,0x4,0x6a,0xd,0x11,0x4d,0x91,0x8e,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x86,0x0,0x2,0x7a,0xff,0xc8,0xa4,0xe9,0x84,0x0,0x4,0xff,0x87,0xa4,0xa0,0x2f,0x2e,0x27,0x81,0x0,0x4,0x2c,0x2e,0xc4,0xda,0x94,0x84,0x0,0x2,0x6f,0x96,0x38,0x86,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x85,0x0,0x5,0xca,0xff,0x6b,0xe6,0xff,0x8b,0xff,0x12,0xff,0x69,0xbd,0xf6,0x81,0x27,0x4,0xa2,0xe,0x7c,0x5a,0x88,0x83,0x0,0x4,0x88,0x4c,0x47,0x4f,0x93,0x81,0x2c,0x5,0x90,0xe4,0x22,0x10,0x75,0x58,0x85,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x85,0x0,0xc,0xff,0x27,0x8c,0x16,0x83,0xe,0x1d,0x16,0x64,0x4b,0x16,0x66,0x9f,0x89,0x59,0x83,0x0,0x4,0x59,0x6e,0x8d,0x9,0x10,0x81,0x32,0x5,0x10,0x22,0x9,0x29,0x10,0x70,0x85,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x84,0x0,0x1,0x74,0x12,0x81,0x15,0x9,0x12,0x15,0xff,0xaa,0xfe,0x12,0x1d,0x83,0x66,0xfe,0x5a,0xba,0x83,0x0,0x4,0xb8,0x6e,0x5b,0x9,0x29,0x81,0x20,0x2,0x29,0x9,0x20,0x81,0x9,0x1,0x1a,0x46,0x84,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x84,0x0,0xc,0xff,0x29,0xb5,0x1e,0xe,0x12,0x4b,0xa8,0x16,0x12,0xe,0x1d,0x65,0xf2,0xae,0x85,0x0,0x8,0x69,0xb7,0x1a,0x20,0x29,0x9,0x10,0x1a,0x5d,0x81,0x9,0x1,0x78,0x97,0x84,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x83,0x0,0xb,0x9d,0x67,0xe,0x1d,0x64,0x27,0x71,0xff,0xe7,0x83,0xa5,0xff,0x6c,0xff,0x81,0x71,0x89,0x0,0xb,0xaf,0x32,0x10,0x9a,0x70,0x36,0x27,0x32,0x20,0x9,0x50,0xce,0x83,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x82,0x0,0x5,0x27,0x64,0x1d,0xe,0x1d,0x61,0x82,0x0,0x4,0xc9,0x9e,0xd5,0x0,0x1,0x89,0x0,0x2,0x85,0x38,0x58,0x82,0x0,0x5,0x90,0x22,0x9,0x20,0x32,0x2c,0x82,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x82,0x0,0x4,0xa2,0x1e,0xe,0x1d,0x4b,0x81,0x0,0x0,0x1,0x83,0x0,0x0,0x1,0x81,0x0,0x1,0xb1,0x6c,0x81,0x6d,0x1,0xbc,0xb4,0x89,0x0,0x4,0x5d,0x20,0x9,0x50,0x92,0x82,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x81,0x0,0x3,0x68,0xff,0x4b,0xde,0x1e,0xe,0x81,0x15,0x1,0x7e,0x1,0x85,0x0,0x1,0xad,0x59,0x81,0xf,0x81,0x4c,0x81,0xf,0x1,0xc0,0x69,0x85,0x0,0x2,0x2c,0x4e,0x1a,0x81,0x9,0x2,0x10,0x75,0x2c,0x81,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x82,0x0,0x7,0xe7,0x81,0x16,0xe,0x15,0x16,0x81,0x72,0x83,0x0,0x2,0xdb,0xf3,0xf,0x81,0x28,0x81,0xd,0x81,0x28,0x2,0x6e,0xd1,0x36,0x83,0x0,0x2,0x46,0x32,0x10,0x81,0x9,0x2,0x10,0x99,0x46,0x82,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x83,0x0,0xd,0x68,0x7e,0x67,0x12,0xe,0x1d,0x15,0xf0,0x0,0x1,0x0,0xff,0x27,0x94,0xa1,0x37,0x81,0xc,0x83,0xd,0x2,0x11,0x4d,0x97,0x82,0x0,0x2,0x8b,0x5e,0x20,0x81,0x9,0x2,0x50,0x4e,0x1,0x83,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x85,0x0,0x5,0x7a,0xa8,0x15,0xe,0x1e,0x61,0x81,0x0,0x5,0x4,0xff,0x8a,0xf6,0x62,0x2f,0xc,0xd,0x81,0xc,0x81,0xd,0x3,0x11,0x47,0x1a,0x46,0x81,0x0,0x1,0x38,0x77,0x81,0x9,0x1,0x4f,0x5c,0x85,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x86,0x0,0x4,0xff,0xc6,0x83,0x16,0xe,0xa9,0x95,0x81,0x0,0x3,0x74,0x66,0x7c,0x2f,0x84,0xc,0x4,0xd,0x11,0x47,0x5e,0x38,0x81,0x0,0x4,0x46,0x1a,0x9,0x10,0xdc,0x86,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x84,0x0,0x6,0x1,0x0,0xff,0x85,0x7b,0x16,0xe,0x65,0xdd,0x81,0x0,0x3,0xf1,0x1d,0x7c,0x2f,0x84,0xc,0x4,0xd,0x11,0x47,0x77,0x5c,0x81,0x0,0x4,0x36,0x1a,0x9,0x10,0x91,0x86,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x86,0x0,0x4,0xff,0x47,0x9c,0x1e,0xe,0xa9,0x74,0x81,0x0,0x3,0x72,0x66,0x62,0x2f,0x84,0xc,0x4,0xd,0x11,0x47,0x22,0xcf,0x81,0x0,0x4,0xcb,0x1a,0x9,0x10,0xdf,0x86,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x84,0x0,0x6,0x1,0xa3,0x12,0x15,0xe,0xaa,0xf7,0x82,0x0,0x4,0xff,0xa,0xde,0xff,0x50,0x6d,0x2f,0xc,0xd,0x81,0xc,0x81,0xd,0x3,0x11,0x47,0x4f,0x58,0x81,0x0,0x5,0xd8,0xee,0x29,0x9,0x22,0x4e,0x85,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x83,0x0,0x2,0xe2,0x4b,0x16,0x81,0xe,0x8,0x16,0x4b,0x72,0x0,0x1,0x0,0xff,0x25,0x6b,0xff,0xb1,0x6d,0x37,0x81,0xc,0x81,0xd,0x4,0xc,0xd,0x11,0x4d,0x4e,0x82,0x0,0x2,0xc8,0x32,0x10,0x81,0x9,0x2,0x10,0x99,0x36,0x83,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x82,0x0,0x7,0x7a,0x65,0x1d,0xe,0x12,0x67,0x7e,0x1,0x83,0x0,0x4,0x8a,0xe5,0xf,0xc,0x28,0x81,0xd,0x4,0x28,0xd,0x45,0xbf,0xab,0x83,0x0,0x2,0x2c,0x4e,0x77,0x81,0x9,0x2,0x22,0x1a,0x8f,0x82,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x81,0x0,0x6,0x68,0xff,0x4b,0xe6,0x1d,0xe,0x15,0xa7,0x9e,0x87,0x0,0x2,0x6b,0xc,0x45,0x81,0xf,0x3,0x45,0xc,0x6c,0x1,0x86,0x0,0x1,0x38,0x4f,0x81,0x9,0x1,0xec,0x5d,0x82,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x82,0x0,0x4,0x61,0x1e,0xe,0x12,0x64,0x81,0x0,0x0,0x1,0x83,0x0,0x0,0x1,0x81,0x0,0x5,0x69,0x6b,0xbd,0xbe,0x6b,0x6a,0x88,0x0,0x5,0x1,0x5d,0x20,0x9,0x22,0xcc,0x82,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x83,0x0,0x4,0xff,0x49,0xbd,0x1e,0xe,0x16,0xff,0x86,0x73,0x82,0x0,0x2,0xea,0xa4,0x9b,0x8b,0x0,0x2,0x8b,0xe0,0x6f,0x82,0x0,0x4,0x92,0x10,0x29,0x78,0x96,0x83,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x83,0x0,0xb,0x9b,0x12,0x84,0x12,0xa6,0x95,0x61,0xff,0x89,0xc5,0x12,0x16,0xa7,0xf4,0x89,0x0,0x7,0xd9,0x22,0x10,0x22,0x98,0x8f,0x46,0x4f,0x81,0x9,0x1,0x1a,0x36,0x83,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x84,0x0,0xd,0xff,0x47,0x94,0x16,0xe,0x15,0x65,0x1e,0x1d,0xe,0x83,0x12,0x1e,0xf5,0xb0,0x27,0x83,0x0,0x6,0x27,0xb3,0xd0,0x5e,0x9,0x29,0x9,0x81,0x22,0x0,0x1a,0x81,0x9,0x1,0x10,0x93,0x84,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x84,0x0,0x2,0xd6,0xa6,0x12,0x81,0x15,0x1,0xe,0x84,0x81,0x1e,0x4,0xe,0x84,0xfd,0xc5,0x87,0x83,0x0,0x2,0x6c,0xc6,0x5b,0x81,0x9,0x3,0x50,0x78,0x9,0x29,0x81,0x9,0x2,0x20,0x75,0x58,0x84,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x85,0x0,0xc,0xff,0x26,0x6b,0x1e,0xe,0x12,0x16,0x15,0xa4,0xa3,0x67,0xff,0x2a,0xff,0x9f,0x5a,0x59,0x83,0x0,0xc,0x6d,0x4c,0x8d,0x20,0x5e,0x94,0xe3,0x1a,0x10,0x9,0x29,0x50,0x38,0x85,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x86,0x0,0x4,0x4b,0xaa,0xff,0x2a,0xde,0xff,0xc7,0x83,0x71,0x81,0x0,0x5,0x9c,0xa5,0x62,0x5a,0xc1,0x1,0x81,0x0,0x5,0x1,0xc2,0x4c,0xd2,0x32,0x8c,0x81,0x0,0x4,0x36,0x70,0x9a,0xef,0x98,0x86,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x86,0x0,0x2,0xed,0xfc,0xac,0x82,0x0,0x6,0x1,0x0,0xff,0x26,0x94,0xa0,0x2f,0x2e,0x1,0x81,0x0,0x4,0x27,0x2e,0x11,0x4d,0xde,0x84,0x0,0x2,0x2c,0x5c,0x6f,0x86,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x8c,0x0,0x6,0x1,0x0,0xff,0x65,0x83,0xff,0x91,0x75,0x37,0x11,0xb5,0x81,0x86,0x4,0xb6,0xd,0x11,0x4d,0xd7,0x8e,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x3,0x1,0x8e,0x0,0x2,0xfb,0xff,0x71,0x6d,0x37,0x84,0xc,0x3,0xd,0x11,0x8e,0x38,0x8e,0x0,0x3,0x1,0xb,0x3,0x1,0x8d,0x0,0x3,0x4,0x8,0x43,0x1,0x8e,0x0,0x3,0x9c,0xf8,0x2f,0x28,0x84,0xd,0x2,0x11,0x5b,0xcd,0x8e,0x0,0x0,0x1,0x81,0x3,0x0,0x1,0x8d,0x0,0x3,0x4,0x8,0x1c,0x19,0x8e,0x0,0x2,0xe6,0xf9,0x89,0x85,0xf,0x2,0x45,0xd3,0x85,0x8e,0x0,0x3,0x1,0x23,0x3,0x1,0x8d,0x0,0x3,0x4,0x18,0x2,0x30,0x8e,0x0,0x1,0x8a,0xe1,0x87,0x2d,0x0,0xb2,0x8f,0x0,0x3,0x14,0x2,0x42,0x1,0x8e,0x0,0x4,0x4a,0x2,0x6,0x0,0x1,0xa5,0x0,0x4,0x1,0x0,0x51,0x2,0x35,0x8f,0x0,0x3,0x3b,0x2,0x23,0x31,0x8e,0x0,0x89,0x1,0x8e,0x0,0x3,0x31,0x23,0x2,0x6,0x90,0x0,0x3,0x2a,0x2,0x23,0x3c,0xa5,0x0,0x3,0x3c,0x23,0x2,0x35,0x91,0x0,0x1,0x13,0x56,0x81,0x2,0x1,0x3,0x40,0xa1,0x7,0x1,0x34,0x3,0x81,0x2,0x1,0x80,0x4,0x92,0x0,0x2,0x1,0x5,0x1c,0xa5,0x2,0x2,0x1c,0x5,0x1,0x95,0x0,0x2,0x19,0x76,0x3a,0xa1,0xa,0x2,0x3a,0x76,0x19,0xff,0x2f,0x2,0x0,0x1,0x13,0x1,0xab,0x0,0x4,0x52,0x35,0x2a,0x49,0x1b,0x8b,0x0,0x4,0x1,0x23,0x7d,0x0,0x1,0xa9,0x0,0x5,0x57,0x3,0x3d,0x2a,0x2,0x25,0x81,0x0,0x4,0x4,0x73,0x1,0x0,0x17,0x82,0x0,0x3,0x13,0x1,0x6,0x31,0x81,0x0,0x1,0x14,0x1f,0x82,0x0,0x1,0x1f,0x31,0xa2,0x0,0x1,0x41,0x3e,0x81,0x0,0x19,0x40,0x3,0x0,0xa,0x3,0x42,0x41,0x30,0x82,0x53,0x0,0x3b,0xb,0x17,0x82,0x6,0x0,0x34,0x18,0x2b,0x3e,0x0,0x5,0x3,0x43,0x34,0xa1,0x0,0x1,0x41,0x7,0x81,0x0,0x1a,0x7d,0x2b,0x19,0x1c,0x49,0x17,0x18,0x63,0x3d,0xb,0x0,0x35,0x34,0x0,0x18,0x3c,0x25,0x2,0x14,0x1b,0x6,0x39,0x2,0x51,0x21,0x2,0x3b,0xa0,0x0,0x1,0x41,0x54,0x81,0x0,0x11,0x63,0x1c,0x17,0x2b,0x55,0x49,0x2a,0x6,0x1f,0x2b,0x3a,0x1c,0xa,0x0,0x23,0x60,0x63,0x41,0x82,0x0,0x1,0x3b,0x2,0x81,0x3f,0x1,0x34,0x1b,0xa0,0x0,0x1e,0x41,0x34,0x17,0x25,0x2,0x3e,0x0,0x23,0x7,0x0,0x3d,0x21,0x0,0x4a,0x2b,0x57,0x1,0x0,0x24,0x25,0x3b,0x2,0x39,0xa,0x7f,0x31,0x2,0x3c,0x17,0x26,0x13,0xa0,0x0,0x15,0x35,0x8,0x1c,0x23,0x54,0x19,0x0,0xa,0x1c,0x23,0x3,0x21,0x0,0x25,0x2,0x5,0x0,0x1,0x43,0x51,0x0,0x3f,0x81,0x18,0x2,0x53,0x0,0x26,0x81,0x24,0x1,0x55,0x4,0xa0,0x0,0x0,0x19,0x81,0x4,0x0,0x1,0x83,0x0,0x1,0x1,0x14,0x83,0x0,0x0,0x19,0x82,0x0,0x1,0x4,0x1,0x81,0x0,0x1,0x1f,0x13,0x82,0x0,0x1,0x13,0x14,0xff,0x21,0x1,0x0,0x2,0x1b,0xa,0x13,0x88,0x0,0x0,0x1,0x83,0x0,0x4,0x13,0x54,0x31,0x0,0x1,0x85,0x0,0x0,0x1,0xa0,0x0,0x5,0x19,0x55,0x24,0x1c,0x24,0x39,0x85,0x0,0x1,0x3b,0x33,0x81,0x0,0x5,0x7d,0x3c,0x0,0x1f,0x80,0x1b,0x88,0x0,0x1,0x19,0x39,0x9e,0x0,0x1a,0xa,0x2,0x14,0x0,0x79,0x13,0x0,0x1b,0x3f,0x48,0x1f,0x31,0x24,0x18,0x63,0x6,0x8,0xb,0x53,0x13,0x26,0x1f,0x39,0x52,0x3c,0x40,0x25,0x81,0x0,0x8,0x33,0x7,0x4a,0x5,0x0,0x33,0x34,0x5,0x19,0x99,0x0,0x25,0x30,0x24,0x57,0x53,0x31,0x0,0x21,0x18,0x52,0x40,0x41,0x73,0x42,0xb,0x26,0x25,0x1c,0x57,0x52,0x30,0x2,0x1b,0x3a,0x2,0x3f,0x40,0x2,0x13,0x6,0x18,0x6,0x24,0x1b,0x25,0x8,0x33,0x7,0x1f,0x9a,0x0,0xc,0x30,0x7,0x3,0x2,0x21,0x26,0x2,0x3d,0x7,0x2,0x0,0x54,0x2a,0x81,0x0,0x14,0x4a,0x54,0x0,0x17,0x2b,0x21,0x79,0x2,0x1,0x0,0x8,0x21,0x51,0x43,0x39,0x24,0x7b,0x5f,0x18,0x48,0x3a,0x9a,0x0,0x1,0x1f,0x1b,0x81,0x0,0x3,0x1c,0x3e,0x3d,0x2b,0x81,0x60,0x3,0x3c,0x0,0x3f,0x2a,0x81,0x0,0xf,0x56,0x7f,0x0,0x17,0x2b,0x21,0x79,0x18,0x1,0x13,0x18,0x1b,0x1f,0x42,0x35,0x52,0x81,0x0,0x3,0x21,0x53,0x2,0x6,0x99,0x0,0x25,0x3a,0x2,0x55,0x40,0x2,0x25,0x39,0x8,0x7,0x49,0x35,0x0,0x26,0x2,0x49,0x4,0x7f,0x8,0xff,0x51,0x8c,0x14,0x2,0x1b,0xa,0x2,0x1,0x13,0x2,0x5f,0x3a,0x8,0x48,0x5,0x17,0x7b,0x82,0x33,0x8,0x6,0x9a,0x0,0x3,0x1b,0x7,0x3f,0x25,0x81,0x0,0x9,0x21,0x49,0x48,0x76,0x0,0x4,0x5,0x7,0x17,0x13,0x81,0x3e,0x11,0x17,0x26,0x30,0x14,0x26,0x0,0x1,0x26,0x30,0x5,0x2a,0x5,0x57,0x43,0x1f,0x26,0x34,0x51,0xb6,0x0,0x4,0x23,0x35,0x21,0x2a,0x42,0xa0,0x0,0x0,0x1,0x84,0x0,0x81,0x1,0x83,0x0,0x0,0x1,0x81,0x0,0x0,0x1,0x81,0x0,0x0,0x1,0x81,0x0,0x0,0x1,0x81,0x0,0x8,0x1,0x0,0x73,0x7,0x40,0x3e,0x30,0x0,0x1,0xff,0x90,0x1,0x0};
+constexpr bitmap_asset_t settings_app_bmp {64, 92, settings_app_bmp_palette, settings_app_bmp_data, 2453};
+
+const uint16_t information_app_bmp_palette[] PROGMEM = {0x0,0xffff,0x20,0xb74,0x29f8,0x1335,0x2277,0x2257,0x2a18,0xb94,0xfeeb,0x2a38,0x1315,0x1355,0xbb4,0x7bef,0x3b3,0x31f9,0x8410,0x3b4,0x29d8,0xb54,0x6b4f,0x392,0x2158,0xbd3,0x2297,0x841b,0x6578,0x2238,0x2237,0xff2a,0x1ab6,0x1af6,0x1ad6,0xff0a,0x3a2a,0xfecb,0x12f5,0xf79e,0x12f6,0x1a96,0x22b6,0x4a49,0x10a2,0x738e,0x8c51,0xf7be,0x1082,0x2945,0xdedb,0x8c71,0xce59,0xce79,0xdefb,0xffdf,0x12b6,0x18c3,0x7bcf,0xa514,0xad75,0xe73c,0x861,0x1277,0x1b15,0x39e7,0x3a0a,0x4228,0x528a,0x52aa,0x6b4d,0xa61b,0xadbc,0xaddc,0x353,0xb15,0x22d6,0x3186,0x4208,0x5aeb,0x630c,0x8430,0x9492,0x94b2,0x9cd3,0xa63b,0xad55,0xb5b6,0xef7d,0x2f4,0x314,0x841,0xa95,0xbd4,0x19d7,0x2104,0x2965,0x3a49,0x4a69,0x632c,0x73ae,0xa534,0xa5fc,0xbdf7,0xd69a,0xef5d,0xa97,0xad6,0x1236,0x1257,0x18e3,0x1a57,0x1a97,0x31a6,0x39c7,0x5acb,0x6518,0x6b6d,0x6cb9,0x6cd9,0x6cf8,0x745a,0x747a,0x7499,0x7c3a,0x9cf3,0xb596,0xd6ba,0xde4c,0xe71c,0xf6cb,0x21,0x2b6,0x2f6,0xa57,0xab5,0x1256,0x1276,0x1296,0x1297,0x1375,0x1a17,0x1b16,0x1b35,0x2296,0x22b7,0x2a58,0x3a4a,0xf6ab,0xff4a,0x2b5,0x2d4,0x2d6,0x333,0x334,0x373,0x3d3,0xa56,0xa75,0xa77,0xab6,0xad5,0x11f7,0x1216,0x1998,0x19b7,0x19f7,0x1a38,0x1a77,0x1af5,0x2124,0x21b8,0x29b8,0x2a77,0x422a,0x5bd3,0x5bf3,0x6538,0x6577,0x6c91,0x7452,0x7598,0x8c7b,0x8cd0,0x9510,0xa52f,0xad6f,0xad8e,0xb58e,0xbdd7,0xc5ce,0xc638,0xce0d,0xe66c,0xfeea,0x41,0x372,0x393,0x862,0x882,0xaf6,0xb35,0xb55,0x1218,0x1237,0x12d6,0x1374,0x1394,0x1414,0x18e4,0x1904,0x1938,0x1b55,0x1c35,0x2178,0x2198,0x21d8,0x2315,0x2355,0x2978,0x29b9,0x2a57,0x2af6,0x2b35,0x2b74,0x31c9,0x31d9,0x31e8,0x31f8,0x3218,0x32f5,0x3315,0x3394,0x39e9,0x3a28,0x3a29,0x3a39,0x3b54,0x3b55,0x3b94,0x3bd3,0x420a,0x426a,0x4279,0x42aa,0x4315,0x4374,0x43f3,0x4a6c,0x4b94,0x4bb4,0x4bd3,0x528b,0x52ec,0x530c};
+const uint8_t information_app_bmp_data[] PROGMEM = {0xff,0xcb,0x1,0x0,0x1,0xd2,0xe3,0x84,0x61,0x82,0x93,0x92,0x24,0x85,0x42,0x3,0xf1,0x42,0xe1,0xd1,0x96,0x0,0x2,0xea,0xff,0x39,0xbe,0x37,0xa4,0x1,0x2,0x37,0xff,0x19,0xc6,0xe9,0x93,0x0,0x0,0xff,0x6d,0x63,0x81,0x1,0x3,0xff,0xdf,0xf7,0xff,0xfd,0xc6,0xff,0x5b,0xa6,0xff,0x3b,0x9e,0x85,0x55,0x86,0x47,0x0,0xff,0xfb,0xa5,0x84,0x66,0x86,0x49,0x86,0x48,0x1,0xff,0x9e,0xce,0xff,0xbf,0xf7,0x81,0x1,0x0,0xff,0x6f,0x6b,0x91,0x0,0x0,0xeb,0x81,0x1,0x3,0xff,0x7b,0xae,0xd5,0x10,0x9b,0x82,0x4a,0x81,0x9a,0x82,0x5a,0x81,0x59,0x81,0xa1,0x82,0x87,0x81,0x5c,0x82,0x89,0x81,0x88,0x81,0x6c,0x82,0x8d,0x81,0xa6,0x81,0x5e,0x0,0xd8,0x81,0xab,0x2,0x14,0xf3,0xff,0xdd,0xb5,0x81,0x1,0x0,0xfc,0x8f,0x0,0x5,0x83,0xff,0xdb,0xce,0x1,0xff,0x5a,0x9e,0xc5,0x10,0x82,0xe,0x81,0x9,0x2,0x3,0xce,0x8c,0x81,0xd,0x82,0x5,0x1,0xc,0x8e,0x82,0x21,0x81,0x22,0x2,0x20,0x2a,0x91,0x82,0x1a,0x81,0x6,0x2,0x7,0xdd,0x92,0x81,0xb,0x82,0x8,0x6,0x4,0xac,0xd6,0xff,0x7c,0xad,0x1,0xff,0xbc,0xd6,0x83,0x8e,0x0,0x7,0xf4,0x1,0xff,0x9e,0xe7,0xd0,0x10,0x5d,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0xca,0xd,0x82,0x5,0x81,0xc,0x0,0x26,0x81,0x21,0x82,0x22,0x0,0x20,0x81,0x2a,0x0,0x1a,0x82,0x6,0x82,0x7,0x81,0xb,0x82,0x8,0x81,0x4,0x5,0x11,0xac,0xec,0xff,0x5e,0xef,0x1,0xae,0x8c,0x0,0x9,0x2,0x0,0xf,0x1,0xff,0x7a,0xa6,0x10,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x2,0x26,0x28,0x21,0x82,0x22,0x0,0x20,0x81,0x3f,0x1,0x70,0x1a,0x81,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0xdb,0xff,0x9c,0xb5,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0xff,0x98,0x6d,0x17,0x5d,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x2,0x26,0x28,0x21,0x81,0x22,0x5,0x8b,0x4c,0xff,0xb4,0x53,0xff,0x94,0x53,0x2a,0x6f,0x81,0x6,0x82,0x7,0x1,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0xff,0x5b,0x8c,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0xb2,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x1,0x26,0x28,0x81,0x21,0x2,0x38,0xb0,0xc1,0x81,0xa,0x3,0x80,0xff,0xb3,0x5b,0xcc,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0xff,0x1b,0x7c,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x6,0x26,0x28,0x21,0x38,0xfa,0xa,0x23,0x81,0xa,0x6,0x1f,0x82,0xf5,0x6f,0x6,0x7,0x1e,0x81,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x6,0x26,0x28,0x21,0xa0,0xba,0x1f,0x25,0x81,0xa,0x8,0x25,0x95,0xff,0xf0,0xa4,0xcb,0x6,0x7,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x0,0x26,0x81,0x21,0x2,0x22,0xff,0xed,0xcd,0x23,0x83,0xa,0x2,0x1f,0xff,0xae,0xbd,0x6f,0x82,0x7,0x1,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x0,0x26,0x81,0x21,0x3,0x38,0xbc,0x1f,0x25,0x81,0xa,0x8,0x25,0x1f,0xff,0x4f,0xb5,0xa7,0x6,0x7,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x6,0x26,0x28,0x21,0xa0,0xb0,0x1f,0x23,0x81,0x25,0x6,0x23,0x1f,0xff,0xb3,0x63,0xa7,0x6,0x7,0x1e,0x81,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x1,0x26,0x28,0x81,0x21,0x8,0x38,0xff,0x71,0x7c,0x25,0x95,0x1f,0x94,0xff,0x52,0x7c,0x6f,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x2,0x26,0x28,0x21,0x81,0x22,0x5,0x6a,0xed,0xff,0xd1,0x8c,0xb4,0xe6,0x6d,0x81,0x6,0x82,0x7,0x1,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x1,0x26,0x28,0x81,0x21,0x6,0x22,0x4c,0x8b,0x86,0x6d,0xa8,0x1a,0x81,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x9,0x26,0x28,0x21,0x38,0x6a,0x8a,0x20,0x4c,0x2a,0x1a,0x82,0x6,0x81,0x7,0x0,0x1e,0x81,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x6,0x26,0x28,0xa9,0xb8,0xff,0x91,0x7c,0xf6,0x2a,0x81,0x3f,0x0,0x1a,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0xa,0x40,0xcd,0xef,0x23,0x1f,0x25,0xff,0x2d,0xd6,0xb9,0xaf,0x70,0x1a,0x81,0x6,0x82,0x7,0x1,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0xa,0x40,0x84,0xff,0x91,0x74,0x23,0x25,0xa,0x23,0xff,0x89,0xff,0xb9,0x6d,0x1a,0x81,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x4,0x40,0x6b,0xba,0x1f,0x25,0x81,0xa,0x3,0x23,0xff,0xf3,0x63,0x6d,0x1a,0x81,0x6,0x81,0x7,0x0,0x1e,0x81,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x3,0x28,0x40,0xc1,0x23,0x81,0xa,0x4,0xc2,0x94,0xe7,0xa8,0x1a,0x81,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x1,0x6b,0xfb,0x83,0xa,0x2,0x1f,0xbe,0x70,0x81,0x1a,0x81,0x6,0x82,0x7,0x1,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x4,0xc,0x40,0x84,0xff,0xd0,0x84,0x1f,0x81,0xa,0x4,0x25,0x1f,0xb7,0x86,0x90,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x2,0x28,0xff,0xce,0xbd,0x1f,0x82,0xa,0x3,0x23,0xaf,0x3f,0x90,0x82,0x6,0x81,0x7,0x0,0x1e,0x81,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x4,0xc,0x26,0xda,0xff,0xab,0xee,0x23,0x81,0xa,0x4,0x23,0xff,0x8c,0xee,0xde,0x70,0x1a,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x83,0x5,0x2,0x6b,0xff,0x12,0x5c,0x23,0x82,0xa,0x4,0x1f,0xbc,0x8b,0x2a,0x1a,0x82,0x6,0x82,0x7,0x1,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x4,0x8f,0x98,0xb8,0x1f,0x25,0x81,0xa,0x4,0x1f,0xff,0x91,0x84,0x86,0x2a,0x1a,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x1,0xc0,0x23,0x83,0xa,0x3,0xf9,0x3f,0x2a,0x1a,0x82,0x6,0x81,0x7,0x0,0x1e,0x81,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x2,0x4b,0xe0,0x82,0x82,0xa,0x5,0x23,0x80,0x4c,0x29,0x90,0x1a,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x2,0x98,0xff,0x71,0x64,0x23,0x81,0xa,0x6,0x25,0x1f,0xff,0x4f,0xa5,0x3f,0x2a,0x29,0x1a,0x82,0x6,0x82,0x7,0x1,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x3,0x85,0xff,0x4f,0x9d,0x1f,0x25,0x81,0xa,0x5,0x1f,0xb4,0x9f,0x2a,0x29,0x1a,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x2,0x8f,0x80,0x23,0x82,0xa,0x5,0x25,0xee,0x8a,0x20,0x29,0x1a,0x82,0x6,0x81,0x7,0x0,0x1e,0x81,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x81,0x5,0x1,0x4b,0xf0,0x83,0xa,0x1,0x23,0xff,0xd,0xd6,0x82,0x20,0x1,0x29,0x1a,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x6,0x15,0xd,0x5,0xd,0x85,0xff,0xb1,0x74,0x1f,0x81,0xa,0x7,0x25,0x1f,0xff,0x10,0x9d,0x9f,0x4c,0x20,0x29,0x1a,0x82,0x6,0x82,0x7,0x1,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x81,0x5,0x2,0x4b,0xbb,0x1f,0x82,0xa,0x6,0x23,0xff,0x12,0x64,0x6a,0x2a,0x20,0x29,0x1a,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x0,0x15,0x81,0xd,0x3,0xc9,0xd4,0xff,0x8c,0xe6,0x23,0x81,0xa,0x3,0xc2,0x94,0xdf,0x38,0x81,0x20,0x1,0x29,0x1a,0x82,0x6,0x81,0x7,0x0,0x1e,0x81,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x0,0x15,0x81,0xd,0x1,0x4b,0xf7,0x83,0xa,0x3,0x1f,0xbe,0x38,0x22,0x81,0x20,0x1,0x29,0x1a,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0x1c,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x0,0x15,0x81,0xd,0x2,0x85,0xff,0x2f,0x95,0x95,0x81,0xa,0x4,0x82,0x1f,0xb7,0x6a,0x22,0x81,0x20,0x1,0x29,0x1a,0x82,0x6,0x82,0x7,0x1,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0xb2,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x0,0x15,0x81,0xd,0x3,0x4b,0xb3,0x80,0x82,0x81,0x1f,0x3,0x23,0xff,0xd3,0x53,0x8a,0x22,0x81,0x20,0x1,0x29,0x1a,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0x1b,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xf,0x1,0xff,0x78,0x6d,0x17,0x19,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x81,0x5,0x8,0x4b,0xc,0xe8,0xb3,0xbb,0xc0,0xd9,0x38,0x22,0x81,0x20,0x1,0x29,0x1a,0x82,0x6,0x81,0x7,0x0,0x1e,0x81,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0xff,0x3b,0x84,0x1,0x16,0x0,0x2,0x8a,0x0,0x9,0x2,0x0,0xff,0xf0,0x7b,0x1,0xff,0xf9,0x85,0x17,0x5d,0x10,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x4,0xc,0xc8,0x84,0x6b,0x21,0x81,0x22,0x82,0x20,0x1,0x29,0x1a,0x82,0x6,0x81,0x7,0x2,0x1e,0x1d,0xb,0x81,0x8,0x82,0x4,0x7,0x14,0x11,0x18,0xff,0xfc,0x9c,0x1,0x16,0x0,0x2,0x8c,0x0,0x2,0xfe,0x1,0xff,0xfc,0xc6,0x81,0x9c,0x2,0x5d,0x13,0xe,0x81,0x9,0x82,0x3,0x1,0x15,0xd,0x82,0x5,0x81,0xc,0x2,0x40,0xa9,0x28,0x81,0x22,0x82,0x20,0x1,0x29,0x1a,0x82,0x6,0x82,0x7,0x1,0x1d,0xb,0x81,0x8,0x82,0x4,0x5,0x11,0xe2,0xdc,0xff,0x9d,0xce,0x1,0xf8,0x8e,0x0,0x5,0xc7,0xff,0x5d,0xe7,0x1,0xb5,0xc4,0x10,0x82,0xe,0x81,0x9,0x0,0xcf,0x81,0x8c,0x82,0xd,0x2,0x5,0x8f,0x40,0x81,0x8e,0x82,0x21,0x2,0x22,0x4c,0x2a,0x81,0x91,0x81,0x1a,0x0,0x6,0x81,0xad,0x81,0x92,0x82,0xb,0x8,0x8,0xe5,0xe4,0x14,0xd3,0xb6,0x1,0xff,0x3d,0xe7,0xc6,0x8f,0x0,0x5,0xff,0x6e,0x63,0x1,0x37,0xb5,0x5d,0x9b,0x82,0x4a,0x81,0x99,0x81,0x5a,0x82,0x59,0x81,0x97,0x81,0x96,0x82,0x5c,0x81,0x9e,0x81,0x9d,0x0,0x88,0x81,0x6c,0x81,0xa3,0x81,0xa2,0x82,0x5e,0x81,0xa5,0x81,0xa4,0x5,0xd7,0x11,0xb6,0x37,0x1,0xff,0x4e,0x6b,0x91,0x0,0x0,0xff,0x51,0x7c,0x81,0x1,0x1,0xff,0x5d,0xdf,0xff,0x1a,0x96,0x81,0xb1,0x83,0x74,0x0,0xff,0x18,0x6d,0x83,0x78,0x83,0x77,0x83,0x76,0x83,0x7b,0x83,0x7a,0x83,0x79,0x83,0x7c,0x1,0xff,0x7c,0xa5,0xff,0x1e,0xe7,0x81,0x1,0x0,0xff,0x32,0x84,0x93,0x0,0x1,0xfd,0xff,0xfc,0xd6,0xa6,0x1,0x1,0xff,0xdc,0xde,0xff,0xcc,0x5a,0x95,0x0,0x2,0xc3,0xf2,0xff,0xcf,0x73,0xa2,0x12,0x2,0xff,0xaf,0x73,0xae,0x83,0xd8,0x0,0xa4,0x2,0xff,0x72,0x1,0x0,0x1,0x30,0x2,0xab,0x0,0x4,0x64,0x7e,0x57,0x3b,0x41,0x8b,0x0,0x4,0x2,0x69,0x46,0x0,0x2,0xa9,0x0,0x5,0x68,0x36,0x2d,0x57,0x1,0x45,0x81,0x0,0x4,0x3e,0x60,0x2,0x0,0x2c,0x82,0x0,0x3,0x30,0x2,0x4f,0x31,0x81,0x0,0x1,0x5f,0x39,0x82,0x0,0x1,0x39,0x31,0xa2,0x0,0x1,0x35,0x33,0x81,0x0,0x19,0x56,0x36,0x0,0x2b,0x36,0x7f,0x35,0x6e,0x34,0x12,0x0,0x44,0x81,0x2c,0x34,0x4f,0x0,0x3c,0x27,0x2f,0x33,0x0,0xf,0x36,0x32,0x3c,0xa1,0x0,0x1,0x35,0x54,0x81,0x0,0x1a,0x46,0x2f,0x5b,0x3d,0x3b,0x2c,0x27,0x51,0x2d,0x81,0x0,0x7e,0x3c,0x0,0x27,0x73,0x45,0x1,0x5f,0x41,0x4f,0xaa,0x1,0x50,0x71,0x1,0x44,0xa0,0x0,0x1,0x35,0x52,0x81,0x0,0x11,0x51,0x3d,0x2c,0x2f,0x67,0x3b,0x57,0x4f,0x39,0x2f,0x43,0x3d,0x2b,0x0,0x69,0x62,0x51,0x35,0x82,0x0,0x1,0x44,0x1,0x81,0x65,0x1,0x3c,0x41,0xa0,0x0,0x1e,0x35,0x3c,0x2c,0x45,0x1,0x33,0x0,0x69,0x54,0x0,0x2d,0x71,0x0,0xbd,0x2f,0x68,0x2,0x0,0x58,0x45,0x44,0x1,0xaa,0x2b,0x53,0x31,0x1,0x73,0x2c,0x3a,0x30,0xa0,0x0,0x15,0x7e,0x37,0x3d,0x69,0x52,0x5b,0x0,0x2b,0x3d,0x69,0x36,0x71,0x0,0x45,0x1,0xf,0x0,0x2,0x32,0x50,0x0,0x65,0x81,0x27,0x2,0x12,0x0,0x3a,0x81,0x58,0x1,0x67,0x3e,0xa0,0x0,0x0,0x5b,0x81,0x3e,0x0,0x2,0x83,0x0,0x1,0x2,0x5f,0x83,0x0,0x0,0x5b,0x82,0x0,0x1,0x3e,0x2,0x81,0x0,0x1,0x39,0x30,0x82,0x0,0x1,0x30,0x5f,0xff,0x17,0x1,0x0,0x1,0x39,0x31,0x86,0x0,0x5,0x30,0x51,0x57,0x72,0x0,0x2,0x96,0x0,0x3,0x2,0x0,0x43,0x2e,0x81,0x0,0x0,0x2,0x90,0x0,0x3,0x2,0x0,0x2e,0x7f,0x86,0x0,0x3,0x64,0x2f,0x75,0x4d,0x97,0x0,0x4,0x52,0x2c,0x0,0x50,0x57,0x93,0x0,0x2b,0x2,0x0,0x33,0x36,0x0,0x2b,0x63,0x2d,0x65,0x60,0x2c,0x32,0x81,0xf,0x2c,0x39,0x52,0x56,0x43,0x0,0x60,0x2d,0x63,0x64,0x31,0x2d,0x50,0x56,0x41,0x45,0x3c,0x43,0x0,0x6e,0x2e,0x3c,0x4f,0x0,0x33,0x1,0x67,0x62,0x60,0x2d,0x81,0x0,0x9,0x46,0x3c,0x64,0x2,0x0,0x46,0x45,0x2e,0x53,0x39,0x87,0x0,0x37,0x2,0x0,0x2e,0x36,0x0,0x52,0x1,0x2e,0x68,0x32,0x2c,0x34,0x58,0x33,0x60,0x7f,0x34,0x54,0x1,0x71,0x43,0x1,0x68,0x75,0x44,0x1,0x3b,0x67,0x1,0x7d,0xff,0x18,0xc6,0x27,0x0,0xf,0x56,0x3a,0x1,0x4d,0x3a,0x1,0x57,0x72,0x2d,0x2f,0x0,0x51,0x37,0x2e,0x27,0x7d,0x0,0x7f,0x27,0x12,0x2f,0x7d,0x87,0x0,0x37,0x2,0x0,0x2e,0x36,0x0,0x2e,0x32,0x0,0x4e,0x1,0x0,0x3a,0x35,0x0,0x4e,0x1,0x30,0x0,0x34,0x53,0x72,0x1,0x6e,0x0,0x62,0x37,0x0,0x4d,0x1,0x0,0x31,0x37,0x30,0x3e,0x4f,0x2e,0x1,0x2b,0x0,0x2f,0x31,0x0,0x64,0x32,0x0,0x3d,0x3a,0x0,0x50,0x2f,0x0,0x34,0x54,0x0,0x33,0x34,0x87,0x0,0x37,0x2,0x0,0x2e,0x32,0x0,0x33,0xbf,0x0,0x44,0x27,0x0,0x51,0x68,0x0,0x2b,0x1,0x30,0x0,0x34,0x53,0x41,0x27,0x3e,0x0,0x62,0x27,0x0,0x2b,0x27,0x2,0x4e,0x27,0x30,0x7e,0xbd,0x41,0x58,0x72,0x2c,0x1,0x4d,0x0,0x2d,0x32,0x0,0x3d,0xf,0x0,0x50,0x2f,0x0,0x34,0x2e,0x0,0x53,0xbf,0x87,0x0,0x37,0x2,0x0,0x53,0x27,0x0,0x7d,0x36,0x0,0x73,0x1,0x0,0x52,0x81,0x0,0x5b,0x32,0x35,0x3b,0x1,0x4d,0x2b,0x1,0x30,0x0,0x73,0x1,0x0,0x62,0x1,0x2,0x4e,0x1,0x2c,0x35,0x67,0x75,0x1,0x65,0x2,0x58,0x32,0x2b,0x2d,0x2f,0x0,0x12,0x37,0x33,0x27,0x54,0x0,0x3d,0x54,0x0,0x3b,0x32,0x89,0x0,0xa,0x43,0x75,0x0,0x2b,0x63,0x0,0x31,0xf,0x0,0x4e,0x46,0x81,0x0,0x1c,0x39,0x33,0x3b,0x4e,0x0,0x31,0x3a,0x2,0x0,0x31,0x3a,0x0,0x5f,0xf,0x0,0x6e,0xf,0x2,0x31,0x3b,0x46,0x2b,0x12,0x0,0x41,0x56,0x44,0x4d,0x2d,0x81,0x0,0x2,0x63,0x56,0x2d,0x81,0x0,0x4,0x46,0x43,0x0,0x2b,0x63,0xca,0x0,0x0,0x2,0x84,0x0,0x0,0x2,0x85,0x0,0x81,0x2,0x82,0x0,0x0,0x2,0x82,0x0,0x0,0x2,0x81,0x0,0x0,0x2,0x81,0x0,0x0,0x2,0x81,0x0,0x0,0x2,0x81,0x0,0x0,0x2,0x81,0x0,0x0,0x2,0x81,0x0,0x0,0x2,0xff,0x91,0x1,0x0};
+constexpr bitmap_asset_t information_app_bmp {64, 92, information_app_bmp_palette, information_app_bmp_data, 3412};
+
+#endif
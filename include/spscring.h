@@ -0,0 +1,114 @@
+/**
+ * @file                    spscring.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `SpscRing` class, a ring buffer that is safe to share between an interrupt and the main loop
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_SPSCRING_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_SPSCRING_H__
+
+#include "Arduino.h"
+
+#include "atomic"
+
+/**
+ * @brief                   Lock-free ring buffer with a single producer and a single consumer (template)
+ *
+ *                          The producer (usually an interrupt) only writes `tail`, and the consumer (usually the main loop)
+ *                          only writes `head`, so neither side has to disable interrupts. An entry is written completely
+ *                          before `tail` is advanced past it, and read completely before `head` is advanced past it.
+ *
+ * @note                    Entries pushed while the buffer is full are dropped and counted
+ *
+ * @tparam T                Type of the entries
+ * @tparam CAPACITY         Maximum number of entries (must be a power of two)
+ *
+ */
+template <typename T, unsigned CAPACITY>
+class SpscRing {
+
+    static_assert(CAPACITY != 0 && (CAPACITY & (CAPACITY - 1)) == 0, "the capacity must be a power of two");
+    static_assert(CAPACITY <= 0x8000, "the indices are stored in 16 bits");
+
+protected:
+
+    /** Storage for the entries */
+    T entries[CAPACITY];
+
+    /** Number of entries popped so far (wraps around, only written by the consumer) */
+    volatile uint16_t head {0};
+    /** Number of entries pushed so far (wraps around, only written by the producer) */
+    volatile uint16_t tail {0};
+
+    /** Number of entries dropped because the buffer was full (only written by the producer) */
+    volatile uint16_t dropped {0};
+
+public:
+
+    /**
+     * @brief               Add an entry at the back of the buffer (must only be called by the producer)
+     *
+     * @return false        If the buffer was full (the entry is dropped)
+     * @return true         If the entry was added
+     *
+     */
+    bool push(const T &entry) {
+
+        uint16_t t = tail;
+
+        if ((uint16_t)(t - head) == CAPACITY) {
+            dropped = dropped + 1;
+            return false;
+        }
+
+        entries[t & (CAPACITY - 1)] = entry;
+
+        // the entry must be in memory before the consumer can see it
+        std::atomic_signal_fence(std::memory_order_release);
+        tail = t + 1;
+
+        return true;
+    }
+
+    /**
+     * @brief               Remove the entry at the front of the buffer (must only be called by the consumer)
+     *
+     * @param entry         Pointer to store the entry (unchanged if the buffer is empty)
+     *
+     * @return false        If the buffer was empty
+     * @return true         If an entry was removed
+     *
+     */
+    bool pop(T *entry) {
+
+        uint16_t h = head;
+
+        if (h == tail) {
+            return false;
+        }
+
+        std::atomic_signal_fence(std::memory_order_acquire);
+        *entry = entries[h & (CAPACITY - 1)];
+
+        // the entry must be read before the producer can overwrite it
+        std::atomic_signal_fence(std::memory_order_release);
+        head = h + 1;
+
+        return true;
+    }
+
+    /**
+     * @brief               Get the number of entries in the buffer
+     *
+     */
+    unsigned size() const { return (uint16_t)(tail - head); }
+
+    /**
+     * @brief               Get the number of entries that were dropped because the buffer was full
+     *
+     */
+    unsigned get_dropped() const { return dropped; }
+};
+
+#endif
@@ -0,0 +1,193 @@
+/**
+ * @file                    touchcalibration.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `TouchCalibration` class, which computes and stores the mapping from raw touchscreen
+ *                          coordinates to pixels
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TOUCHCALIBRATION_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TOUCHCALIBRATION_H__
+
+#include "Arduino.h"
+
+/** Offset in the EEPROM (data flash) at which the calibration is stored (can be overridden from the build flags) */
+#ifndef TOUCH_CALIBRATION_ADDRESS
+#define TOUCH_CALIBRATION_ADDRESS 0
+#endif
+
+/** Path of the file that stands in for the EEPROM on the host (can be overridden from the build flags) */
+#ifndef TOUCH_CALIBRATION_FILE
+#define TOUCH_CALIBRATION_FILE "touch_calibration.bin"
+#endif
+
+/**
+ * @brief                   Point on the touchscreen (either in raw coordinates or in pixels)
+ *
+ */
+struct touch_point_t {
+    int32_t x;
+    int32_t y;
+};
+
+/**
+ * @brief                   Affine mapping from raw coordinates to pixels, with coefficients in Q16 fixed-point -
+ *
+ *                              x_px = (a * x_raw + b * y_raw + c) >> 16
+ *                              y_px = (d * x_raw + e * y_raw + f) >> 16
+ *
+ *                          Unlike a separate scale for each axis, this also corrects a panel that is rotated or skewed
+ *                          relative to the display
+ *
+ */
+struct touch_calibration_t {
+    int32_t a;
+    int32_t b;
+    int32_t c;
+    int32_t d;
+    int32_t e;
+    int32_t f;
+};
+
+/**
+ * @brief                   Computes, applies and stores the calibration of the touchscreen
+ *
+ *                          The calibration is computed from three targets that were touched (dividing only once), and is only
+ *                          accepted if it maps a fourth target, touched separately, onto itself. After that
+ *                          every sample is mapped with multiplications and shifts. On the device, the calibration is kept in
+ *                          the EEPROM (emulated in the data flash of the UNO R4) and survives a reset. On the host, a file
+ *                          stands in for the EEPROM.
+ *
+ */
+class TouchCalibration {
+
+public:
+
+    /** Number of fractional bits of the coefficients */
+    constexpr static unsigned FRAC_BITS = 16;
+
+    /** Number of targets required to compute a calibration */
+    constexpr static unsigned NUM_TARGETS = 3;
+
+    /** Smallest determinant of the raw targets (twice the area of their triangle, about 32x32 pixels) that is accepted */
+    constexpr static int64_t MIN_DETERMINANT = 4096;
+
+    /** Largest magnitude of the scale coefficients (4 pixels per raw unit, far beyond any real panel) */
+    constexpr static int64_t MAX_SCALE = (int64_t)4 << FRAC_BITS;
+    /** Largest magnitude of the offset coefficients (keeps `apply` within 32 bits for raw coordinates below 1024) */
+    constexpr static int64_t MAX_OFFSET = (int64_t)4096 << FRAC_BITS;
+
+    /** Largest distance (along either axis, in pixels) from the check target at which `verify` accepts the touch */
+    constexpr static int32_t MAX_CHECK_ERROR = 8;
+
+    /**
+     * @brief               Map a point from raw coordinates to pixels
+     *
+     * @param cal           Calibration to apply
+     * @param raw_x         Raw X-coordinate
+     * @param raw_y         Raw Y-coordinate
+     * @param x             Pointer to store the X-coordinate (in pixels, not limited to the display)
+     * @param y             Pointer to store the Y-coordinate (in pixels, not limited to the display)
+     *
+     */
+    static void apply(const touch_calibration_t &cal, int32_t raw_x, int32_t raw_y, int32_t *x, int32_t *y) {
+
+        constexpr int32_t HALF = (int32_t)1 << (FRAC_BITS - 1);
+
+        *x = (cal.a * raw_x + cal.b * raw_y + cal.c + HALF) >> FRAC_BITS;
+        *y = (cal.d * raw_x + cal.e * raw_y + cal.f + HALF) >> FRAC_BITS;
+    }
+
+    /**
+     * @brief               Compute the calibration that maps the raw coordinates of three touched targets onto the targets
+     *
+     * @param raw           Raw coordinates at which each target was touched
+     * @param screen        Coordinates of each target (in pixels)
+     * @param cal           Pointer to store the calibration (unchanged if it could not be computed)
+     *
+     * @return true         If the calibration was computed
+     * @return false        If the raw coordinates (nearly) lie on a line, or the mapping is far from any real panel (the
+     *                      targets were not touched properly)
+     *
+     */
+    static bool compute(const touch_point_t raw[NUM_TARGETS], const touch_point_t screen[NUM_TARGETS], touch_calibration_t *cal);
+
+    /**
+     * @brief               Check a calibration against a target that was not used to compute it (must pass before the
+     *                      calibration is stored)
+     *
+     * @note                The three targets of `compute` always map back onto themselves, so only a separate target can show
+     *                      that one of them was touched off its mark
+     *
+     * @param cal           Calibration to check
+     * @param raw           Raw coordinates at which the check target was touched
+     * @param screen        Coordinates of the check target (in pixels)
+     *
+     * @return true         If the check target is mapped within `MAX_CHECK_ERROR` pixels of itself
+     * @return false        Otherwise
+     *
+     */
+    static bool verify(const touch_calibration_t &cal, const touch_point_t &raw, const touch_point_t &screen);
+
+    /**
+     * @brief               Compute the calibration that maps a range of raw coordinates onto the whole display (with the
+     *                      Y-axis flipped), used until the touchscreen has been calibrated
+     *
+     * @param x_begin       Raw X-coordinate of the left-edge
+     * @param x_end         Raw X-coordinate of the right-edge
+     * @param y_begin       Raw Y-coordinate of the bottom-edge
+     * @param y_end         Raw Y-coordinate of the top-edge
+     * @param width         Number of columns on the display
+     * @param height        Number of rows on the display
+     *
+     */
+    static touch_calibration_t from_bounds(unsigned x_begin, unsigned x_end, unsigned y_begin, unsigned y_end, unsigned width, unsigned height);
+
+    /**
+     * @brief               Read the stored calibration
+     *
+     * @param cal           Pointer to store the calibration (unchanged if none is stored)
+     *
+     * @return true         If a valid calibration was stored
+     * @return false        If the touchscreen was never calibrated (or the stored calibration is corrupted)
+     *
+     */
+    static bool load(touch_calibration_t *cal);
+
+    /**
+     * @brief               Store a calibration, so that it is loaded on the next boot
+     *
+     * @return true         If the calibration was stored
+     * @return false        If the calibration could not be stored
+     *
+     */
+    static bool save(const touch_calibration_t &cal);
+
+protected:
+
+    /** Value that marks a stored calibration (changed whenever the layout of the record changes) */
+    constexpr static uint32_t MAGIC = 0x4C414331;
+
+    /** Layout of a stored calibration */
+    struct record_t {
+        uint32_t magic;
+        touch_calibration_t cal;
+        uint32_t checksum;
+    };
+
+    /**
+     * @brief               Check if a coefficient lies within a bound (in either direction)
+     *
+     */
+    static bool within(int64_t coefficient, int64_t bound) {
+        return -bound <= coefficient && coefficient <= bound;
+    }
+
+    /**
+     * @brief               Compute the checksum of a calibration (detects a record that was partially written)
+     *
+     */
+    static uint32_t checksum_of(const touch_calibration_t &cal);
+};
+
+#endif
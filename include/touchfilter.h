@@ -0,0 +1,319 @@
+/**
+ * @file                    touchfilter.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the stages of the filter applied to the raw coordinates of the touchscreen
+ *
+ *                          Each stage is a class with the same three members, so that stages can be added, removed or
+ *                          reordered in `TouchFilter` -
+ *
+ *                              DELAY               Number of samples by which the stage delays the coordinates
+ *                              reset()             Forget all previous samples (called when the stylus is lifted)
+ *                              apply(&x, &y)       Filter the coordinates in place (returns false to discard the sample)
+ *
+ *                          All stages use integer arithmetic only, and a stage whose parameter disables it compiles to nothing
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TOUCHFILTER_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TOUCHFILTER_H__
+
+#include "Arduino.h"
+
+#include "profiler.h"
+
+/** Number of samples the median is taken over (can be overridden from the build flags, 1 to disable the stage) */
+#ifndef TOUCH_MEDIAN_SIZE
+#define TOUCH_MEDIAN_SIZE 5
+#endif
+
+/** Weight of a new sample in the smoothing is 1 / 2^TOUCH_SMOOTHING_SHIFT (can be overridden from the build flags, 0 to disable the stage) */
+#ifndef TOUCH_SMOOTHING_SHIFT
+#define TOUCH_SMOOTHING_SHIFT 1
+#endif
+
+/** Smallest movement (in raw units, about 2 per pixel) that is passed on (can be overridden from the build flags, 0 to disable the stage) */
+#ifndef TOUCH_MIN_MOVEMENT
+#define TOUCH_MIN_MOVEMENT 3
+#endif
+
+/**
+ * @brief                   Replaces each coordinate with the median of the last few samples, which removes isolated spikes
+ *
+ * @note                    At the start of a stroke, the median is taken over the samples received so far
+ *
+ * @tparam SIZE             Number of samples the median is taken over (must be odd)
+ *
+ */
+template <unsigned SIZE>
+class MedianStage {
+
+    static_assert(SIZE % 2 == 1, "the median must be taken over an odd number of samples");
+    static_assert(SIZE <= 15, "the samples are sorted by insertion");
+
+protected:
+
+    /** Last few X-coordinates (in the order in which they were received, wrapping around) */
+    uint16_t xs[SIZE];
+    /** Last few Y-coordinates (in the order in which they were received, wrapping around) */
+    uint16_t ys[SIZE];
+
+    /** Number of samples received since the last reset (saturates at `SIZE`) */
+    uint8_t count {0};
+    /** Index at which the next sample is stored */
+    uint8_t next {0};
+
+    /**
+     * @brief               Get the median of the first few values of an array
+     *
+     */
+    static uint16_t median_of(const uint16_t *values, unsigned num) {
+
+        uint16_t sorted[SIZE];
+
+        for (unsigned i = 0; i < num; ++i) {
+
+            uint16_t v = values[i];
+            unsigned j = i;
+
+            for (; j != 0 && sorted[j - 1] > v; --j) {
+                sorted[j] = sorted[j - 1];
+            }
+            sorted[j] = v;
+        }
+
+        return sorted[num / 2];
+    }
+
+public:
+
+    /** Number of samples by which the stage delays the coordinates */
+    constexpr static unsigned DELAY = (SIZE - 1) / 2;
+
+    void reset() {
+        count = 0;
+        next = 0;
+    }
+
+    bool apply(uint16_t *x, uint16_t *y) {
+
+        if (SIZE == 1) {
+            return true;
+        }
+
+        xs[next] = *x;
+        ys[next] = *y;
+
+        next = (next + 1 == SIZE) ? 0 : next + 1;
+        if (count < SIZE) {
+            ++count;
+        }
+
+        *x = median_of(xs, count);
+        *y = median_of(ys, count);
+
+        return true;
+    }
+};
+
+/**
+ * @brief                   Exponential smoothing of the coordinates, which removes the jitter of a stationary stylus
+ *
+ *                          The state is kept with 4 fractional bits, so that slow movements are not lost to rounding
+ *
+ * @tparam SHIFT            The weight of a new sample is 1 / 2^SHIFT
+ *
+ */
+template <unsigned SHIFT>
+class SmoothingStage {
+
+    static_assert(SHIFT <= 8, "the weight of a new sample is too small");
+
+protected:
+
+    /** Number of fractional bits in the state */
+    constexpr static unsigned FRAC_BITS = 4;
+
+    /** Smoothed X-coordinate (fixed-point) */
+    int32_t x_state {0};
+    /** Smoothed Y-coordinate (fixed-point) */
+    int32_t y_state {0};
+
+    /** Flag indicating if the state holds a sample (the first sample of a stroke is passed on unchanged) */
+    bool primed {false};
+
+public:
+
+    /** Number of samples by which the stage delays the coordinates (group delay of the smoothing) */
+    constexpr static unsigned DELAY = (1u << SHIFT) - 1;
+
+    void reset() {
+        primed = false;
+    }
+
+    bool apply(uint16_t *x, uint16_t *y) {
+
+        if (SHIFT == 0) {
+            return true;
+        }
+
+        int32_t x_in = (int32_t)*x << FRAC_BITS;
+        int32_t y_in = (int32_t)*y << FRAC_BITS;
+
+        if (!primed) {
+            x_state = x_in;
+            y_state = y_in;
+            primed = true;
+        }
+        else {
+            x_state += (x_in - x_state) / (1 << SHIFT);
+            y_state += (y_in - y_state) / (1 << SHIFT);
+        }
+
+        *x = (x_state + (1 << (FRAC_BITS - 1))) >> FRAC_BITS;
+        *y = (y_state + (1 << (FRAC_BITS - 1))) >> FRAC_BITS;
+
+        return true;
+    }
+};
+
+/**
+ * @brief                   Discards samples that are too close to the last one passed on, so that a resting stylus does not
+ *                          produce a stream of identical points
+ *
+ * @tparam MIN_MOVEMENT     Smallest distance (along either axis) from the last sample passed on
+ *
+ */
+template <unsigned MIN_MOVEMENT>
+class MovementGate {
+
+protected:
+
+    /** X-coordinate of the last sample passed on */
+    uint16_t last_x {0};
+    /** Y-coordinate of the last sample passed on */
+    uint16_t last_y {0};
+
+    /** Flag indicating if a sample has been passed on since the last reset (the first one always is) */
+    bool primed {false};
+
+public:
+
+    /** Number of samples by which the stage delays the coordinates */
+    constexpr static unsigned DELAY = 0;
+
+    void reset() {
+        primed = false;
+    }
+
+    bool apply(uint16_t *x, uint16_t *y) {
+
+        if (MIN_MOVEMENT == 0) {
+            return true;
+        }
+
+        if (primed) {
+
+            unsigned dx = (*x > last_x) ? (*x - last_x) : (last_x - *x);
+            unsigned dy = (*y > last_y) ? (*y - last_y) : (last_y - *y);
+
+            if (dx < MIN_MOVEMENT && dy < MIN_MOVEMENT) {
+                *x = last_x;
+                *y = last_y;
+                return false;
+            }
+        }
+
+        last_x = *x;
+        last_y = *y;
+        primed = true;
+
+        return true;
+    }
+};
+
+/**
+ * @brief                   Chain of filters applied to the raw coordinates of each touch, before they are mapped to pixels
+ *
+ *                          The median removes spikes, the smoothing removes jitter, and the gate discards the samples that
+ *                          would only repeat the last point. The time spent in each stage is recorded by the profiler.
+ *
+ */
+class TouchFilter {
+
+public:
+
+    using median_t = MedianStage<TOUCH_MEDIAN_SIZE>;
+    using smoothing_t = SmoothingStage<TOUCH_SMOOTHING_SHIFT>;
+    using gate_t = MovementGate<TOUCH_MIN_MOVEMENT>;
+
+    /** Number of samples by which the whole chain delays the coordinates */
+    constexpr static unsigned DELAY = median_t::DELAY + smoothing_t::DELAY + gate_t::DELAY;
+
+protected:
+
+    median_t median;
+    smoothing_t smoothing;
+    gate_t gate;
+
+public:
+
+    /**
+     * @brief               Forget all previous samples (must be called when the stylus is lifted)
+     *
+     */
+    void reset() {
+        median.reset();
+        smoothing.reset();
+        gate.reset();
+    }
+
+    /**
+     * @brief               Filter the coordinates of a sample in place
+     *
+     * @param x             Pointer to the raw X-coordinate
+     * @param y             Pointer to the raw Y-coordinate
+     *
+     * @return true         If the sample must be passed on
+     * @return false        If the sample barely moved from the last one (the coordinates are set to the last one)
+     *
+     */
+    bool apply(uint16_t *x, uint16_t *y) {
+
+        {
+            PROFILE_ZONE(PROFILE_FILTER_MEDIAN);
+            median.apply(x, y);
+        }
+        {
+            PROFILE_ZONE(PROFILE_FILTER_SMOOTHING);
+            smoothing.apply(x, y);
+        }
+
+        PROFILE_ZONE(PROFILE_FILTER_GATE);
+        return gate.apply(x, y);
+    }
+
+    /**
+     * @brief               Print the delay added by each stage
+     *
+     * @param out           Reference to the stream on which the report is printed
+     * @param rate_hz       Number of samples taken per second (to convert the delays to microseconds)
+     *
+     */
+    static void report(Print *out, float rate_hz) {
+
+        const char *const names[] {"median", "smoothing", "gate", "total"};
+        const unsigned delays[] {median_t::DELAY, smoothing_t::DELAY, gate_t::DELAY, DELAY};
+
+        out->println("touch filter stage, delay_samples, delay_us");
+
+        for (unsigned idx = 0; idx < 4; ++idx) {
+            out->print(names[idx]);
+            out->print(", ");
+            out->print(delays[idx]);
+            out->print(", ");
+            out->println((unsigned long)(delays[idx] * 1000000.0f / rate_hz));
+        }
+    }
+};
+
+#endif
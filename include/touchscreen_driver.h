@@ -11,18 +11,55 @@
 #include "Arduino.h"
 #include "TouchScreen.h"
 
+#ifdef ARDUINO
+#include "FspTimer.h"
+#endif
+
+#include "spscring.h"
+#include "touchfilter.h"
+#include "touchcalibration.h"
+
+/**
+ * @brief                   Raw measurement of the touchscreen
+ *
+ */
+struct touch_sample_t {
+    /** Raw X-coordinate */
+    uint16_t x;
+    /** Raw Y-coordinate */
+    uint16_t y;
+    /** Raw pressure (outside the pressure bounds if the screen was not touched) */
+    uint16_t z;
+    /** Time at which the measurement was taken (in microseconds) */
+    uint32_t t;
+};
+
 /**
  * @brief                   Class for interacting with a resistive touchscreen
+ *
+ *                          Measurements are collected into a buffer of samples, either by a timer interrupt (after
+ *                          `begin_sampling`) or by calling `read_screen` from the loop. The loop then handles the samples
+ *                          one at a time with `process_sample`, so that no samples are lost while the loop is busy.
+ *
+ *                          The timer skips a measurement whenever the display bus is in use (see `BusLock`), since the
+ *                          touchscreen shares pins with the display.
  */
 class Touchscreen {
 
-    /** Minimum raw coordinate in X-axis (for UNO R4 WiFi) */
+public:
+
+    /** Function that takes a measurement (used to replace the touchscreen with a simulated one) */
+    using sample_source_t = bool (*)(touch_sample_t *sample);
+
+protected:
+
+    /** Minimum raw coordinate in X-axis (for UNO R4 WiFi, only used until the touchscreen is calibrated) */
     constexpr static unsigned XBEGIN = 177;
-    /** Maximum raw coordinate in X-axis (for UNO R4 WiFi) */
+    /** Maximum raw coordinate in X-axis (for UNO R4 WiFi, only used until the touchscreen is calibrated) */
     constexpr static unsigned XEND = 863;
-    /** Minimum raw coordinate in Y-axis (for UNO R4 WiFi) */
+    /** Minimum raw coordinate in Y-axis (for UNO R4 WiFi, only used until the touchscreen is calibrated) */
     constexpr static unsigned YBEGIN = 121;
-    /** Maximum raw coordinate in Y-axis (for UNO R4 WiFi) */
+    /** Maximum raw coordinate in Y-axis (for UNO R4 WiFi, only used until the touchscreen is calibrated) */
     constexpr static unsigned YEND = 950;
 
     /** Default value for member `pressure_lo` */
@@ -30,6 +67,12 @@ class Touchscreen {
     /** Default value for member `pressure_hi` */
     constexpr static unsigned DEFAULT_PRESSURE_HI = 1400;
 
+    /** Maximum number of samples that can be waiting to be processed */
+    constexpr static unsigned SAMPLE_CAPACITY = 64;
+
+    /** Default number of measurements taken per second by the timer */
+    constexpr static float DEFAULT_SAMPLE_RATE = 250.0f;
+
     /** Internal instance of the touchscreen library */
     TouchScreen ts;
     /** Internal variable to store a touch point */
@@ -76,6 +119,47 @@ class Touchscreen {
     /** Y-ccoordinate of the current touch (only valid if `is_pressed` is true) */
     unsigned cur_y {0};
 
+    /** Raw X-coordinate of the current touch, after filtering (only valid if `is_pressed` is true) */
+    unsigned raw_x {0};
+    /** Raw Y-coordinate of the current touch, after filtering (only valid if `is_pressed` is true) */
+    unsigned raw_y {0};
+
+    /** Mapping from raw coordinates to pixels */
+    touch_calibration_t calibration;
+    /** Flag indicating if `calibration` was set explicitly (otherwise it follows the dimensions of the touchscreen) */
+    bool calibrated {false};
+
+    /** Time at which the last processed sample was taken (in microseconds) */
+    uint32_t sample_time {0};
+
+    /** Flag indicating if the touched point moved with the last processed sample (only valid if `is_pressed` is true) */
+    bool has_moved {false};
+
+    /** Filter applied to the coordinates of every touch */
+    TouchFilter filter;
+
+    /** Number of measurements taken per second (by the timer, or by the loop while polling) */
+    float sample_rate {DEFAULT_SAMPLE_RATE};
+
+    /** Samples that have been collected but not yet processed */
+    SpscRing<touch_sample_t, SAMPLE_CAPACITY> samples;
+
+    /** Function used to take measurements instead of the touchscreen (nullptr to use the touchscreen) */
+    sample_source_t source {nullptr};
+
+    /** Flag indicating if the timer is collecting samples */
+    bool sampling {false};
+    /** Flag indicating if the last collected sample was a touch (samples are not collected while nothing touches the screen) */
+    bool last_touched {false};
+
+    /** Number of measurements the timer skipped because the display bus was in use */
+    volatile uint16_t skipped {0};
+
+#ifdef ARDUINO
+    /** Timer that collects samples */
+    FspTimer timer;
+#endif
+
 public:
 
     /**
@@ -109,6 +193,20 @@ public:
      */
     void set_pressure_bounds(unsigned plo, unsigned phi);
 
+    /**
+     * @brief               Set the mapping from raw coordinates to pixels (computed by `TouchCalibration::compute` or loaded
+     *                      with `TouchCalibration::load`)
+     *
+     * @param new_calibration   Calibration of the touchscreen
+     */
+    void set_calibration(const touch_calibration_t &new_calibration);
+
+    /**
+     * @brief               Get the mapping from raw coordinates to pixels that is in use
+     *
+     */
+    const touch_calibration_t &get_calibration() const;
+
     /**
      * @brief               Returns the coordinates of the latest press event (if available)
      *
@@ -143,13 +241,118 @@ public:
     bool get_stylus_position(unsigned *x, unsigned *y);
 
     /**
-     * @brief               Reads the current status of the touchscreen and updates the press and release events
+     * @brief               Check if the touched point moved with the last processed sample
+     *
+     * @note                Samples that barely move from the last point are discarded by the filter, so that the same point is
+     *                      not handled repeatedly while the stylus rests on the screen
+     *
+     * @return true         If the screen is being touched and the point moved (or the touch just started)
+     * @return false        Otherwise
+     */
+    bool get_stylus_moved() const;
+
+    /**
+     * @brief               Returns the raw coordinates of the currently touched point (used to calibrate the touchscreen)
+     *
+     * @param x             Pointer to store the raw X-coordinate (unchanged if the screen is not being touched)
+     * @param y             Pointer to store the raw Y-coordinate (unchanged if the screen is not being touched)
+     *
+     * @return true         If the screen is being touched (the values pointed to by the pointers have been changed)
+     * @return false        If the screen is not being touched (the values pointed to by the pointers have not been changed)
+     */
+    bool get_raw_position(unsigned *x, unsigned *y) const;
+
+    /**
+     * @brief               Get the time at which the last processed sample was taken (in microseconds)
+     *
+     */
+    uint32_t get_sample_time() const;
+
+    /**
+     * @brief               Print the delay that each stage of the touch filter adds
+     *
+     * @param out           Reference to the stream on which the report is printed
+     *
+     */
+    void report_filter(Print *out) const;
+
+    /**
+     * @brief               Start collecting samples from a timer interrupt
+     *
+     * @param rate_hz       Number of measurements taken per second
+     *
+     * @return false        If no timer is available (samples must be collected with `read_screen`)
+     * @return true         If the timer was started
+     */
+    bool begin_sampling(float rate_hz = DEFAULT_SAMPLE_RATE);
+
+    /**
+     * @brief               Take measurements from a function instead of the touchscreen (used to simulate the touchscreen)
+     *
+     * @param new_source    Function that takes a measurement (nullptr to use the touchscreen again)
+     */
+    void set_sample_source(sample_source_t new_source);
+
+    /**
+     * @brief               Measure the current state of the touchscreen and add it to the buffer of samples
+     *
+     * @note                This does nothing while the timer is collecting samples
      *
      */
     void read_screen();
 
+    /**
+     * @brief               Process the oldest sample in the buffer and update the press and release events
+     *
+     * @return true         If a sample was processed
+     * @return false        If the buffer was empty
+     */
+    bool process_sample();
+
+    /**
+     * @brief               Get the number of samples waiting to be processed
+     *
+     */
+    unsigned get_pending() const;
+
+    /**
+     * @brief               Get the number of samples that were dropped because too many were waiting to be processed
+     *
+     */
+    unsigned get_dropped() const;
+
+    /**
+     * @brief               Get the number of measurements the timer skipped because the display bus was in use
+     *
+     */
+    unsigned get_skipped() const;
+
 private:
 
+    /**
+     * @brief               Take a measurement and add it to the buffer (unless nothing touches the screen, as before)
+     *
+     */
+    void collect_sample();
+
+    /**
+     * @brief               Take a measurement from the touchscreen (or the function set with `set_sample_source`)
+     *
+     * @param sample        Pointer to store the measurement
+     *
+     * @return true         If a measurement was taken
+     * @return false        If no measurement could be taken
+     */
+    bool take_sample(touch_sample_t *sample);
+
+#ifdef ARDUINO
+    /**
+     * @brief               Collect a sample from the timer interrupt (unless the display bus is in use)
+     *
+     */
+    static void on_timer(timer_callback_args_t *args);
+#endif
+
     /**
      * @brief               Resets the pins to be digital outputs
      *
@@ -157,7 +360,8 @@ private:
     void reset_pin_functions();
 
     /**
-     * @brief               Convert the coordinates from their raw-values to pixel locations
+     * @brief               Convert the coordinates from their raw-values to pixel locations (using only multiplications and
+     *                      shifts)
      *
      * @param x             Pointer to store converted X-coordinate
      * @param y             Pointer to store converted Y-coordinate
@@ -19,16 +19,25 @@ class ColorSelector : public BasicWidget, public InteractiveWidget {
 
 protected:
 
-    /** The cooldown period between two presses (used to prevent "bouncing", where a single press is detected as multiple) */
-    constexpr static unsigned DEBOUNCE_THRESH = 200;
-
     constexpr static unsigned PAINT_RADIUS = 12;
     constexpr static unsigned H_PAD = 12;
     constexpr static unsigned V_PAD = 12;
 
+public:
+
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "ColorSelector";
+
+    /** Return the widget to the widget pool, counted against `TYPE_NAME` */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, TYPE_NAME);
+    }
+
     constexpr static unsigned WIDTH = (H_PAD * (3 + 1)) + (PAINT_RADIUS * (3 * 2));
     constexpr static unsigned HEIGHT = (V_PAD * (3 + 1)) + (PAINT_RADIUS * (3 * 2));
 
+protected:
+
     /** Reference to parent frame */
     Frame *parent {nullptr};
 
@@ -67,9 +76,6 @@ protected:
     /** Reference to event queue for posting events */
     RingQueueInterface<callback_event_t> *event_queue {nullptr};
 
-    /** The epoch when the widget was last pressed */
-    unsigned last_press_epoch {0};
-
 public:
 
     /**
@@ -10,6 +10,7 @@
 
 #include "widgets/widget.h"
 #include "widgets/frame.h"
+#include "task.h"
 
 #include "WiFiS3.h"
 #include "cstring"
@@ -24,12 +25,21 @@ class DrawableCanvas : public BasicWidget {
 
 public:
 
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "DrawableCanvas";
+
+    /** Return the widget to the widget pool, counted against `TYPE_NAME` */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, TYPE_NAME);
+    }
+
     constexpr static unsigned WIDTH = 312;
     constexpr static unsigned HEIGHT = 312;
 
     constexpr static uint16_t DRAWABLE_W = WIDTH - 2;
     constexpr static uint16_t DRAWABLE_H = HEIGHT - 2;
     constexpr static unsigned MAX_INLINE_COMPRESSED_SEGMENTS = 9;
+    constexpr static unsigned TRANSFER_ROWS_PER_STEP = 10;
 
     /**
      * @brief               Class that provides a buffered TCP Stream to write to
@@ -173,10 +183,10 @@ protected:
     /** Radius of the pen stroke */
     unsigned pen_size {0};
 
-    /** IP Address of the server */
-    char server_ip[16] {0};
-    /** Port of the server */
-    uint16_t server_port {0};
+    /** IP Address of the server (shared, since it is set before the canvas is created) */
+    static char server_ip[16];
+    /** Port of the server (shared, since it is set before the canvas is created) */
+    static uint16_t server_port;
 
     /**
      * @brief           In-memory buffer to draw-on
@@ -197,6 +207,9 @@ protected:
     /** Compressed representation of a single row (used by member functions as buffer) */
     Compressor::canvas_row_t cur_row;
 
+    /** Row that the save/load task in progress is transferring */
+    unsigned transfer_row {0};
+
     /** Function to call when a drawing could successfully be saved/loaded */
     InteractiveWidget::callback_t on_success {nullptr};
     /** Function to call when a connection could not be established with the server */
@@ -271,13 +284,14 @@ public:
     /**
      * @brief                   Set the address of the server
      *
+     * @note                    The address is shared by all canvases, and can be set before the canvas is created (the view that
+     *                          holds the canvas is only built when it is first shown)
+     *
      * @param new_server_ip     IP address of the server (must be a valid IP address that is reachable)
      * @param new_server_port   Port on which the server is listening
      *
-     * @return                  Pointer to the canvas (allows chaining method calls)
-     *
      */
-    DrawableCanvas *set_server_addr(const char *new_server_ip, const uint16_t new_server_port);
+    static void set_server_addr(const char *new_server_ip, const uint16_t new_server_port);
 
     /**
      * @brief               Draw a stroke at a point
@@ -399,26 +413,42 @@ public:
     DrawableCanvas *reset_event_queue();
 
     /**
-     * @brief               Save the current drawing to the server
+     * @brief               Save the current drawing to the server (resumable task, see `task.h`)
+     *
+     * @note                Each call transfers `TRANSFER_ROWS_PER_STEP` rows, and the outcome is reported through the callbacks
      *
+     * @param task          State of the task (must be the same for every step of a transfer)
      * @param slot          The slot to save the drawing to (number between 0 and 255 inclusive)
      *
-     * @return true         If the drawing could successfully be saved
-     * @return false        If the drawing could not be saved
+     * @return TASK_RUNNING If the transfer is still in progress
+     * @return TASK_DONE    If the transfer has finished (successfully or not)
      *
      */
-    bool save_to_server(uint8_t slot);
+    task_status_t save_to_server(task_t *task, uint8_t slot);
 
     /**
-     * @brief               Load a drawing from the server to the canvas, overwriting its contents
+     * @brief               Load a drawing from the server to the canvas, overwriting its contents (resumable task, see `task.h`)
+     *
+     * @note                Each call transfers `TRANSFER_ROWS_PER_STEP` rows, and the outcome is reported through the callbacks
      *
+     * @param task          State of the task (must be the same for every step of a transfer)
      * @param slot          The slot to load the drawing from (number between 0 and 255)
      *
-     * @return true         If the drawing could succesfully be loaded
-     * @return false        If the drawing oculd not be loaded
+     * @return TASK_RUNNING If the transfer is still in progress
+     * @return TASK_DONE    If the transfer has finished (successfully or not)
+     *
+     */
+    task_status_t load_from_server(task_t *task, uint8_t slot);
+
+    /**
+     * @brief               Abandon the save/load in progress, reporting it as a communication failure
+     *
+     * @note                The task that was running the transfer must not be resumed again
+     *
+     * @return              Pointer to the canvas (allows chaining method calls)
      *
      */
-    bool load_from_server(uint8_t slot);
+    DrawableCanvas *abort_transfer();
 
     // BasicWidget overrides
 
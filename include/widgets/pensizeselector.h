@@ -21,9 +21,21 @@ protected:
 
     constexpr static unsigned H_PAD = 17;
 
+public:
+
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "PenSizeSelector";
+
+    /** Return the widget to the widget pool, counted against `TYPE_NAME` */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, TYPE_NAME);
+    }
+
     constexpr static unsigned WIDTH = 8 * H_PAD;
     constexpr static unsigned HEIGHT = 29;
 
+protected:
+
     /** Reference to parent frame */
     Frame *parent {nullptr};
 
@@ -67,9 +79,6 @@ protected:
     /** Reference to event queue for posting events */
     RingQueueInterface<callback_event_t> *event_queue {nullptr};
 
-    /** The epoch when the widget was last pressed */
-    unsigned last_press_epoch {0};
-
 public:
 
     /**
@@ -0,0 +1,157 @@
+/**
+ * @file                    bitmapasset.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the format of compressed bitmap assets, and the `BitmapDecoder` class which streams their pixels
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_BITMAPASSET_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_BITMAPASSET_H__
+
+#include "Arduino.h"
+
+/**
+ * @brief                   Bitmap stored in flash as a palette and a stream of run-length encoded pixel codes
+ *
+ *                          The stream is a sequence of tokens, each of which starts with a single byte -
+ *
+ *                           - `0x00` to `0x7F`: a literal of (byte + 1) pixels, each given by its own pixel code
+ *                           - `0x80` to `0xFE`: a run of (byte - 0x7F) copies of the single pixel code that follows
+ *                           - `0xFF`: a run whose length is stored in the next two bytes (little-endian), followed by a pixel code
+ *
+ *                          A pixel code is an index into the palette, except `BITMAP_ESCAPE_CODE`, which is followed by the
+ *                          16-bit color itself (little-endian). Pixels are stored row by row, from the top-left corner.
+ *
+ *                          Assets are generated from raw RGB565 arrays by the host tool in `tools/bitmapconv`
+ *
+ */
+struct bitmap_asset_t {
+
+    /** Number of columns in the bitmap */
+    uint16_t width;
+    /** Number of rows in the bitmap */
+    uint16_t height;
+
+    /** Colors that pixel codes refer to (atmost `BITMAP_ESCAPE_CODE` entries) */
+    const uint16_t *palette;
+
+    /** Encoded stream of tokens */
+    const uint8_t *data;
+    /** Number of bytes in the encoded stream */
+    uint32_t data_len;
+};
+
+/** Pixel code that indicates that the color is stored inline, instead of in the palette */
+constexpr uint8_t BITMAP_ESCAPE_CODE = 0xFF;
+
+/** First token byte that indicates a run (all smaller bytes indicate literals) */
+constexpr uint8_t BITMAP_RUN_TOKEN = 0x80;
+
+/** Token byte that indicates a run with a 16-bit length */
+constexpr uint8_t BITMAP_LONG_RUN_TOKEN = 0xFF;
+
+/**
+ * @brief                   Decoder that streams the pixels of a bitmap asset as horizontal spans, without decompressing the whole bitmap
+ *
+ *                          Runs are returned as filled spans (which cover whole rows at once when they start at the left
+ *                          edge), and literals are returned as short arrays of colors. A span never crosses the right edge of
+ *                          the bitmap
+ *
+ */
+class BitmapDecoder {
+
+public:
+
+    /** Maximum number of pixels in a span of literal colors */
+    constexpr static unsigned SPAN_PIXELS = 64;
+
+    /** Structure that describes a single span of decoded pixels */
+    struct span_t {
+
+        /** X-coordinate of the span within the bitmap */
+        uint16_t x;
+        /** Y-coordinate of the span within the bitmap */
+        uint16_t y;
+        /** Number of columns covered by the span */
+        uint16_t w;
+        /** Number of rows covered by the span (always 1 unless it is filled) */
+        uint16_t h;
+
+        /** Flag to indicate if every pixel of the span has the same color (`color`), or its own color (`pixels`) */
+        bool fill;
+        /** Color of every pixel, if the span is filled */
+        uint16_t color;
+        /** Colors of the pixels, if the span is not filled */
+        uint16_t pixels[SPAN_PIXELS];
+    };
+
+protected:
+
+    /** Reference to the asset being decoded */
+    const bitmap_asset_t *asset;
+
+    /** Position of the next unread byte of the stream */
+    const uint8_t *pos;
+    /** Position after the last byte of the stream */
+    const uint8_t *end;
+
+    /** X-coordinate of the next pixel */
+    uint16_t x {0};
+    /** Y-coordinate of the next pixel */
+    uint16_t y {0};
+
+    /** Number of pixels of the current token that have not been returned yet */
+    uint16_t remaining {0};
+    /** Flag to indicate if the current token is a run */
+    bool run {false};
+    /** Color of the current run */
+    uint16_t run_color {0};
+
+public:
+
+    /**
+     * @brief               Construct a decoder positioned at the first pixel of an asset
+     *
+     * @param asset         Reference to the asset to decode
+     *
+     */
+    BitmapDecoder(const bitmap_asset_t *asset);
+
+    /**
+     * @brief               Decode the next span of pixels
+     *
+     * @param span          Reference to the span to store the pixels in
+     *
+     * @return false        If all pixels have been decoded (or the stream is truncated)
+     * @return true         If a span was decoded
+     *
+     */
+    bool next_span(span_t *span);
+
+protected:
+
+    /**
+     * @brief               Read the header of the next token of the stream
+     *
+     * @return false        If the stream has ended
+     * @return true         If a token was read
+     *
+     */
+    bool read_token();
+
+    /**
+     * @brief               Read a single pixel code from the stream, and get its color
+     *
+     */
+    uint16_t read_pixel();
+
+    /**
+     * @brief               Move the position of the next pixel forward, wrapping around to the next row
+     *
+     * @param count         Number of pixels to move by
+     *
+     */
+    void advance(unsigned count);
+};
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * @file                    buslock.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `BusLock` class, which marks when the display bus is in use
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_BUSLOCK_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_BUSLOCK_H__
+
+#include "Arduino.h"
+
+/**
+ * @brief                   Lock that is held while the display bus is in use, so that interrupts can avoid the pins it shares
+ *
+ *                          The display and the touchscreen of the shield share pins. The `App` holds the lock while it talks
+ *                          to the display, and code that runs from interrupts (such as the touch sampler) checks it and backs
+ *                          off instead of waiting. The lock is only ever taken from the main context, and can be nested.
+ *
+ */
+class BusLock {
+
+public:
+
+    /**
+     * @brief               Holds the lock for the lifetime of the object
+     *
+     */
+    class Scope {
+
+    public:
+
+        Scope() { BusLock::acquire(); }
+        ~Scope() { BusLock::release(); }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+
+    /**
+     * @brief               Take the lock (must only be called from the main context)
+     *
+     */
+    static void acquire();
+
+    /**
+     * @brief               Give up the lock (must be paired with a previous call to `BusLock::acquire`)
+     *
+     */
+    static void release();
+
+    /**
+     * @brief               Check if the bus is in use (safe to call from interrupts)
+     *
+     */
+    static bool is_held();
+
+protected:
+
+    /** Number of times the lock has been taken and not yet given up */
+    static volatile uint8_t depth;
+};
+
+#endif
@@ -0,0 +1,138 @@
+/**
+ * @file                    fixedstring.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `FixedString` class, a string with inline storage of a fixed capacity
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_FIXEDSTRING_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_FIXEDSTRING_H__
+
+#include "Arduino.h"
+
+#include "cstring"
+
+/**
+ * @brief                   String with inline storage of a fixed capacity, which never allocates memory on the heap (template)
+ *
+ *                          Unlike the Arduino `String`, appending or removing characters does not reallocate, and therefore
+ *                          does not fragment the heap over the lifetime of the device. The contents are always null-terminated,
+ *                          and can be read without copying through `c_str`, `length` and the subscript operator.
+ *
+ * @note                    Writes that do not fit within the capacity are truncated
+ *
+ * @tparam CAPACITY         Maximum number of characters that can be stored (excluding the null terminator)
+ *
+ */
+template <unsigned CAPACITY>
+class FixedString {
+
+    static_assert(CAPACITY <= UINT8_MAX, "the length is stored in 8 bits");
+
+protected:
+
+    /** Storage for the characters and the null terminator */
+    char buf[CAPACITY + 1] {};
+
+    /** Number of characters in the string */
+    uint8_t len {0};
+
+public:
+
+    FixedString() = default;
+
+    FixedString(const char *str) {
+        assign(str);
+    }
+
+    FixedString &operator=(const char *str) {
+        assign(str);
+        return *this;
+    }
+
+    /**
+     * @brief               Replace the contents of the string
+     *
+     * @param str           Null-terminated string to copy (truncated to the capacity)
+     *
+     * @return              Reference to the string (allows chaining method calls)
+     *
+     */
+    FixedString &assign(const char *str) {
+
+        len = 0;
+        while (len < CAPACITY && str[len] != '\0') {
+            buf[len] = str[len];
+            ++len;
+        }
+        buf[len] = '\0';
+
+        return *this;
+    }
+
+    /**
+     * @brief               Append a character to the end of the string
+     *
+     * @param ch            Character to append
+     *
+     * @return false        If the string is full (the character is discarded)
+     * @return true         If the character was appended
+     *
+     */
+    bool push_back(char ch) {
+
+        if (len == CAPACITY) {
+            return false;
+        }
+
+        buf[len++] = ch;
+        buf[len] = '\0';
+
+        return true;
+    }
+
+    /**
+     * @brief               Remove the last character of the string (does nothing if the string is empty)
+     *
+     */
+    void pop_back() {
+
+        if (len == 0) {
+            return;
+        }
+
+        buf[--len] = '\0';
+    }
+
+    /**
+     * @brief               Remove all characters from the string
+     *
+     */
+    void clear() {
+        len = 0;
+        buf[0] = '\0';
+    }
+
+    /** Get a pointer to the null-terminated contents (valid until the string is modified) */
+    const char *c_str() const { return buf; }
+
+    /** Get the number of characters in the string */
+    unsigned length() const { return len; }
+
+    /** Check whether the string has no characters */
+    bool empty() const { return len == 0; }
+
+    /** Get the maximum number of characters that can be stored */
+    constexpr static unsigned capacity() { return CAPACITY; }
+
+    /** Get the character at a position (the position must be less than the length) */
+    char operator[](unsigned idx) const { return buf[idx]; }
+
+    /** Get the last character (the string must not be empty) */
+    char back() const { return buf[len - 1]; }
+
+    bool operator==(const char *str) const { return strcmp(buf, str) == 0; }
+    bool operator!=(const char *str) const { return strcmp(buf, str) != 0; }
+};
+
+#endif
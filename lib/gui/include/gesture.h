@@ -0,0 +1,179 @@
+/**
+ * @file                    gesture.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `GestureRecognizer` class, which turns the samples of the touchscreen into presses,
+ *                          releases and gestures
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_GESTURE_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_GESTURE_H__
+
+#include "Arduino.h"
+
+/**
+ * @brief                   Types of gestures
+ *
+ */
+enum gesture_type_t : uint8_t {
+
+    /** The stylus was lifted shortly after touching the screen, without moving */
+    GESTURE_TAP,
+    /** The stylus has rested on the screen for a while without moving (reported once, while the stylus is still down) */
+    GESTURE_LONG_PRESS,
+    /** The stylus moved while touching the screen (reported with every movement) */
+    GESTURE_DRAG,
+    /** The stylus was lifted slowly after a drag */
+    GESTURE_DRAG_END,
+    /** The stylus was lifted quickly after a drag */
+    GESTURE_SWIPE,
+};
+
+/**
+ * @brief                   Gesture that is dispatched to the widgets
+ *
+ */
+struct gesture_t {
+
+    /** Type of the gesture */
+    gesture_type_t type;
+
+    /** X-coordinate at which the stylus touched the screen (relative to the widget's parent while being dispatched) */
+    unsigned x;
+    /** Y-coordinate at which the stylus touched the screen (relative to the widget's parent while being dispatched) */
+    unsigned y;
+
+    /** Number of columns the stylus moved from where it touched the screen */
+    int16_t dx;
+    /** Number of rows the stylus moved from where it touched the screen */
+    int16_t dy;
+
+    /** Velocity of the stylus along the X-axis (in pixels per second) */
+    int16_t vx;
+    /** Velocity of the stylus along the Y-axis (in pixels per second) */
+    int16_t vy;
+
+    /** Time since the stylus touched the screen (in milliseconds) */
+    uint16_t duration;
+};
+
+/**
+ * @brief                   State machine that classifies the touches on the screen into gestures
+ *
+ *                          Each sample of the touchscreen is passed to `update`, which reports a gesture when one is
+ *                          recognized, along with the start and end of every touch (`get_press` and `get_release`).
+ *
+ *                          A touch that starts too soon after the last one is ignored entirely (no press, release or
+ *                          gestures are reported for it), so that widgets do not have to debounce presses themselves.
+ *
+ */
+class GestureRecognizer {
+
+public:
+
+    /** Minimum time between the starts of two touches (in milliseconds) */
+    constexpr static unsigned DEBOUNCE_THRESH = 200;
+
+    /** Time after which a touch that has not moved becomes a long press (in milliseconds) */
+    constexpr static unsigned LONG_PRESS_THRESH = 600;
+
+    /** Distance (along either axis) the stylus must move before a touch becomes a drag (in pixels) */
+    constexpr static unsigned DRAG_THRESH = 8;
+
+    /** Speed (along either axis) above which a drag that ends is a swipe (in pixels per second) */
+    constexpr static unsigned SWIPE_THRESH = 400;
+
+protected:
+
+    /** States of a touch */
+    enum state_t : uint8_t {
+        /** The stylus is not touching the screen */
+        STATE_IDLE,
+        /** The touch started too soon after the last one, and is ignored until the stylus is lifted */
+        STATE_IGNORED,
+        /** The stylus is touching the screen and has not moved */
+        STATE_PRESSED,
+        /** The stylus has rested long enough for a long press to be reported */
+        STATE_LONG_PRESSED,
+        /** The stylus has moved since touching the screen */
+        STATE_DRAGGING,
+    };
+
+    /** Current state of the touch */
+    state_t state {STATE_IDLE};
+
+    /** Time at which the last accepted touch started (in microseconds) */
+    uint32_t last_start_time {0};
+    /** Flag indicating if a touch has been accepted yet (the first touch is never debounced) */
+    bool has_started {false};
+
+    /** X-coordinate at which the current touch started */
+    unsigned start_x {0};
+    /** Y-coordinate at which the current touch started */
+    unsigned start_y {0};
+
+    /** X-coordinate of the last sample of the current touch */
+    unsigned last_x {0};
+    /** Y-coordinate of the last sample of the current touch */
+    unsigned last_y {0};
+    /** Time of the last sample of the current touch (in microseconds) */
+    uint32_t last_time {0};
+
+    /** Smoothed velocity along the X-axis (in pixels per second) */
+    int32_t vx {0};
+    /** Smoothed velocity along the Y-axis (in pixels per second) */
+    int32_t vy {0};
+
+    /** Flag indicating if an unconsumed press is available */
+    bool press_available {false};
+    /** Flag indicating if an unconsumed release is available */
+    bool release_available {false};
+
+public:
+
+    /**
+     * @brief               Pass the next sample of the touchscreen to the recognizer
+     *
+     * @param touched       Whether the screen is being touched
+     * @param x             X-coordinate of the touch (ignored if the screen is not being touched)
+     * @param y             Y-coordinate of the touch (ignored if the screen is not being touched)
+     * @param time          Time at which the sample was taken (in microseconds)
+     * @param gesture       Pointer to store the recognized gesture (unchanged if no gesture was recognized)
+     *
+     * @return true         If a gesture was recognized
+     * @return false        If no gesture was recognized
+     *
+     */
+    bool update(bool touched, unsigned x, unsigned y, uint32_t time, gesture_t *gesture);
+
+    /**
+     * @brief               Returns the coordinates at which the latest accepted touch started (if not yet consumed)
+     *
+     * @return true         If a press was available (the values pointed to by the pointers have been changed)
+     * @return false        If a press was not available (the values pointed to by the pointers have not been changed)
+     *
+     */
+    bool get_press(unsigned *x, unsigned *y);
+
+    /**
+     * @brief               Returns the coordinates of the latest accepted touch that ended (if not yet consumed)
+     *
+     * @note                The coordinates are those at which the touch started, so that the release reaches the same widget
+     *                      as the press
+     *
+     * @return true         If a release was available (the values pointed to by the pointers have been changed)
+     * @return false        If a release was not available (the values pointed to by the pointers have not been changed)
+     *
+     */
+    bool get_release(unsigned *x, unsigned *y);
+
+protected:
+
+    /**
+     * @brief               Fill a gesture with the current state of the touch
+     *
+     */
+    void make_gesture(gesture_type_t type, uint32_t time, gesture_t *gesture) const;
+};
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * @file                    glyphcache.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `GlyphCache` class, which stores the glyphs of fonts as run-length encoded masks
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_GLYPHCACHE_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_GLYPHCACHE_H__
+
+#include "Arduino.h"
+#include "Adafruit_GFX.h"
+
+/** Number of bytes available for the masks of cached glyphs (can be overridden from the build flags) */
+#ifndef GLYPH_CACHE_ARENA_BYTES
+#define GLYPH_CACHE_ARENA_BYTES 3584
+#endif
+
+/** Maximum number of glyphs that can be cached at once (can be overridden from the build flags) */
+#ifndef GLYPH_CACHE_MAX_ENTRIES
+#define GLYPH_CACHE_MAX_ENTRIES 80
+#endif
+
+/**
+ * @brief                   Cache of rasterized glyphs, which are drawn using horizontal span fills instead of per-pixel glyph rendering
+ *
+ *                          When a glyph is printed for the first time, each row of its bitmap is encoded as alternating runs
+ *                          of unset and set pixels, which are stored in a fixed-size arena. Subsequent prints of the glyph
+ *                          (in any string, with the same font) only fill the set runs on the display.
+ *
+ *                          Glyphs are keyed by their font and character, so the keys of the keyboard share their glyphs with
+ *                          every other string. The default arena holds the digits and both cases of the letters in the font
+ *                          of the keys (3.2KB), so that toggling shift back and forth only misses on the first toggle.
+ *
+ *                          When the arena or the table of entries is full, the least recently used glyphs are evicted
+ *
+ */
+class GlyphCache {
+
+public:
+
+    /** Number of bytes available for the masks of cached glyphs */
+    constexpr static unsigned ARENA_BYTES = GLYPH_CACHE_ARENA_BYTES;
+
+    /** Maximum number of glyphs that can be cached at once */
+    constexpr static unsigned MAX_ENTRIES = GLYPH_CACHE_MAX_ENTRIES;
+
+protected:
+
+    /** Structure that describes a single cached glyph (the position and size of the glyph are read from the font) */
+    struct entry_t {
+        const GFXfont *font;
+        uint16_t offset;
+        uint16_t size;
+        uint16_t last_used;
+        uint8_t ch;
+    };
+
+    /** Storage for the masks of the glyphs */
+    uint8_t arena[ARENA_BYTES];
+
+    /** Number of bytes of the arena that are in use (entries are packed from the start of the arena) */
+    unsigned arena_used {0};
+
+    /** Table of cached glyphs, in the order in which they are laid out in the arena */
+    entry_t entries[MAX_ENTRIES];
+
+    /** Number of cached glyphs */
+    unsigned num_entries {0};
+
+    /** Counter used to order entries by their most recent use */
+    uint16_t clock {0};
+
+    /** Number of glyphs served from the cache */
+    unsigned long hits {0};
+    /** Number of glyphs that required encoding their bitmap */
+    unsigned long misses {0};
+
+public:
+
+    /**
+     * @brief               Print a string with a transparent background, using the cached masks of its glyphs
+     *
+     * @param display       Reference to the display to print on
+     * @param font          The font that the string is printed with (must also be the display's current font)
+     * @param text          String to print
+     * @param x             X-coordinate of the text origin (offset from left-edge)
+     * @param y             Y-coordinate of the text baseline (offset from top-edge)
+     * @param color         16-bit color of the text
+     *
+     * @return false        If the string would be wrapped or spans several lines (nothing was printed, and the caller must
+     *                      print it in the usual way)
+     * @return true         If the string was printed
+     *
+     */
+    bool print(Adafruit_GFX *display, const GFXfont *font, const char *text, unsigned x, unsigned y, uint16_t color);
+
+    /**
+     * @brief               Evict all cached glyphs
+     *
+     */
+    void clear();
+
+    /** Get the number of glyphs served from the cache */
+    unsigned long get_hits() const { return hits; }
+
+    /** Get the number of glyphs that required encoding their bitmap */
+    unsigned long get_misses() const { return misses; }
+
+protected:
+
+    /**
+     * @brief               Find the cached entry of a glyph
+     *
+     * @return              Index of the entry, or `num_entries` if the glyph is not cached
+     *
+     */
+    unsigned find(const GFXfont *font, uint8_t ch) const;
+
+    /**
+     * @brief               Encode a glyph and add it to the cache, evicting the least recently used entries if needed
+     *
+     * @return              Index of the new entry, or `num_entries` if the glyph could not be cached
+     *
+     */
+    unsigned insert(const GFXfont *font, uint8_t ch);
+
+    /**
+     * @brief               Encode the bitmap of a glyph as runs
+     *
+     * @param glyph         The glyph to encode
+     * @param bitmap        Bitmap of the glyph's font
+     * @param out           Pointer to store the runs (`nullptr` to only measure them)
+     *
+     * @return              Number of bytes of the encoded glyph, or 0 if a row has too many runs to be encoded
+     *
+     */
+    static unsigned encode(const GFXglyph &glyph, const uint8_t *bitmap, uint8_t *out);
+
+    /**
+     * @brief               Remove an entry and compact the arena
+     *
+     * @param idx           Index of the entry
+     *
+     */
+    void evict(unsigned idx);
+
+    /**
+     * @brief               Fill the set runs of a glyph's mask on the display
+     *
+     */
+    void blit(Adafruit_GFX *display, const GFXglyph &glyph, const entry_t &entry, signed x, signed y, uint16_t color) const;
+};
+
+#endif
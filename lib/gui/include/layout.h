@@ -0,0 +1,125 @@
+/**
+ * @file                    layout.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `rect_t` struct and functions to describe layouts that are computed at compile-time
+ *
+ *                          Each rectangle is described relative to one that was already placed (to its right, below it, in a
+ *                          grid with it, inside it), so that moving or resizing a widget moves everything that depends on it.
+ *                          All of the functions are constexpr, and layouts declared as `constexpr rect_t` cost nothing at
+ *                          runtime -
+ *
+ *                              constexpr rect_t SAVE_RECT {10, 10, 64, 30};
+ *                              constexpr rect_t LOAD_RECT = right_of(SAVE_RECT, 3);
+ *
+ *                              Button::create(parent, LOAD_RECT.x, LOAD_RECT.y, LOAD_RECT.w, LOAD_RECT.h);
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_LAYOUT_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_LAYOUT_H__
+
+/**
+ * @brief                   Rectangle occupied by a widget, relative to its parent
+ *
+ */
+struct rect_t {
+
+    /** X-coordinate of the rectangle (offset from left-edge of the parent) */
+    unsigned x;
+    /** Y-coordinate of the rectangle (offset from top-edge of the parent) */
+    unsigned y;
+
+    /** Number of columns occupied */
+    unsigned w;
+    /** Number of rows occupied */
+    unsigned h;
+
+    /** X-coordinate of the first column to the right of the rectangle */
+    constexpr unsigned right() const { return x + w; }
+    /** Y-coordinate of the first row below the rectangle */
+    constexpr unsigned bottom() const { return y + h; }
+};
+
+/**
+ * @brief                   Place a rectangle to the right of another one, with their top-edges aligned
+ *
+ * @param r                 Rectangle to place next to
+ * @param gap               Number of columns between the two rectangles (negative to overlap their borders)
+ * @param w                 Number of columns occupied by the new rectangle
+ * @param h                 Number of rows occupied by the new rectangle
+ *
+ */
+constexpr rect_t right_of(const rect_t &r, signed gap, unsigned w, unsigned h) {
+    return {r.right() + gap, r.y, w, h};
+}
+
+/**
+ * @brief                   Place a rectangle of the same size to the right of another one, with their top-edges aligned
+ *
+ */
+constexpr rect_t right_of(const rect_t &r, signed gap) {
+    return right_of(r, gap, r.w, r.h);
+}
+
+/**
+ * @brief                   Place a rectangle below another one, with their left-edges aligned
+ *
+ * @param r                 Rectangle to place below
+ * @param gap               Number of rows between the two rectangles (negative to overlap their borders)
+ * @param w                 Number of columns occupied by the new rectangle
+ * @param h                 Number of rows occupied by the new rectangle
+ *
+ */
+constexpr rect_t below(const rect_t &r, signed gap, unsigned w, unsigned h) {
+    return {r.x, r.bottom() + gap, w, h};
+}
+
+/**
+ * @brief                   Place a rectangle of the same size below another one, with their left-edges aligned
+ *
+ */
+constexpr rect_t below(const rect_t &r, signed gap) {
+    return below(r, gap, r.w, r.h);
+}
+
+/**
+ * @brief                   Get the area inside a frame after leaving a margin on each side
+ *
+ * @note                    The area is relative to the frame itself, so that it can be used to place the frame's children
+ *
+ * @param frame             Rectangle occupied by the frame (only its size is used)
+ * @param h_pad             Number of columns left on the left and right
+ * @param v_pad             Number of rows left on the top and bottom
+ *
+ */
+constexpr rect_t inset(const rect_t &frame, unsigned h_pad, unsigned v_pad) {
+    return {h_pad, v_pad, frame.w - (2 * h_pad), frame.h - (2 * v_pad)};
+}
+
+/**
+ * @brief                   Place a rectangle at the bottom of an area, spanning its width
+ *
+ * @param area              Area to place the rectangle in
+ * @param margin            Number of rows between the bottom-edges of the rectangle and the area
+ * @param h                 Number of rows occupied by the rectangle
+ *
+ */
+constexpr rect_t bottom_of(const rect_t &area, unsigned margin, unsigned h) {
+    return {area.x, area.bottom() - margin - h, area.w, h};
+}
+
+/**
+ * @brief                   Place a rectangle in a cell of a grid whose first cell is a given rectangle
+ *
+ * @param first             Rectangle of the top-left cell (all cells have the same size)
+ * @param col               Column of the cell
+ * @param row               Row of the cell
+ * @param h_gap             Number of columns between adjacent cells
+ * @param v_gap             Number of rows between adjacent cells
+ *
+ */
+constexpr rect_t grid_cell(const rect_t &first, unsigned col, unsigned row, unsigned h_gap, unsigned v_gap) {
+    return {first.x + (col * (first.w + h_gap)), first.y + (row * (first.h + v_gap)), first.w, first.h};
+}
+
+#endif
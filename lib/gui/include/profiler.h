@@ -0,0 +1,219 @@
+/**
+ * @file                    profiler.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares a lightweight frame-time profiler with scoped zones, which can be compiled out entirely
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_PROFILER_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_PROFILER_H__
+
+#include "Arduino.h"
+
+/** If defined, profiling zones are timed and recorded (otherwise all the profiling macros expand to nothing) */
+// #define PROFILER_ENABLED
+
+/**
+ * @brief                   Identifiers of the zones that can be timed by the profiler
+ *
+ *                          The loop phases correspond to the steps of the main loop, the filter zones correspond to the
+ *                          stages of the touch filter, and the draw zones correspond
+ *                          to the `draw` method of each widget class (a widget that inherits its `draw` method, such as the
+ *                          `TextBox` or `Keyboard`, is recorded under the zone of its base class). The text zone covers every
+ *                          call to `App::print`, cached or not, so that the glyph cache can be compared against the library.
+ *
+ * @note                    The time recorded for a zone includes the time spent in all the zones nested inside it
+ *
+ */
+enum profile_zone_t : uint8_t {
+
+    PROFILE_LOOP,
+    PROFILE_READ_SCREEN,
+    PROFILE_PROPAGATE_RELEASE,
+    PROFILE_PROPAGATE_PRESS,
+    PROFILE_COLLECT_DIRTY,
+    PROFILE_UPDATE_DIRTY,
+    PROFILE_EXECUTE_EVENTS,
+    PROFILE_DRAW_AT,
+
+    PROFILE_FILTER_MEDIAN,
+    PROFILE_FILTER_SMOOTHING,
+    PROFILE_FILTER_GATE,
+
+    PROFILE_DRAW_VIEW,
+    PROFILE_DRAW_WINDOW,
+    PROFILE_DRAW_BUTTON,
+    PROFILE_DRAW_LABEL,
+    PROFILE_DRAW_BITMAP,
+    PROFILE_DRAW_CANVAS,
+    PROFILE_DRAW_COLOR_SELECTOR,
+    PROFILE_DRAW_PEN_SIZE_SELECTOR,
+
+    PROFILE_PRINT_TEXT,
+
+    PROFILE_ZONE_COUNT
+};
+
+#ifdef PROFILER_ENABLED
+
+/**
+ * @brief                   Collects timing statistics for every zone and reports them on request
+ *
+ *                          On the device, time is measured with the Cortex-M4 cycle counter (DWT), while on the host
+ *                          it is measured using `std::chrono`
+ *
+ *                          For each zone, the number of samples and the min/avg/max duration is tracked, along with a
+ *                          logarithmic histogram which is used to estimate the 99th percentile
+ *
+ */
+class Profiler {
+
+public:
+
+    /** Data-type of a raw timestamp (cycles on the device, nanoseconds on the host) */
+    using tick_t = uint32_t;
+
+    /** Number of buckets in the histogram of each zone (two buckets per power of two microseconds) */
+    constexpr static unsigned NUM_BUCKETS = 48;
+
+    /** Statistics collected for a single zone */
+    struct zone_stats_t {
+        uint32_t count;
+        uint32_t min_us;
+        uint32_t max_us;
+        uint64_t total_us;
+        uint16_t buckets[NUM_BUCKETS];
+    };
+
+    /**
+     * @brief               Initialize the timing source and clear all statistics
+     *
+     * @note                This must be called once before any zone is timed
+     *
+     */
+    static void begin();
+
+    /**
+     * @brief               Clear the statistics of all zones
+     *
+     * @note                Zones that are being timed when this is called are not recorded when they end, since their
+     *                      duration includes the time spent before the reset (such as printing the report)
+     *
+     */
+    static void reset();
+
+    /**
+     * @brief               Get the number of times the statistics have been cleared (used to discard zones that span a reset)
+     *
+     */
+    static uint32_t get_generation();
+
+    /**
+     * @brief               Get the current timestamp
+     *
+     * @return tick_t       Current value of the timing source
+     *
+     */
+    static tick_t now();
+
+    /**
+     * @brief               Record a single sample for a zone
+     *
+     * @param zone          The zone whose statistics must be updated
+     * @param elapsed       Number of ticks spent in the zone
+     *
+     */
+    static void record(profile_zone_t zone, tick_t elapsed);
+
+    /**
+     * @brief               Get the statistics collected for a zone
+     *
+     * @param zone          The zone whose statistics are required
+     *
+     * @return              Reference to the statistics of the zone
+     *
+     */
+    static const zone_stats_t &get_stats(profile_zone_t zone);
+
+    /**
+     * @brief               Estimate the 99th percentile duration of a zone (upper edge of the histogram bucket it lies in)
+     *
+     * @param zone          The zone whose percentile is required
+     *
+     * @return uint32_t     Estimated 99th percentile duration (in microseconds)
+     *
+     */
+    static uint32_t get_p99_us(profile_zone_t zone);
+
+    /**
+     * @brief               Print a table of the statistics of all zones that have been sampled atleast once
+     *
+     * @param out           Reference to the stream on which the report is printed
+     *
+     */
+    static void report(Print *out);
+
+protected:
+
+    /** Statistics of every zone */
+    static zone_stats_t stats[PROFILE_ZONE_COUNT];
+
+    /** Number of ticks of the timing source in one microsecond */
+    static uint32_t ticks_per_us;
+
+    /** Number of times the statistics have been cleared */
+    static uint32_t generation;
+};
+
+/**
+ * @brief                   Times the scope it is declared in and records it as a sample of a zone when the scope ends
+ *
+ */
+class ProfileScope {
+
+    /** Zone that this scope is recorded under */
+    profile_zone_t zone;
+
+    /** Timestamp at which the scope was entered */
+    Profiler::tick_t start;
+
+    /** Generation of the statistics when the scope was entered */
+    uint32_t generation;
+
+public:
+
+    ProfileScope(profile_zone_t zone)
+    : zone {zone}
+    , start {Profiler::now()}
+    , generation {Profiler::get_generation()}
+    {}
+
+    ~ProfileScope() {
+        if (generation == Profiler::get_generation()) {
+            Profiler::record(zone, Profiler::now() - start);
+        }
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+};
+
+#define PROFILE_CONCAT_IMPL(a, b)   a##b
+#define PROFILE_CONCAT(a, b)        PROFILE_CONCAT_IMPL(a, b)
+
+/** Initialize the profiler */
+#define PROFILE_BEGIN()             Profiler::begin()
+/** Time the rest of the enclosing scope under a zone */
+#define PROFILE_ZONE(zone)          ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__) (zone)
+/** Print a report of all zones on a stream and clear the statistics */
+#define PROFILE_REPORT(out)         do { Profiler::report(out); Profiler::reset(); } while (0)
+
+#else
+
+#define PROFILE_BEGIN()             do {} while (0)
+#define PROFILE_ZONE(zone)          do {} while (0)
+#define PROFILE_REPORT(out)         do {} while (0)
+
+#endif
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file                    sharedstyle.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `SharedStyle` class, a reference to a style object that is shared between widgets
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_SHAREDSTYLE_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_SHAREDSTYLE_H__
+
+#include "new"
+
+#include "widgetpool.h"
+
+/**
+ * @brief                   Reference to a style that is shared with other widgets, and copied on the first write (template)
+ *
+ *                          Widgets that look the same point to a single style object (usually a `static const` one), instead
+ *                          of each carrying a copy of it. When a single widget is customized through `get_mutable`, the
+ *                          style is first copied into the widget pool, and only that widget points to the copy from then on.
+ *
+ * @warning                 If a copy cannot be allocated, `get_mutable` returns a scratch object and the changes are discarded
+ *
+ * @tparam T                Type of the style (must have a static `TYPE_NAME` string, used for the statistics of the pool)
+ *
+ */
+template <typename T>
+class SharedStyle {
+
+protected:
+
+    /** Style that is currently in use (either shared or owned) */
+    const T *style;
+
+    /** Private copy of the style owned by this reference (nullptr while the style is shared) */
+    T *owned {nullptr};
+
+public:
+
+    SharedStyle() = delete;
+    SharedStyle(const SharedStyle &) = delete;
+    SharedStyle &operator=(const SharedStyle &) = delete;
+
+    SharedStyle(const T *shared)
+        : style {shared}
+    {}
+
+    ~SharedStyle() {
+        release();
+    }
+
+    /**
+     * @brief               Point to a shared style, discarding the private copy (if any)
+     *
+     * @param shared        Reference to the shared style (must outlive the widget)
+     *
+     */
+    void set_shared(const T *shared) {
+        release();
+        style = shared;
+    }
+
+    /**
+     * @brief               Get a reference to a style that can be changed without affecting other widgets
+     *
+     * @return              Pointer to the private copy of the style (created if required)
+     *
+     */
+    T *get_mutable() {
+
+        static T scratch;
+
+        if (owned != nullptr) {
+            return owned;
+        }
+
+        void *mem = WidgetPool::allocate(sizeof(T), T::TYPE_NAME);
+        if (mem == nullptr) {
+            scratch = *style;
+            return &scratch;
+        }
+
+        owned = new (mem) T(*style);
+        style = owned;
+
+        return owned;
+    }
+
+    /**
+     * @brief               Check if the style is a private copy
+     *
+     */
+    bool is_owned() const { return owned != nullptr; }
+
+    const T *operator->() const { return style; }
+    const T &operator*() const { return *style; }
+
+protected:
+
+    /**
+     * @brief               Free the private copy of the style (if any)
+     *
+     */
+    void release() {
+
+        if (owned == nullptr) {
+            return;
+        }
+
+        owned->~T();
+        WidgetPool::release(owned, sizeof(T), T::TYPE_NAME);
+        owned = nullptr;
+    }
+};
+
+#endif
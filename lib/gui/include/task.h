@@ -0,0 +1,163 @@
+/**
+ * @file                    task.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares stackless cooperative tasks (protothreads), which allow long-running callbacks to be split into resumable steps
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TASK_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TASK_H__
+
+#include "Arduino.h"
+
+/**
+ * @brief                   Status reported by a task each time it is resumed
+ *
+ */
+enum task_status_t : uint8_t {
+    TASK_RUNNING,
+    TASK_DONE
+};
+
+/**
+ * @brief                   State of a stackless task, which is all that is preserved between two resumptions
+ *
+ *                          A task is a function that is called repeatedly (once per frame) until it reports that it is done.
+ *                          The function body must be enclosed between `TASK_BEGIN` and `TASK_END`, and may suspend itself using
+ *                          `TASK_YIELD`, `TASK_AWAIT` or `TASK_SLEEP`. Each time it is resumed, execution continues from the point
+ *                          where it was suspended.
+ *
+ * @warning                 Local variables are not preserved across suspension points (there is no stack per task), and
+ *                          any state that must survive a suspension has to be stored outside the function (for example, in
+ *                          the object that is passed as an argument). A `switch` statement must not enclose a suspension point,
+ *                          and there can be atmost one suspension point per line.
+ *
+ */
+struct task_t {
+
+    /** Line at which the task was suspended (0 if the task has not started yet) */
+    uint16_t line {0};
+
+    /** Timestamp at which a sleeping task should wake up (in milliseconds) */
+    unsigned long wake {0};
+};
+
+/** Data-type of a task function, which is passed its state and arguments each time it is resumed */
+using task_fn_t = task_status_t (*)(task_t *, unsigned *);
+
+/**
+ * @brief                   Fixed table of running tasks, each of which is resumed once per call to `execute`
+ *
+ */
+class TaskScheduler {
+
+public:
+
+    /** Maximum number of tasks that can be running at once */
+    constexpr static unsigned CAPACITY = 4;
+
+protected:
+
+    /** Structure that holds a single running task */
+    struct task_slot_t {
+        task_fn_t fn;
+        unsigned *args;
+        task_t state;
+    };
+
+    /** Table of running tasks (in the order in which they were started) */
+    task_slot_t tasks[CAPACITY];
+
+    /** Number of occupied slots in `tasks` (finished and cancelled tasks keep their slot until `execute` returns) */
+    unsigned num_tasks {0};
+
+    /** Flag indicating if the tasks are being resumed (the slots must not move while this is set) */
+    bool executing {false};
+
+public:
+
+    /**
+     * @brief               Start a task, which is first resumed on the next call to `execute`
+     *
+     * @param fn            The task function
+     * @param args          The arguments to pass to the task function each time it is resumed
+     *
+     * @note                The slot of a task that finishes or is cancelled while `execute` runs is only freed once it returns
+     *
+     * @return false        If the maximum number of running tasks has been reached
+     * @return true         If the task was started
+     *
+     */
+    bool start(task_fn_t fn, unsigned *args);
+
+    /**
+     * @brief               Check whether a task function is currently running
+     *
+     * @return false        If no running task uses this function
+     * @return true         If atleast one running task uses this function
+     *
+     */
+    bool is_running(task_fn_t fn) const;
+
+    /**
+     * @brief               Stop every running task that uses a function, without resuming it again
+     *
+     * @note                The task function is not told that it was cancelled, and must not hold resources across a yield
+     *                      that only the task itself can release
+     *
+     * @return              Number of tasks that were stopped
+     *
+     */
+    unsigned cancel(task_fn_t fn);
+
+    /**
+     * @brief               Get the number of running tasks
+     *
+     */
+    unsigned get_count() const;
+
+    /**
+     * @brief               Resume every running task once, and remove the tasks that finish
+     *
+     * @note                Tasks started while this method runs are first resumed on its next call
+     * @note                A task may cancel any task (including itself), and a cancelled task is not resumed again, even
+     *                      later in the same call
+     *
+     */
+    void execute();
+
+protected:
+
+    /**
+     * @brief               Remove a task from the table, keeping the order of the remaining tasks
+     *
+     */
+    void remove(unsigned idx);
+
+    /**
+     * @brief               Remove the tasks that finished or were cancelled while the tasks were resumed, keeping the order of
+     *                      the remaining tasks
+     *
+     */
+    void sweep();
+};
+
+/** Start the body of a task (must be the first statement of the task function) */
+#define TASK_BEGIN(task)            switch ((task)->line) { case 0:
+
+/** End the body of a task (must be the last statement of the task function) */
+#define TASK_END(task)              } (task)->line = 0; return TASK_DONE
+
+/** Finish the task early, from anywhere within its body */
+#define TASK_EXIT(task)             do { (task)->line = 0; return TASK_DONE; } while (0)
+
+/** Suspend the task until it is next resumed (the next frame) */
+#define TASK_YIELD(task)            do { (task)->line = __LINE__; return TASK_RUNNING; case __LINE__:; } while (0)
+
+/** Suspend the task until a condition holds (the condition is re-evaluated every time the task is resumed) */
+#define TASK_AWAIT(task, cond)      do { (task)->line = __LINE__; case __LINE__: if (!(cond)) { return TASK_RUNNING; } } while (0)
+
+/** Suspend the task for atleast the given number of milliseconds */
+#define TASK_SLEEP(task, ms)        do { (task)->wake = millis() + (ms); TASK_AWAIT(task, (long)(millis() - (task)->wake) >= 0); } while (0)
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * @file                    widgetpool.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `WidgetPool` class, a static arena that all widgets are allocated from
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_WIDGETPOOL_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_WIDGETPOOL_H__
+
+#include "Arduino.h"
+
+/** Number of bytes reserved for widgets (can be overridden from the build flags, enough for the widgets of all four views by default) */
+// the widgets of all four views take 11424 bytes once rounded up to the size classes (the canvas falls back to the heap), and
+// the 17 widgets customized through `get_style` take a 32 byte copy of their style each (544 bytes, a widget copies its style
+// atmost once however often `get_style` is called), which leaves 832 bytes to spare; check `WidgetPool::report` after adding
+// widgets or calls to `get_style`
+#ifndef WIDGET_POOL_BYTES
+#define WIDGET_POOL_BYTES 12800
+#endif
+
+/**
+ * @brief                   Static arena that widgets are allocated from, instead of being scattered across the heap
+ *
+ *                          Allocations are rounded up to one of a fixed set of size classes and carved from the arena in
+ *                          order. Freed blocks are kept on a free list per size class, and are reused by later allocations
+ *                          of the same class. Allocations that are larger than the largest class, or that do not fit in
+ *                          the remaining space, fall back to the heap and are counted.
+ *
+ *                          The number of objects and bytes of each widget type that are currently allocated are tracked,
+ *                          so that the capacity can be tuned with `WIDGET_POOL_BYTES`
+ *
+ */
+class WidgetPool {
+
+public:
+
+    /** Number of bytes in the arena */
+    constexpr static unsigned ARENA_BYTES = WIDGET_POOL_BYTES;
+
+    /** Alignment of every block (suitable for any widget) */
+    constexpr static unsigned ALIGNMENT = 8;
+
+    /** Sizes of the blocks of each class (in increasing order) */
+    constexpr static uint16_t CLASS_SIZES[] {
+        16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176, 192, 208, 224, 240, 256,
+        320, 384, 448, 512, 768, 1024
+    };
+
+    /** Number of size classes */
+    constexpr static unsigned NUM_CLASSES = sizeof(CLASS_SIZES) / sizeof(CLASS_SIZES[0]);
+
+    /** Maximum number of widget types whose allocations are tracked separately */
+    constexpr static unsigned MAX_TYPES = 16;
+
+    static_assert(ARENA_BYTES % ALIGNMENT == 0, "the arena must be a whole number of aligned blocks");
+
+    /** Allocation statistics of a single widget type */
+    struct type_stats_t {
+        /** Name of the type (nullptr for unused entries) */
+        const char *name;
+        /** Number of live objects of the type allocated from the arena */
+        uint16_t pool_count;
+        /** Number of live objects of the type allocated from the heap */
+        uint16_t heap_count;
+        /** Number of bytes of the arena held by the type (including the rounding to size classes) */
+        uint32_t pool_bytes;
+        /** Number of bytes of the heap held by the type */
+        uint32_t heap_bytes;
+    };
+
+    /**
+     * @brief               Allocate memory for a widget
+     *
+     * @param size          Number of bytes required
+     * @param type_name     Name of the widget's type (must be a string with static storage, since only the pointer is kept)
+     *
+     * @return              Pointer to the memory (nullptr if it could not be allocated from either the arena or the heap)
+     *
+     */
+    static void *allocate(size_t size, const char *type_name);
+
+    /**
+     * @brief               Free memory allocated with `WidgetPool::allocate`
+     *
+     * @param ptr           Pointer to the memory (does nothing if this is a nullptr)
+     * @param size          Number of bytes that were requested when allocating the memory
+     * @param type_name     Name that was given when allocating the memory (nullptr if unknown, the statistics are then
+     *                      left unchanged)
+     *
+     */
+    static void release(void *ptr, size_t size, const char *type_name);
+
+    /**
+     * @brief               Get the number of bytes of the arena that have been carved into blocks
+     *
+     */
+    static unsigned get_arena_used();
+
+    /**
+     * @brief               Get the number of allocations that fell back to the heap
+     *
+     */
+    static unsigned get_heap_fallbacks();
+
+    /**
+     * @brief               Print the usage of the arena and a table of the allocations of each widget type
+     *
+     * @param out           Reference to the stream on which the report is printed
+     *
+     */
+    static void report(Print *out);
+
+protected:
+
+    /** Storage for the blocks */
+    alignas(ALIGNMENT) static uint8_t arena[ARENA_BYTES];
+
+    /** Number of bytes from the start of the arena that have been carved into blocks */
+    static unsigned arena_used;
+
+    /** Head of the list of free blocks of each class (the first bytes of a free block point to the next one) */
+    static void *free_lists[NUM_CLASSES];
+
+    /** Number of allocations that fell back to the heap */
+    static unsigned heap_fallbacks;
+
+    /** Allocation statistics of each widget type, in the order in which the types were first allocated */
+    static type_stats_t types[MAX_TYPES];
+
+    /**
+     * @brief               Get the smallest class whose blocks can hold an allocation
+     *
+     * @return              Index of the class (`NUM_CLASSES` if the allocation is larger than every class)
+     *
+     */
+    static unsigned get_class(size_t size);
+
+    /**
+     * @brief               Get the statistics entry of a widget type, creating it if required
+     *
+     * @return              Pointer to the entry (nullptr if the name is a nullptr, or all entries are used by other types)
+     *
+     */
+    static type_stats_t *get_type(const char *type_name);
+};
+
+#endif
@@ -16,6 +16,9 @@
 
 #include "widget.h"
 #include "frame.h"
+#include "glyphcache.h"
+#include "eventqueue.h"
+#include "task.h"
 
 class View;
 
@@ -33,8 +36,57 @@ class App : public BasicWidget, public DrawableWidget {
 
     friend class View;
 
+public:
+
+    /** Phases of the main loop that are run at independent rates by the scheduler */
+    enum schedule_phase_t : uint8_t {
+        PHASE_INPUT,
+        PHASE_RENDER,
+        PHASE_BACKGROUND,
+        PHASE_COUNT
+    };
+
+    /** Maximum number of timers that can be pending at once */
+    constexpr static unsigned TIMER_CAPACITY = 8;
+
+    /** Identifier of a timer, used to cancel it (0 is never a valid identifier) */
+    using timer_id_t = unsigned;
+
+    /** Maximum number of tasks that can be running at once */
+    constexpr static unsigned TASK_CAPACITY = TaskScheduler::CAPACITY;
+
+    /** Number of colors copied into RAM and pushed to the display at once while streaming into a window */
+    constexpr static unsigned WRITE_CHUNK_PIXELS = 64;
+
+    /** Maximum number of views that can be registered as factories */
+    constexpr static unsigned VIEW_FACTORY_CAPACITY = 8;
+
+    /** Identifier of a view registered as a factory (0 is never a valid identifier) */
+    using view_id_t = unsigned;
+
+    /** Function that creates a view along with all of its widgets (returns nullptr if the view could not be created) */
+    using view_factory_t = View *(*)();
+
 protected:
 
+    /** Structure that holds a single pending timer */
+    struct timer_entry_t {
+        unsigned long deadline;
+        unsigned long period;
+        InteractiveWidget::callback_t cb;
+        unsigned *args;
+        timer_id_t id;
+        unsigned pass;
+    };
+
+    /** Structure that holds a single view registered as a factory */
+    struct view_entry_t {
+        view_factory_t factory;
+        View *view;
+        unsigned long idle_timeout;
+        unsigned long last_active;
+    };
+
 #ifdef MCUFRIEND_KBV_H_
     using display_t = MCUFRIEND_kbv;
 #else
@@ -44,18 +96,68 @@ protected:
     /** Reference to the display object */
     display_t *display {nullptr};
 
+    /** Font that is currently set on the display (used to skip redundant font switches) */
+    const GFXfont *current_font {nullptr};
+
+    /** Flag to indicate if the next colors streamed into the window start a new transfer */
+    bool write_first {false};
+
+#ifdef GLYPH_CACHE_ENABLED
+    /** Cache of glyphs that have already been rasterized */
+    GlyphCache glyph_cache;
+#endif
+
     /** The list of views that are owned by this app */
     std::vector<View *> views;
 
     /** Reference the view that is currently active */
     View *active_view {nullptr};
 
-    /** Queue of events to execute (widgets have a reference to this queue ana post events to it) */
-    RingQueue<InteractiveWidget::callback_event_t, 8> event_queue;
+    /** Table of views registered as factories (the identifier of a view is its position plus one) */
+    view_entry_t view_entries[VIEW_FACTORY_CAPACITY];
+
+    /** Number of views registered as factories */
+    unsigned num_view_entries {0};
+
+    /** Queue of events to execute, by priority (widgets have a reference to this queue ana post events to it) */
+    EventQueue<8> event_queue;
 
     /** Queue of dirty widgets to be re-drawn (a widget that is lower on the z-axis has a higher position in the queue) */
     RingQueue<BasicWidget *, 48> dirty_widgets;
 
+    /** Interval between consecutive runs of each phase (in microseconds) */
+    unsigned long phase_interval[PHASE_COUNT] {4000, 16000, 10000};
+
+    /** Timestamp at which each phase is next due (in microseconds) */
+    unsigned long phase_deadline[PHASE_COUNT] {};
+
+    /** Number of times each phase ran more than one interval late */
+    unsigned long deadline_misses[PHASE_COUNT] {};
+
+    /** Maximum time that a single call to `update_dirty_widgets` may take while stroke input is active (in microseconds, 0 to disable) */
+    unsigned long frame_budget {8000};
+
+    /** Number of frames in which redraws were deferred to honour the frame budget */
+    unsigned long budget_overruns {0};
+
+    /** Whether the user is currently drawing a stroke (redraws are throttled while this is set) */
+    bool stroke_active {false};
+
+    /** Min-heap of pending timers, ordered by their deadlines */
+    timer_entry_t timers[TIMER_CAPACITY];
+
+    /** Number of pending timers */
+    unsigned num_timers {0};
+
+    /** Identifier that will be given to the next timer */
+    timer_id_t next_timer_id {1};
+
+    /** Number of times the timers have been executed (timers created during a pass only run from the next pass onwards) */
+    unsigned timer_pass {0};
+
+    /** Running tasks */
+    TaskScheduler tasks;
+
 public:
 
     /**
@@ -88,6 +190,53 @@ public:
      */
     App *make_active_view(View *child);
 
+    /**
+     * @brief               Register a function that creates a view, which is only called when the view is first made active
+     *
+     * @note                Views that have not been active for `idle_timeout` milliseconds are destroyed by `release_idle_views`,
+     *                      and are created again the next time they are made active (so no references to their widgets may be kept
+     *                      outside of them)
+     *
+     * @param factory       Function that creates the view and all of its widgets
+     * @param idle_timeout  Time after which the view is destroyed when it is not active (in milliseconds, 0 to never destroy it)
+     *
+     * @return view_id_t    Identifier of the view (0 if the table of factories is full)
+     *
+     */
+    view_id_t register_view(view_factory_t factory, unsigned long idle_timeout = 0);
+
+    /**
+     * @brief               Set the active view, creating it first if it does not exist
+     *
+     * @note                If the view could not be created, then this method call does nothing
+     *
+     * @param id            Identifier of the view (returned by `register_view`)
+     *
+     * @return              A pointer to the app (allows chaining method calls)
+     *
+     */
+    App *make_active_view(view_id_t id);
+
+    /**
+     * @brief               Get a reference to a view registered as a factory, creating it first if it does not exist
+     *
+     * @note                This allows the widgets of a view to be updated before it is made active
+     *
+     * @param id            Identifier of the view (returned by `register_view`)
+     *
+     * @return              A pointer to the view (nullptr if it could not be created)
+     *
+     */
+    View *get_view(view_id_t id);
+
+    /**
+     * @brief               Destroy the views that have not been active for longer than their idle timeout
+     *
+     * @return              A pointer to the app (allows chaining method calls)
+     *
+     */
+    App *release_idle_views();
+
     /**
      * @brief               Get a reference to the active view
      *
@@ -124,6 +273,28 @@ public:
      */
     App *execute_event_logic();
 
+    /**
+     * @brief               Get the counters maintained by the event queue
+     *
+     * @param high_water    Reference to variable where the largest number of events that were pending at once will be stored
+     * @param dropped       Reference to variable where the number of events dropped due to a full queue will be stored
+     * @param coalesced     Reference to variable where the number of events merged with an identical pending event will be stored
+     *
+     * @return App*         A pointer to the app (allows chaining method calls)
+     *
+     */
+    App *get_event_counters(unsigned *high_water, unsigned *dropped, unsigned *coalesced);
+
+#ifdef GLYPH_CACHE_ENABLED
+    /**
+     * @brief               Get a reference to the cache of rasterized glyphs (for reporting its hit rate)
+     *
+     * @return              Immutable pointer to the glyph cache
+     *
+     */
+    const GlyphCache *get_glyph_cache() const;
+#endif
+
     /**
      * @brief               Collect all dirty widgets from the widget-tree, from lower Z-index to higher
      *
@@ -140,6 +311,179 @@ public:
      */
     App *update_dirty_widgets();
 
+    /**
+     * @brief               Set the rate at which a phase of the main loop runs
+     *
+     * @param phase         The phase whose rate must be set
+     * @param interval_us   Interval between consecutive runs of the phase (in microseconds)
+     *
+     * @return App*         A pointer to the app (allows chaining method calls)
+     *
+     */
+    App *set_phase_interval(schedule_phase_t phase, unsigned long interval_us);
+
+    /**
+     * @brief               Check if a phase of the main loop is due to run, and schedule its next run if it is
+     *
+     * @note                If the phase is found to be more than one interval late, a deadline miss is recorded and
+     *                      the schedule of the phase is re-aligned to the current time (missed runs are not made up for)
+     *
+     * @param phase         The phase to check
+     *
+     * @return false        If the phase is not yet due
+     * @return true         If the phase is due and must be run now
+     *
+     */
+    bool is_due(schedule_phase_t phase);
+
+    /**
+     * @brief               Get the number of times a phase ran more than one interval late
+     *
+     * @param phase         The phase whose deadline misses are required
+     *
+     * @return              Number of deadline misses of the phase
+     *
+     */
+    unsigned long get_deadline_misses(schedule_phase_t phase) const;
+
+    /**
+     * @brief               Set the time budget for redrawing dirty widgets while stroke input is active
+     *
+     * @note                Once the budget is exhausted, the remaining dirty widgets are deferred to the next render phase
+     *
+     * @param budget_us     Maximum duration of a single call to `update_dirty_widgets` (in microseconds, 0 to disable)
+     *
+     * @return App*         A pointer to the app (allows chaining method calls)
+     *
+     */
+    App *set_frame_budget(unsigned long budget_us);
+
+    /**
+     * @brief               Get the number of frames in which redraws were deferred to honour the frame budget
+     *
+     * @return              Number of frames that exceeded the budget
+     *
+     */
+    unsigned long get_budget_overruns() const;
+
+    /**
+     * @brief               Report whether the user is drawing a stroke, so that redraws can be throttled
+     *
+     * @param active        Whether stroke input is currently active
+     *
+     * @return App*         A pointer to the app (allows chaining method calls)
+     *
+     */
+    App *set_stroke_active(bool active);
+
+    /**
+     * @brief               Schedule a callback to be called once, after a delay
+     *
+     * @warning             This method returns 0 if the maximum number of pending timers has been reached
+     *
+     * @param cb            The callback to call
+     * @param args          The arguments to pass to the callback
+     * @param delay_ms      Minimum number of milliseconds after which the callback is called
+     *
+     * @return timer_id_t   Identifier of the timer (0 if it could not be created)
+     *
+     */
+    timer_id_t set_timeout(InteractiveWidget::callback_t cb, unsigned *args, unsigned long delay_ms);
+
+    /**
+     * @brief               Schedule a callback to be called repeatedly, until it is cancelled
+     *
+     * @warning             This method returns 0 if the maximum number of pending timers has been reached
+     *
+     * @param cb            The callback to call
+     * @param args          The arguments to pass to the callback
+     * @param period_ms     Number of milliseconds between consecutive calls
+     *
+     * @return timer_id_t   Identifier of the timer (0 if it could not be created)
+     *
+     */
+    timer_id_t set_interval(InteractiveWidget::callback_t cb, unsigned *args, unsigned long period_ms);
+
+    /**
+     * @brief               Schedule a callback to be called on the next call to `execute_timers` (not the one in progress)
+     *
+     * @note                This allows a long operation to be split into steps, with other work running between them
+     *
+     * @param cb            The callback to call
+     * @param args          The arguments to pass to the callback
+     *
+     * @return timer_id_t   Identifier of the timer (0 if it could not be created)
+     *
+     */
+    timer_id_t defer(InteractiveWidget::callback_t cb, unsigned *args);
+
+    /**
+     * @brief               Cancel a pending timer
+     *
+     * @param id            Identifier of the timer (as returned when it was created)
+     *
+     * @return false        If no pending timer has this identifier
+     * @return true         If the timer was cancelled
+     *
+     */
+    bool cancel_timer(timer_id_t id);
+
+    /**
+     * @brief               Call the callbacks of all timers whose deadlines have passed
+     *
+     * @note                This must be called at every instance of the main loop
+     *
+     * @return App*         A pointer to the app (allows chaining method calls)
+     *
+     */
+    App *execute_timers();
+
+    /**
+     * @brief               Start a cooperative task, which is resumed once on every call to `execute_tasks` until it is done
+     *
+     * @warning             This method returns false if the maximum number of running tasks has been reached
+     *
+     * @param fn            The task function
+     * @param args          The arguments to pass to the task function each time it is resumed
+     *
+     * @return false        If the task could not be started
+     * @return true         If the task was started
+     *
+     */
+    bool start_task(task_fn_t fn, unsigned *args);
+
+    /**
+     * @brief               Check whether a task function is currently running
+     *
+     * @param fn            The task function
+     *
+     * @return false        If no running task uses this function
+     * @return true         If atleast one running task uses this function
+     *
+     */
+    bool is_task_running(task_fn_t fn) const;
+
+    /**
+     * @brief               Stop every running task that uses a function, without resuming it again
+     *
+     * @param fn            The task function
+     *
+     * @return              Number of tasks that were stopped
+     *
+     */
+    unsigned cancel_task(task_fn_t fn);
+
+    /**
+     * @brief               Resume every running task once, and remove the tasks that finish
+     *
+     * @note                This must be called at every instance of the main loop
+     * @note                Tasks started while this method runs are first resumed on its next call
+     *
+     * @return App*         A pointer to the app (allows chaining method calls)
+     *
+     */
+    App *execute_tasks();
+
     // BasicWidget overrides
 
     /**
@@ -302,6 +646,16 @@ public:
      */
     bool propagate_release(unsigned x, unsigned y) override;
 
+    /**
+     * @brief               Propagate a gesture down the active view's subtree, consuming it
+     *
+     * @param gesture       Gesture to propagate (located at the point where the stylus touched the screen)
+     *
+     * @return false        If the gesture was not consumed
+     * @return true         If the gesture was consumed
+     */
+    bool propagate_gesture(const gesture_t &gesture) override;
+
     /**
      * @brief               Report the current visibility of the widget
      *
@@ -485,6 +839,9 @@ public:
      */
     App *print(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color) override;
 
+    /** Print a string with a transparent background, without caching its glyphs (see `DrawableWidget::print_uncached`) */
+    App *print_uncached(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color) override;
+
     /**
      * @brief               Print a string with a transparent background
      *
@@ -515,6 +872,54 @@ public:
      */
     App *draw_rgb_bitmap(unsigned x, unsigned y, const uint16_t *data, unsigned width, unsigned height) override;
 
+    /**
+     * @brief               Begin streaming colors into a rectangular window, which is filled row by row from its top-left corner
+     *
+     * @note                The address window of the display is set only once, so that each pixel costs only its own color on the bus
+     *
+     * @warning             The window must lie completely within the display
+     * @warning             No other drawing method may be called until `end_write_window` is called
+     *
+     * @param x             X-coordinate of the top-left corner of the window (offset from left-edge)
+     * @param y             Y-coordinate of the top-left corner of the window (offset from top-edge)
+     * @param w             Width of the window
+     * @param h             Height of the window
+     *
+     * @return              Pointer to the app (allows chaining method calls)
+     *
+     */
+    App *begin_write_window(unsigned x, unsigned y, unsigned w, unsigned h) override;
+
+    /**
+     * @brief               Stream colors into the window, copying them into RAM in chunks of `WRITE_CHUNK_PIXELS`
+     *
+     * @param colors        Pointer to the array of colors (may be stored in flash)
+     * @param count         Number of colors in the array
+     *
+     * @return              Pointer to the app (allows chaining method calls)
+     *
+     */
+    App *write_colors(const uint16_t *colors, unsigned count) override;
+
+    /**
+     * @brief               Stream a single color repeatedly into the window
+     *
+     * @param color         16-bit color to write
+     * @param count         Number of times to write the color
+     *
+     * @return              Pointer to the app (allows chaining method calls)
+     *
+     */
+    App *write_color_run(uint16_t color, unsigned count) override;
+
+    /**
+     * @brief               Finish streaming colors into the window, and restore the address window to the whole display
+     *
+     * @return              Pointer to the app (allows chaining method calls)
+     *
+     */
+    App *end_write_window() override;
+
 protected:
 
     /**
@@ -534,6 +939,54 @@ protected:
      *
      */
     App *add_view(View *child);
+
+    /**
+     * @brief               Remove a view from the app (the view is not destroyed)
+     *
+     * @param child         The view which must be removed from the app
+     *
+     */
+    void remove_view(View *child);
+
+    /**
+     * @brief               Insert a timer into the heap of pending timers
+     *
+     * @return timer_id_t   Identifier of the timer (0 if the heap is full)
+     *
+     */
+    timer_id_t push_timer(InteractiveWidget::callback_t cb, unsigned *args, unsigned long deadline, unsigned long period);
+
+    /**
+     * @brief               Remove the timer at a position in the heap and restore the heap property
+     *
+     * @param idx           Position of the timer in the heap
+     *
+     */
+    void remove_timer(unsigned idx);
+
+    /**
+     * @brief               Move a timer towards the root of the heap until its parent is not due after it
+     *
+     * @param idx           Position of the timer in the heap
+     *
+     */
+    void sift_up(unsigned idx);
+
+    /**
+     * @brief               Move a timer towards the leaves of the heap until neither child is due before it
+     *
+     * @param idx           Position of the timer in the heap
+     *
+     */
+    void sift_down(unsigned idx);
+
+    /**
+     * @brief               Compare the deadlines of two timers (correctly handles the overflow of `millis()`)
+     *
+     * @return true         If timer @p a is due before timer @p b
+     *
+     */
+    static bool due_before(const timer_entry_t &a, const timer_entry_t &b);
 };
 
 #endif
@@ -10,6 +10,7 @@
 
 #include "widget.h"
 #include "frame.h"
+#include "bitmapasset.h"
 
 /**
  * @brief                   Class to show 16-bit color bitmaps stored in memory
@@ -19,9 +20,6 @@ class Bitmap : public BasicWidget, public InteractiveWidget {
 
 protected:
 
-    /** The cooldown period between two presses (used to prevent "bouncing", where a single press is detected as multiple) */
-    constexpr static unsigned DEBOUNCE_THRESH = 200;
-
     /** Reference to parent frame */
     Frame *parent {nullptr};
 
@@ -51,8 +49,8 @@ protected:
     /** Height of widget (number of rows occupied) */
     unsigned widget_h;
 
-    /** Pointer to the bitmap array */
-    const uint16_t *data;
+    /** Pointer to the compressed bitmap asset */
+    const bitmap_asset_t *asset;
 
     /** Function to call when the bitmap is pressed */
     callback_t on_press {nullptr};
@@ -65,11 +63,16 @@ protected:
     /** Reference to event queue for posting events */
     RingQueueInterface<callback_event_t> *event_queue {nullptr};
 
-    /** The epoch when the widget was last pressed */
-    unsigned last_press_epoch {0};
-
 public:
 
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "Bitmap";
+
+    /** Return the widget to the widget pool, counted against `TYPE_NAME` */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, TYPE_NAME);
+    }
+
     /**
      * @brief               Default constructor disabled (use the `create` method)
      *
@@ -82,16 +85,14 @@ public:
      * @warning             This method returns a nullptr if a bitmap instance could not be created
      *
      * @param parent        The frame that should own this bitmap
-     * @param data          Pointer to the Bitmap array
+     * @param asset         Pointer to the compressed bitmap asset (the bitmap occupies the dimensions of the asset)
      * @param x             X-coordinate of the bitmap, within `parent` (offset from left-edge)
      * @param y             Y-coordinate of the bitmap, within `parent` (offset from top-edge)
-     * @param width         Number of columns occupied by the bitmap
-     * @param height        Number of rows occupied by the bitmap
      *
      * @return              A pointer to the bitmap instance (nullptr if the creation failed)
      *
      */
-    static Bitmap *create(Frame *parent, const uint16_t *data, unsigned x, unsigned y,  unsigned width, unsigned height);
+    static Bitmap *create(Frame *parent, const bitmap_asset_t *asset, unsigned x, unsigned y);
 
     // BasicWidget overrides
 
@@ -150,14 +151,12 @@ protected:
      * @brief               Construct a new Bitmap object
      *
      * @param parent        The frame that should own this bitmap
-     * @param data          Pointer to the Bitmap array
+     * @param asset         Pointer to the compressed bitmap asset (the bitmap occupies the dimensions of the asset)
      * @param x             X-coordinate of the bitmap, within `parent` (offset from left-edge)
      * @param y             Y-coordinate of the bitmap, within `parent` (offset from top-edge)
-     * @param width         Number of columns occupied by the bitmap
-     * @param height        Number of rows occupied by the bitmap
      *
      */
-    Bitmap(Frame *parent, const uint16_t *data, unsigned x, unsigned y, unsigned width, unsigned height);
+    Bitmap(Frame *parent, const bitmap_asset_t *asset, unsigned x, unsigned y);
 };
 
 #endif
\ No newline at end of file
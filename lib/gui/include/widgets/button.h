@@ -10,6 +10,8 @@
 
 #include "widget.h"
 #include "frame.h"
+#include "fixedstring.h"
+#include "sharedstyle.h"
 
 /**
  * @brief                   Class to encapsulate style information of a button
@@ -30,6 +32,12 @@ protected:
 
 public:
 
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "ButtonStyle";
+
+    /** Style that buttons use unless they are given a different one */
+    static const ButtonStyle DEFAULT;
+
     /** Enumueration of different ways to align text horizontally */
     enum HorizontalAlignment {
         CENTER_ALIGN = 0,
@@ -135,8 +143,8 @@ class Button : public BasicWidget, public InteractiveWidget {
 
 protected:
 
-    /** The cooldown period between two presses (used to prevent "bouncing", where a single press is detected as multiple) */
-    constexpr static unsigned DEBOUNCE_THRESH = 200;
+    /** Maximum number of characters in the text shown by the button */
+    constexpr static unsigned MESSAGE_CAPACITY = 16;
 
     constexpr static unsigned DEFAULT_WIDTH = 64;
     constexpr static unsigned DEFAULT_HEIGHT = 32;
@@ -174,7 +182,18 @@ protected:
     unsigned widget_h;
 
     /** Text to display on the button */
-    String message {};
+    FixedString<MESSAGE_CAPACITY> message {};
+
+    /** X-coordinate of the text origin within the parent (cached, valid only if `layout_valid` is set) */
+    unsigned text_x {0};
+    /** Y-coordinate of the text baseline within the parent (cached, valid only if `layout_valid` is set) */
+    unsigned text_y {0};
+    /** Width of the text's bounding box (cached, valid only if `layout_valid` is set) */
+    uint16_t text_w {0};
+    /** Height of the text's bounding box (cached, valid only if `layout_valid` is set) */
+    uint16_t text_h {0};
+    /** Flag to indicate if the cached text layout matches the current message, style and size */
+    bool layout_valid {false};
 
     /** Function to call when the bitmap is pressed */
     callback_t on_press {nullptr};
@@ -187,14 +206,37 @@ protected:
     /** Reference to event queue for posting events */
     RingQueueInterface<callback_event_t> *event_queue {nullptr};
 
-    /** The epoch when the widget was last pressed */
-    unsigned last_press_epoch {0};
-
-    /** Style information about the button */
-    ButtonStyle style;
+    /** Flag to indicate if only the pressed state or the message has changed since the button was last drawn */
+    bool partially_dirty {false};
+    /** Flag to indicate if the button is currently drawn on the display (and `drawn_pressed` is valid) */
+    bool drawn {false};
+    /** Pressed state that the button was last drawn in */
+    bool drawn_pressed {false};
+    /** Flag to indicate if the message has changed since the button was last drawn (only if it is partially dirty) */
+    bool label_changed {false};
+
+    /** X-coordinate of the area covered by the drawn text within the parent (valid only if `label_changed` is set) */
+    unsigned erase_x {0};
+    /** Y-coordinate of the area covered by the drawn text within the parent (valid only if `label_changed` is set) */
+    unsigned erase_y {0};
+    /** Width of the area covered by the drawn text (valid only if `label_changed` is set) */
+    uint16_t erase_w {0};
+    /** Height of the area covered by the drawn text (valid only if `label_changed` is set) */
+    uint16_t erase_h {0};
+
+    /** Style information about the button (shared with other buttons until it is changed through `get_style`) */
+    SharedStyle<ButtonStyle> style {&ButtonStyle::DEFAULT};
 
 public:
 
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "Button";
+
+    /** Return the widget to the widget pool, counted against `TYPE_NAME` */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, TYPE_NAME);
+    }
+
     /**
      * @brief               Default constructor disabled (use the `create` method)
      *
@@ -234,6 +276,8 @@ public:
     /**
      * @brief               Set the text that the button should display
      *
+     * @note                Text longer than `MESSAGE_CAPACITY` characters is truncated
+     *
      * @param msg_ptr       Pointer to message string
      *
      * @return              Pointer to the button (allows chaining method calls)
@@ -241,13 +285,25 @@ public:
      */
     Button *set_message(const char *msg_ptr);
 
+    /**
+     * @brief               Replace the text that the button displays, redrawing only the area covered by the old and new text
+     *
+     * @note                If the button is not up to date on the display, this is the same as `Button::set_message`
+     *
+     * @param msg_ptr       Pointer to message string
+     *
+     * @return              Pointer to the button (allows chaining method calls)
+     *
+     */
+    Button *relabel(const char *msg_ptr);
+
     /**
      * @brief               Get the text that the button is displaying
      *
-     * @return              An owned copy of the text
+     * @return              Pointer to the null-terminated text (valid until the text is changed)
      *
      */
-    String get_message() const;
+    const char *get_message() const;
 
     /**
      * @brief               Get the number of characters in the text
@@ -259,6 +315,8 @@ public:
     /**
      * @brief               Get a reference to the style object of the button to change its appearance
      *
+     * @note                If the style is shared with other buttons, it is first copied so that only this button changes
+     *
      * @see                 `ButtonStyle`
      *
      * @return              Pointer to the style object
@@ -266,6 +324,16 @@ public:
      */
     ButtonStyle *get_style();
 
+    /**
+     * @brief               Share a style with other buttons (discards any changes made through `get_style`)
+     *
+     * @param shared_style  Reference to the style (must outlive the button, usually a `static const` object)
+     *
+     * @return              Pointer to the button (allows chaining method calls)
+     *
+     */
+    Button *set_style(const ButtonStyle *shared_style);
+
     // BasicWidget overrides
 
     Frame *get_parent() override;
@@ -285,7 +353,10 @@ public:
     void set_dirty() override;
     void set_visibility_changed() override;
 
+    bool get_partially_dirty() const override;
+
     void draw() override;
+    bool draw_partial() override;
     void clear() override;
 
     bool get_intersection(unsigned x, unsigned y) const override;
@@ -331,11 +402,35 @@ protected:
      */
     Button(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height);
 
+    /**
+     * @brief               Helper function to render the background in the colors of the current state
+     *
+     * @param with_border   Whether the border should be rendered as well
+     *
+     */
+    void render_background(bool with_border);
+
     /**
      * @brief               Helper function to render the text
      *
      */
     void render_text();
+
+    /**
+     * @brief               Mark the button for redrawing after its pressed state changed
+     *
+     * @note                If the button is otherwise up to date, only the colors that differ between the states are redrawn
+     *
+     */
+    void set_state_changed();
+
+    /**
+     * @brief               Helper function to measure the text and compute its origin, which are cached until the message or style changes
+     *
+     * @note                The font for the current text size must already be set on the parent
+     *
+     */
+    void update_layout();
 };
 
 #endif
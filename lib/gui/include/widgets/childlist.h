@@ -0,0 +1,246 @@
+/**
+ * @file                    childlist.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `ChildList` class, which stores the children of a frame in Z-order along with an optional spatial index
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_WIDGETS_CHILDLIST_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_WIDGETS_CHILDLIST_H__
+
+#include "vector"
+
+#include "widget.h"
+
+/**
+ * @brief                   List of the children of a frame, from lower Z-index (further front) to higher (further back)
+ *
+ *                          The bounding boxes of the children are mirrored in one contiguous array per edge, in the same order
+ *                          as the children, and so is their visibility (kept in sync through `Frame::notify_visibility`). Hit
+ *                          tests and overlap tests scan these arrays, and only call into the children that are visible and
+ *                          actually intersect (to pass on the event, or check their dirty flag).
+ *
+ *                          The list can optionally keep a coarse uniform grid over the frame, where each cell holds a mask of
+ *                          the children whose bounding boxes overlap it. Presses and releases are then only offered to the
+ *                          children in the touched cell (still from front to back), instead of every child in turn.
+ *
+ * @note                    Children are assumed to never move or resize once they are added (which holds for all widgets)
+ * @note                    Visibility is not part of the index, and is checked when an event is dispatched
+ * @note                    The dirty flag is not mirrored, since it is written by every method that changes the appearance of
+ *                          a widget (and cleared when it is drawn), so it is still read from the child
+ *
+ */
+class ChildList {
+
+public:
+
+    /** Number of columns of cells in the spatial index */
+    constexpr static unsigned GRID_COLS = 4;
+    /** Number of rows of cells in the spatial index */
+    constexpr static unsigned GRID_ROWS = 4;
+
+    /** Maximum number of children that can be indexed (the list falls back to a linear scan beyond this) */
+    constexpr static unsigned MAX_INDEXED = 32;
+
+    using const_iterator = std::vector<BasicWidget *>::const_iterator;
+    using const_reverse_iterator = std::vector<BasicWidget *>::const_reverse_iterator;
+
+protected:
+
+    /** Children of the frame, from front to back */
+    std::vector<BasicWidget *> children;
+
+    /** X-coordinate of the left-edge of each child, relative to the frame */
+    std::vector<int16_t> lefts;
+    /** Y-coordinate of the top-edge of each child, relative to the frame */
+    std::vector<int16_t> tops;
+    /** X-coordinate of the right-edge of each child, relative to the frame (inclusive, like `get_intersection`) */
+    std::vector<int16_t> rights;
+    /** Y-coordinate of the bottom-edge of each child, relative to the frame (inclusive, like `get_intersection`) */
+    std::vector<int16_t> bottoms;
+
+    /** Visibility of each child (non-zero if the child is visible) */
+    std::vector<uint8_t> visibility;
+
+    /** Mask of the children that overlap each cell of the grid, row by row (only valid if `indexed` is true) */
+    uint32_t cells[GRID_COLS * GRID_ROWS];
+
+    /** Flag indicating if the spatial index is enabled */
+    bool indexed {false};
+
+    /** Number of columns covered by each cell */
+    unsigned cell_w {0};
+    /** Number of rows covered by each cell */
+    unsigned cell_h {0};
+
+public:
+
+    ChildList() = default;
+    ChildList(const ChildList &) = delete;
+    ChildList &operator=(const ChildList &) = delete;
+
+    /**
+     * @brief               Add a child behind all other children
+     *
+     * @param child         Reference to the child to add
+     *
+     */
+    void push_back(BasicWidget *child);
+
+    /**
+     * @brief               Get the Z-index of a child
+     *
+     * @param child         Reference to the child to find
+     *
+     * @return              Z-index of the child (the number of children if it is not in the list)
+     *
+     */
+    unsigned find(const BasicWidget *child) const;
+
+    /**
+     * @brief               Move a child to a different Z-index, shifting the children in between by one position
+     *
+     * @param cur_z         Current Z-index of the child
+     * @param new_z         Z-index to move the child to
+     *
+     */
+    void move(unsigned cur_z, unsigned new_z);
+
+    /**
+     * @brief               Update the mirrored visibility of a child
+     *
+     * @param child         Reference to the child (ignored if it is not in the list)
+     * @param visible       New visibility of the child
+     *
+     */
+    void set_visibility(const BasicWidget *child, bool visible);
+
+    /**
+     * @brief               Start indexing the children by their position within the frame
+     *
+     * @param width         Number of columns occupied by the frame
+     * @param height        Number of rows occupied by the frame
+     *
+     */
+    void enable_index(unsigned width, unsigned height);
+
+    /**
+     * @brief               Pass a press to the front-most visible child that accepts it
+     *
+     * @param x             X-coordinate of the press, relative to the frame
+     * @param y             Y-coordinate of the press, relative to the frame
+     *
+     * @return false        If no child accepted the press
+     * @return true         If a child accepted the press
+     *
+     */
+    bool propagate_press(unsigned x, unsigned y);
+
+    /**
+     * @brief               Pass a release to the front-most visible child that accepts it
+     *
+     * @param x             X-coordinate of the release, relative to the frame
+     * @param y             Y-coordinate of the release, relative to the frame
+     *
+     * @return false        If no child accepted the release
+     * @return true         If a child accepted the release
+     *
+     */
+    bool propagate_release(unsigned x, unsigned y);
+
+    /**
+     * @brief               Pass a gesture to the front-most visible child that accepts it
+     *
+     * @param gesture       Gesture to pass (its coordinates relative to the frame)
+     *
+     * @return false        If no child accepted the gesture
+     * @return true         If a child accepted the gesture
+     *
+     */
+    bool propagate_gesture(const gesture_t &gesture);
+
+    /**
+     * @brief               Mark and enqueue the visible, clean children within a range of Z-indices that overlap a rectangle
+     *
+     * @note                Children are visited from higher Z-index (further back) to lower (further front)
+     *
+     * @param begin         Lowest Z-index in the range
+     * @param end           One past the highest Z-index in the range
+     * @param x0            X-coordinate of the left-edge of the rectangle, relative to the frame
+     * @param y0            Y-coordinate of the top-edge of the rectangle, relative to the frame
+     * @param x1            X-coordinate of the right-edge of the rectangle, relative to the frame (inclusive)
+     * @param y1            Y-coordinate of the bottom-edge of the rectangle, relative to the frame (inclusive)
+     * @param overlapping_widgets   Reference to queue onto which the overlapping children are enqueued
+     *
+     */
+    void collect_overlapping(unsigned begin, unsigned end, signed x0, signed y0, signed x1, signed y1, RingQueueInterface<BasicWidget *> *overlapping_widgets) const;
+
+    unsigned size() const { return children.size(); }
+    bool empty() const { return children.empty(); }
+
+    BasicWidget *operator[](unsigned idx) const { return children[idx]; }
+
+    const_iterator begin() const { return children.begin(); }
+    const_iterator end() const { return children.end(); }
+
+    const_reverse_iterator rbegin() const { return children.rbegin(); }
+    const_reverse_iterator rend() const { return children.rend(); }
+
+protected:
+
+    /**
+     * @brief               Check if the spatial index can be used to dispatch events
+     *
+     */
+    bool get_indexed() const;
+
+    /**
+     * @brief               Check if a point lies within the bounding box of a child
+     *
+     * @param idx           Z-index of the child
+     * @param x             X-coordinate of the point, relative to the frame
+     * @param y             Y-coordinate of the point, relative to the frame
+     *
+     */
+    bool contains(unsigned idx, unsigned x, unsigned y) const;
+
+    /**
+     * @brief               Move an entry of one of the arrays to a different index, shifting the entries in between by one position
+     *
+     */
+    template <typename T>
+    static void move_entry(std::vector<T> &entries, unsigned cur_z, unsigned new_z) {
+
+        T entry = entries[cur_z];
+
+        for (unsigned i = cur_z; i > new_z; --i) {
+            entries[i] = entries[i - 1];
+        }
+        for (unsigned i = cur_z; i < new_z; ++i) {
+            entries[i] = entries[i + 1];
+        }
+        entries[new_z] = entry;
+    }
+
+    /**
+     * @brief               Set the bit of a child in every cell that its bounding box overlaps
+     *
+     * @param idx           Z-index of the child
+     *
+     */
+    void index_child(unsigned idx);
+
+    /**
+     * @brief               Recompute the masks of all cells (required after the Z-indices of the children change)
+     *
+     */
+    void rebuild_index();
+
+    /**
+     * @brief               Get the mask of children that may contain a point
+     *
+     */
+    uint32_t get_candidates(unsigned x, unsigned y) const;
+};
+
+#endif
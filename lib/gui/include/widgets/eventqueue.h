@@ -0,0 +1,161 @@
+/**
+ * @file                    eventqueue.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `EventQueue` class, a bounded priority queue of events used by the app
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_WIDGETS_EVENTQUEUE_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_WIDGETS_EVENTQUEUE_H__
+
+#include "widget.h"
+
+/**
+ * @brief                   Bounded queue of events that dispatches events by priority, and in FIFO order within a priority
+ *
+ *                          Each priority has its own ring of fixed capacity, so that a burst of low-priority events can
+ *                          never delay or displace user input. When an event is pushed while an event with the same callback
+ *                          and arguments is already pending at the same priority, the two are coalesced into one. When the
+ *                          ring of a priority is full, the new event is dropped.
+ *
+ *                          The queue records how many events were dropped and coalesced, and the largest number of events
+ *                          that were pending at once
+ *
+ * @tparam CAPACITY         Maximum number of pending events per priority
+ *
+ */
+template <unsigned CAPACITY>
+class EventQueue : public RingQueueInterface<InteractiveWidget::callback_event_t> {
+
+public:
+
+    using event_t = InteractiveWidget::callback_event_t;
+
+protected:
+
+    static_assert(CAPACITY <= UINT8_MAX, "positions within a ring are stored in 8 bits");
+
+    constexpr static unsigned NUM_PRIORITIES = InteractiveWidget::EVENT_PRIORITY_COUNT;
+
+    /** Ring of pending events for each priority */
+    event_t arr[NUM_PRIORITIES][CAPACITY];
+
+    /** Position of the back of each ring */
+    uint8_t head[NUM_PRIORITIES] {};
+    /** Position of the front of each ring */
+    uint8_t tail[NUM_PRIORITIES] {};
+    /** Number of events in each ring */
+    uint8_t count[NUM_PRIORITIES] {};
+
+    /** Total number of pending events */
+    unsigned size {0};
+
+    /** Largest number of events that were pending at once */
+    unsigned high_water {0};
+    /** Number of events that were dropped because their ring was full */
+    unsigned dropped {0};
+    /** Number of events that were merged into an identical pending event */
+    unsigned coalesced {0};
+
+public:
+
+    /**
+     * @brief               Push an event to the back of the ring of its priority
+     *
+     * @note                The event is coalesced with an identical pending event if one exists, and dropped if its ring is full
+     *
+     * @param e             Event to push onto the queue
+     *
+     */
+    void push(const event_t &e) override {
+
+        unsigned p = (e.priority < NUM_PRIORITIES) ? e.priority : NUM_PRIORITIES - 1;
+
+#ifdef FUNCTION_PTR_CALLBACK
+        for (unsigned i = 0, idx = tail[p]; i < count[p]; ++i, (idx += 1) %= CAPACITY) {
+            if (arr[p][idx].cb == e.cb && arr[p][idx].args == e.args) {
+                ++coalesced;
+                return;
+            }
+        }
+#endif
+
+        if (count[p] == CAPACITY) {
+            ++dropped;
+            return;
+        }
+
+        arr[p][head[p]] = e;
+        (head[p] += 1) %= CAPACITY;
+        ++count[p];
+
+        high_water = max(high_water, ++size);
+    }
+
+    /**
+     * @brief               Get an immutable reference to the pending event with the highest priority
+     *
+     * @warning             If this function was called when the queue was empty, it will return an invalid reference
+     * @warning             The reference returned by this method becomes invalid after calling the `pop` or `push` methods
+     *
+     * @return              Immutable reference to the event that will be dispatched next
+     *
+     */
+    const event_t &front() override {
+        unsigned p = first_priority();
+        return arr[p][tail[p]];
+    }
+
+    /**
+     * @brief               Pop the pending event with the highest priority without returning it
+     *
+     */
+    void pop() override {
+
+        unsigned p = first_priority();
+
+        if (count[p] == 0) {
+            return;
+        }
+
+        (tail[p] += 1) %= CAPACITY;
+        --count[p];
+        --size;
+    }
+
+    /**
+     * @brief               Get the number of pending events, across all priorities
+     *
+     * @return unsigned     Number of pending events
+     *
+     */
+    unsigned get_size() const override {
+        return size;
+    }
+
+    /** Get the largest number of events that were pending at once */
+    unsigned get_high_water() const { return high_water; }
+
+    /** Get the number of events that were dropped because their ring was full */
+    unsigned get_dropped() const { return dropped; }
+
+    /** Get the number of events that were merged into an identical pending event */
+    unsigned get_coalesced() const { return coalesced; }
+
+protected:
+
+    /**
+     * @brief               Get the highest priority with atleast one pending event (the lowest priority if none are pending)
+     *
+     */
+    unsigned first_priority() const {
+
+        unsigned p = 0;
+        while (p < NUM_PRIORITIES - 1 && count[p] == 0) {
+            ++p;
+        }
+        return p;
+    }
+};
+
+#endif
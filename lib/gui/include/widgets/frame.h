@@ -76,6 +76,27 @@ public:
      */
     virtual Frame *send_back(BasicWidget *child, unsigned amt) = 0;
 
+    /**
+     * @brief               Index the children of this widget by their position, so that presses and releases are only passed to the children under them
+     *
+     * @note                This should be called on frames with many children, since the index takes up memory (see `ChildList`)
+     *
+     * @return              Pointer to frame (allows chaining method calls)
+     *
+     */
+    virtual Frame *enable_spatial_index() = 0;
+
+    /**
+     * @brief               Inform the frame that the visibility of one of its children has changed
+     *
+     * @note                This method should only be called by the child, from its `set_visibility` method
+     *
+     * @param child         Reference to the child
+     * @param visible       New visibility of the child
+     *
+     */
+    virtual void notify_visibility(BasicWidget *child, bool visible) = 0;
+
     /**
      * #brief               Enqueue all dirty widgets (that need to be redrawn/cleared) in the frame's subtree from higher Z-index to lower
      *
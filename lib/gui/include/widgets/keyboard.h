@@ -12,6 +12,41 @@
 #include "window.h"
 #include "button.h"
 
+/**
+ * @brief                   Compute which keys have different labels in two layouts of the keyboard (evaluated at compile time)
+ *
+ * @param from              Labels of the keys in the first layout (indexed by row and column)
+ * @param to                Labels of the keys in the second layout (indexed by row and column)
+ * @param num_keys          Number of keys in each row
+ *
+ * @return                  Mask with a bit set for each key (numbered row by row) whose label differs
+ *
+ */
+template <unsigned ROWS, unsigned COLS>
+constexpr uint64_t keyboard_label_diff(const char *const (&from)[ROWS][COLS], const char *const (&to)[ROWS][COLS], const unsigned (&num_keys)[ROWS]) {
+
+    uint64_t mask = 0;
+
+    for (unsigned i = 0, idx = 0; i < ROWS; ++i) {
+        for (unsigned j = 0; j < num_keys[i]; ++j, ++idx) {
+
+            const char *a = from[i][j];
+            const char *b = to[i][j];
+
+            while (*a != '\0' && *a == *b) {
+                ++a;
+                ++b;
+            }
+
+            if (*a != *b) {
+                mask |= (uint64_t)1 << idx;
+            }
+        }
+    }
+
+    return mask;
+}
+
 /**
  * @brief                   Class that provides a smartphone-like keyboard
  *
@@ -20,6 +55,14 @@ class Keyboard : public Window, public InteractiveWidget {
 
 public:
 
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "Keyboard";
+
+    /** Return the widget to the widget pool, counted against `TYPE_NAME` */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, TYPE_NAME);
+    }
+
     constexpr static unsigned NUM_ROWS = 5;
     constexpr static unsigned NUM_KEYS[NUM_ROWS] = {
         10,
@@ -56,6 +99,26 @@ public:
         }
     };
 
+    /** Keys whose labels differ between each pair of shift positions (indexed by the old and new shift positions) */
+    constexpr static uint64_t RELABEL_MASK[3][3] {
+        {
+            0,
+            keyboard_label_diff(KEYBOARD_KEYS[0], KEYBOARD_KEYS[1], NUM_KEYS),
+            keyboard_label_diff(KEYBOARD_KEYS[0], KEYBOARD_KEYS[2], NUM_KEYS)
+        },
+        {
+            keyboard_label_diff(KEYBOARD_KEYS[1], KEYBOARD_KEYS[0], NUM_KEYS),
+            0,
+            keyboard_label_diff(KEYBOARD_KEYS[1], KEYBOARD_KEYS[2], NUM_KEYS)
+        },
+        {
+            keyboard_label_diff(KEYBOARD_KEYS[2], KEYBOARD_KEYS[0], NUM_KEYS),
+            keyboard_label_diff(KEYBOARD_KEYS[2], KEYBOARD_KEYS[1], NUM_KEYS),
+            0
+        }
+    };
+    static_assert(NUM_KEYS_TOTAL <= 64, "each key needs a bit in the relabel masks");
+
     /**
      * @brief               Structure to represent information about a single press/release event in callbacks
      *
@@ -79,8 +142,25 @@ public:
 
 protected:
 
-    /** The cooldown period between two presses (used to prevent "bouncing", where a single press is detected as multiple) */
-    constexpr static unsigned DEBOUNCE_THRESH = 200;
+    /** Distance between the origins of two adjacent keys of the grid, both horizontally and vertically */
+    constexpr static unsigned KEY_PITCH = 32;
+    /** Width and height of a regular key */
+    constexpr static unsigned KEY_SIZE = KEY_PITCH - 1;
+
+    /** X-coordinate of the first key of each row of the grid (the last row is irregular, and is laid out separately) */
+    constexpr static unsigned ROW_ORIGIN[NUM_ROWS - 1] = {1, 1, 17, 81};
+
+    /** Index of the first key of each row within `keys` */
+    constexpr static unsigned FIRST_KEY[NUM_ROWS] = {
+        0,
+        NUM_KEYS[0],
+        NUM_KEYS[0] + NUM_KEYS[1],
+        NUM_KEYS[0] + NUM_KEYS[1] + NUM_KEYS[2],
+        NUM_KEYS[0] + NUM_KEYS[1] + NUM_KEYS[2] + NUM_KEYS[3]
+    };
+
+    /** Style shared by the regular keys, the shift key, the space bar and the backspace key */
+    static const ButtonStyle KEY_STYLE;
 
     /** Flag to indicate if the bitmap is in a pressed state or not */
     bool pressed {false};
@@ -118,9 +198,6 @@ protected:
     /** Reference to event queue for posting events */
     RingQueueInterface<callback_event_t> *event_queue {nullptr};
 
-    /** The epoch when the widget was last pressed */
-    unsigned last_press_epoch {0};
-
 public:
 
     /**
@@ -195,10 +272,27 @@ protected:
     Keyboard(Frame *parent);
 
     /**
-     * @brief               Update the keys based on the shift position
+     * @brief               Update the keys based on the shift position, relabelling only the keys whose labels differ
+     *
+     * @param old_shift_i     Shift position that the keys are currently labelled for
+     *
+     */
+    void update_keys(unsigned old_shift_i);
+
+    /**
+     * @brief               Find the button under a point from the geometry of the grid, instead of testing every button in turn
+     *
+     * @note                The coordinates of the point must be relative to the keyboard
+     *
+     * @param x             X-coordinate of the point (offset from the keyboard's left-edge)
+     * @param y             Y-coordinate of the point (offset from the keyboard's top-edge)
+     * @param row           Set to the row of the key in `KEYBOARD_KEYS` (only if the button is a regular key)
+     * @param col           Set to the column of the key in `KEYBOARD_KEYS` (only if the button is a regular key)
+     *
+     * @return              Pointer to the button under the point (nullptr if there is none)
      *
      */
-    void update_keys();
+    Button *find_button(unsigned x, unsigned y, unsigned *row, unsigned *col) const;
 };
 
 #endif
@@ -12,6 +12,8 @@
 
 #include "widget.h"
 #include "frame.h"
+#include "fixedstring.h"
+#include "sharedstyle.h"
 
 /**
  * @brief                   Class to encapsulate style information of a label
@@ -32,6 +34,12 @@ protected:
 
 public:
 
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "LabelStyle";
+
+    /** Style that labels use unless they are given a different one */
+    static const LabelStyle DEFAULT;
+
     /** Enumueration of different ways to align text horizontally */
     enum HorizontalAlignment {
         CENTER_ALIGN = 0,
@@ -115,6 +123,9 @@ class Label : public BasicWidget {
 
 protected:
 
+    /** Maximum number of characters in the text shown by the label */
+    constexpr static unsigned MESSAGE_CAPACITY = 40;
+
     /** Reference to parent frame */
     Frame *parent {nullptr};
 
@@ -141,13 +152,32 @@ protected:
     unsigned widget_h;
 
     /** Text to display on the label */
-    String message {};
-
-    /** Style information about the label */
-    LabelStyle style;
+    FixedString<MESSAGE_CAPACITY> message {};
+
+    /** X-coordinate of the text origin within the parent (cached, valid only if `layout_valid` is set) */
+    unsigned text_x {0};
+    /** Y-coordinate of the text baseline within the parent (cached, valid only if `layout_valid` is set) */
+    unsigned text_y {0};
+    /** Width of the text's bounding box (cached, valid only if `layout_valid` is set) */
+    uint16_t text_w {0};
+    /** Height of the text's bounding box (cached, valid only if `layout_valid` is set) */
+    uint16_t text_h {0};
+    /** Flag to indicate if the cached text layout matches the current message, style and size */
+    bool layout_valid {false};
+
+    /** Style information about the label (shared with other labels until it is changed through `get_style`) */
+    SharedStyle<LabelStyle> style {&LabelStyle::DEFAULT};
 
 public:
 
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "Label";
+
+    /** Return the widget to the widget pool, counted against `TYPE_NAME` */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, TYPE_NAME);
+    }
+
     /**
      * @brief               Default constructor disabled (use the `create` method)
      *
@@ -173,6 +203,8 @@ public:
     /**
      * @brief               Set the text that the label should display
      *
+     * @note                Text longer than `MESSAGE_CAPACITY` characters is truncated
+     *
      * @param msg_ptr       Pointer to message string
      *
      * @return              Pointer to the button (allows chaining method calls)
@@ -183,10 +215,10 @@ public:
     /**
      * @brief               Get the text that is on the label
      *
-     * @return              An owned copy of the text
+     * @return              Pointer to the null-terminated text (valid until the text is changed)
      *
      */
-    String get_message() const;
+    const char *get_message() const;
 
     /**
      * @brief               Get the number of characters in the text
@@ -199,6 +231,8 @@ public:
     /**
      * @brief               Append a character to the text on the label
      *
+     * @note                If the text is already at its capacity (`MESSAGE_CAPACITY`), the character is discarded
+     *
      * @param ch            Character to append
      *
      * @return              Pointer to the label (allows chaining method calls)
@@ -216,6 +250,8 @@ public:
     /**
      * @brief               Get a reference to the style object of the label to change its appearance
      *
+     * @note                If the style is shared with other labels, it is first copied so that only this label changes
+     *
      * @see                 `LabelStyle`
      *
      * @return              Pointer to the style object
@@ -223,6 +259,16 @@ public:
      */
     LabelStyle *get_style();
 
+    /**
+     * @brief               Share a style with other labels (discards any changes made through `get_style`)
+     *
+     * @param shared_style  Reference to the style (must outlive the label, usually a `static const` object)
+     *
+     * @return              Pointer to the label (allows chaining method calls)
+     *
+     */
+    Label *set_style(const LabelStyle *shared_style);
+
     // BasicWidget overrides
 
     Frame *get_parent() override;
@@ -273,6 +319,14 @@ protected:
      *
      */
     void render_text();
+
+    /**
+     * @brief               Helper function to measure the text and compute its origin, which are cached until the message or style changes
+     *
+     * @note                The font for the current text size must already be set on the parent
+     *
+     */
+    void update_layout();
 };
 
 #endif
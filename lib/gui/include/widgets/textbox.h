@@ -18,9 +18,6 @@ class TextBox : public Label, public InteractiveWidget {
 
 protected:
 
-    /** The cooldown period between two presses (used to prevent "bouncing", where a single press is detected as multiple) */
-    constexpr static unsigned DEBOUNCE_THRESH = 200;
-
     /** Flag to indicate if the bitmap is in a pressed state or not */
     bool pressed {false};
     /** Flag to indicate if interacting with the bitmap is enabled or disabled */
@@ -37,11 +34,33 @@ protected:
     /** Reference to event queue for posting events */
     RingQueueInterface<callback_event_t> *event_queue {nullptr};
 
-    /** The epoch when the widget was last pressed */
-    unsigned last_press_epoch {0};
+    /** Flag to indicate if only the end of the text has changed since it was last drawn */
+    bool partially_dirty {false};
+    /** Flag to indicate if the text currently on the display was drawn by this widget (and the fields below are valid) */
+    bool drawn {false};
+
+    /** Number of leading characters of the text that have not changed since the text was last drawn */
+    unsigned stable_len {0};
+    /** Y-coordinate of the text baseline when the text was last drawn */
+    unsigned drawn_text_y {0};
+
+    /** Right edge of the pixels set by the text when it was last drawn (relative to the parent) */
+    int16_t ink_right {0};
+    /** Top edge of the pixels set by the text when it was last drawn (relative to the parent) */
+    int16_t ink_top {0};
+    /** Bottom edge of the pixels set by the text when it was last drawn (relative to the parent) */
+    int16_t ink_bottom {0};
 
 public:
 
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "TextBox";
+
+    /** Return the widget to the widget pool, counted against `TYPE_NAME` */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, TYPE_NAME);
+    }
+
     /**
      * @brief               Default constructor disabled (use the `create` method)
      *
@@ -64,8 +83,36 @@ public:
      */
     static TextBox *create(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height);
 
+    /**
+     * @brief               Append a character to the text in the textbox
+     *
+     * @note                If the text is left-aligned, only the new glyph is drawn (unless the baseline of the text moves)
+     *
+     * @param ch            Character to append
+     *
+     * @return              Pointer to the textbox (allows chaining method calls)
+     *
+     */
+    TextBox *append_to_message(char ch);
+
+    /**
+     * @brief               Pop the last character from the text in the textbox
+     *
+     * @note                If the text is left-aligned, only the removed glyph is erased (unless the baseline of the text moves)
+     *
+     * @return              Pointer to the textbox (allows chaining method calls)
+     *
+     */
+    TextBox *pop_from_message();
+
     // Label overrides
 
+    bool get_partially_dirty() const override;
+
+    void draw() override;
+    bool draw_partial() override;
+    void clear() override;
+
     bool propagate_press(unsigned x, unsigned y) override;
     bool propagate_release(unsigned x, unsigned y) override;
 
@@ -102,6 +149,28 @@ protected:
      *
      */
     TextBox(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height);
+
+    /**
+     * @brief               Mark the text as partially dirty after characters were appended or removed from its end
+     *
+     * @param was_dirty     Whether the textbox was already dirty before the text was changed
+     * @param old_len       Length of the text before it was changed
+     *
+     */
+    void set_partially_dirty(bool was_dirty, unsigned old_len);
+
+    /**
+     * @brief               Measure the leading characters of the text, using the metrics of the glyphs in the font
+     *
+     * @param len           Number of leading characters to measure
+     * @param right         Set to the right edge of the pixels set by the characters (relative to the parent)
+     * @param top           Set to the top edge of the pixels set by the characters (relative to the parent)
+     * @param bottom        Set to the bottom edge of the pixels set by the characters (relative to the parent)
+     *
+     * @return              X-coordinate of the cursor after the characters (relative to the parent)
+     *
+     */
+    unsigned measure_text(unsigned len, int16_t *right, int16_t *top, int16_t *bottom) const;
 };
 
 #endif
@@ -11,6 +11,7 @@
 #include "vector"
 
 #include "frame.h"
+#include "childlist.h"
 #include "app.h"
 
 /**
@@ -32,10 +33,18 @@ protected:
     bool dirty {false};
 
     /** List of children of the view */
-    std::vector<BasicWidget *> children;
+    ChildList children;
 
 public:
 
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "View";
+
+    /** Return the widget to the widget pool, counted against `TYPE_NAME` */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, TYPE_NAME);
+    }
+
     /**
      * @brief               Default constructor disabled (use the `create` method)\
      *
@@ -51,6 +60,14 @@ public:
      */
     static View *create(App *parent);
 
+    /**
+     * @brief               Destroy the view and all of its children
+     *
+     * @note                The view must be removed from its app before it is destroyed (see `App::release_idle_views`)
+     *
+     */
+    ~View() override;
+
     // BasicWidget overrides
 
     /**
@@ -209,6 +226,18 @@ public:
      */
     bool propagate_release(unsigned x, unsigned y) override;
 
+    /**
+     * @brief               Propagate a gesture down this widget's subtree, consuming it
+     *
+     * @note                The coordinates of the gesture must be relative to its parent, not necessarily the screen
+     *
+     * @param gesture       Gesture to propagate (located at the point where the stylus touched the screen)
+     *
+     * @return true         Always
+     *
+     */
+    bool propagate_gesture(const gesture_t &gesture) override;
+
     /**
      * @brief               Report the current visibility of the widget
      *
@@ -391,6 +420,9 @@ public:
      */
     View *print(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color) override;
 
+    /** Print a string with a transparent background, without caching its glyphs (see `DrawableWidget::print_uncached`) */
+    View *print_uncached(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color) override;
+
     /**
      * @brief               Print a string with a transparent background
      *
@@ -421,6 +453,15 @@ public:
      */
     View *draw_rgb_bitmap(unsigned x, unsigned y, const uint16_t *data, unsigned width, unsigned height) override;
 
+    /** Begin streaming colors into a rectangular window (see `DrawableWidget::begin_write_window`) */
+    View *begin_write_window(unsigned x, unsigned y, unsigned w, unsigned h) override;
+    /** Stream colors into the current window */
+    View *write_colors(const uint16_t *colors, unsigned count) override;
+    /** Stream a single color repeatedly into the current window */
+    View *write_color_run(uint16_t color, unsigned count) override;
+    /** Finish streaming colors into the current window */
+    View *end_write_window() override;
+
     /**
      * @brief               Add a child to this view
      *
@@ -478,6 +519,23 @@ public:
      */
     View *send_back(BasicWidget *child, unsigned amt) override;
 
+    /**
+     * @brief               Index the children of this view by their position, so that presses and releases are only passed to the children under them
+     *
+     * @return              Pointer to view (allows chaining method calls)
+     *
+     */
+    View *enable_spatial_index() override;
+
+    /**
+     * @brief               Update the visibility of a child that is mirrored in the list of children
+     *
+     * @param child         Reference to the child
+     * @param visible       New visibility of the child
+     *
+     */
+    void notify_visibility(BasicWidget *child, bool visible) override;
+
     /**
      * #brief               Enqueue all dirty widgets (that need to be redrawn/cleared) in the view's subtree from higher Z-index to lower
      *
@@ -11,8 +11,11 @@
 #include "Arduino.h"
 #include "Adafruit_GFX.h"
 #include "constants.h"
+#include "gesture.h"
+#include "widgetpool.h"
 
 #include "functional"
+#include "new"
 #include "queue"
 
 #include "Fonts/PlusJakartaSans6pt7b.h" // size 1
@@ -24,6 +27,8 @@
 #define FUNCTION_PTR_CALLBACK
 /** If defined, then the get_at method of the app is valid (this is not possible using the Adafruit_GFX class, and requires the MCUFRIEND_kbv subclass) */
 #define READ_PIXEL_ENABLED
+/** If defined, then the glyphs printed by the app are rasterized once and cached as run-length encoded masks (uses about 4.5KB of RAM; disabled because it has not been timed on the device, compare the `App::print` zone of the profiler with and without it) */
+// #define GLYPH_CACHE_ENABLED
 
 /** Font to use for text size 1 */
 #define font_1 (&PlusJakartaSans_SemiBold6pt7b)
@@ -34,6 +39,24 @@
 /** Font to use for text size 4 */
 #define font_4 (&PlusJakartaSans_SemiBold21pt7b)
 
+/**
+ * @brief                   Get the font to use for a text size
+ *
+ * @param text_size         Size of the text (sizes larger than 4 use the font for size 4)
+ *
+ * @return                  Pointer to the font
+ *
+ */
+inline const GFXfont *font_for_size(unsigned text_size) {
+
+    switch (text_size) {
+        case 1:         return font_1;
+        case 2:         return font_2;
+        case 3:         return font_3;
+        default:        return font_4;
+    }
+}
+
 /**
  * @brief                   Interface for a Ring Queue data structure (template)
  *
@@ -119,11 +142,14 @@ public:
      *
      *                      The queue uses the object's operator= function to store it within an internal array
      *
-     * @warning             If this function was called when the queue was full, the queue will go into an invalid state
+     * @warning             If this function is called when the queue is full, the element is discarded
      *
      * @param e             Element to push to the back of the queue
      */
     void push(const T &e) override {
+        if (size == CAPACITY) {
+            return;
+        }
         arr[head] = e;
         (head += 1) %= CAPACITY;
         ++size;
@@ -175,6 +201,12 @@ class BasicWidget {
 
 public:
 
+    /**
+     * @brief               Destroy the widget (frames destroy their children as well)
+     *
+     */
+    virtual ~BasicWidget() = default;
+
     /**
      * @brief               Get a reference to the parent of this widget
      *
@@ -234,7 +266,7 @@ public:
     /**
      * @brief               Report if this widget is dirty and requires redrawing
      *
-     * @note                The dirtyness of a wiget is not partial, i.e. it indicates that the whole widget must be re-drawn
+     * @note                The dirtyness of a wiget is not partial, i.e. it indicates that the whole widget must be re-drawn (see also `BasicWidget::get_partially_dirty`)
      * @note                The widget can become dirty if its own state was updated or a widget overlapping with it has become dirty
      *
      * @return false        If the widget does not need to be redrawn
@@ -278,6 +310,26 @@ public:
      */
     virtual void clear() = 0;
 
+    /**
+     * @brief               Report if only a part of this widget has changed, which can be redrawn without redrawing the whole widget
+     *
+     * @note                A widget that is dirty must be redrawn completely, irrespective of this status
+     *
+     * @return false        If no part of the widget needs to be redrawn on its own
+     * @return true         If the changed part of the widget can be redrawn using `BasicWidget::draw_partial`
+     *
+     */
+    virtual bool get_partially_dirty() const { return false; }
+
+    /**
+     * @brief               Redraw only the changed part of the widget, and reset its partially dirty status
+     *
+     * @return false        If the change could not be drawn on its own (the widget marks itself dirty and must be redrawn completely)
+     * @return true         If the change was drawn
+     *
+     */
+    virtual bool draw_partial() { return false; }
+
     /**
      * @brief               Check whether a point intersects with this widget's bounding box
      *
@@ -331,6 +383,19 @@ public:
      */
     virtual bool propagate_release(unsigned x, unsigned y) = 0;
 
+    /**
+     * @brief               Propagate a gesture down this widget's subtree, consuming it
+     *
+     * @note                The coordinates of the gesture must be relative to its parent, not necessarily the screen
+     * @note                Widgets ignore gestures by default, and only override this to handle them (frames pass them down)
+     *
+     * @param gesture       Gesture to propagate (located at the point where the stylus touched the screen)
+     *
+     * @return false        If the gesture was not consumed by this widget
+     * @return true         If the gesture was consumed by this widget
+     */
+    virtual bool propagate_gesture(const gesture_t &gesture) { return false; }
+
     /**
      * @brief               Report the current visibility of the widget
      *
@@ -354,6 +419,35 @@ public:
      * @return              Whether the widget is a frame or not
      */
     virtual bool is_frame() const { return false; }
+
+    /**
+     * @brief               Allocate a widget from the widget pool instead of the heap (see `WidgetPool`)
+     *
+     * @code{.cpp}
+     *                      Button *button = new (std::nothrow, Button::TYPE_NAME) Button(...);
+     * @endcode
+     *
+     * @param size          Number of bytes required by the widget
+     * @param type_name     Name of the widget's type (used to report the memory used by each type)
+     *
+     * @return              Pointer to the memory (nullptr if it could not be allocated)
+     *
+     */
+    static void *operator new(size_t size, const std::nothrow_t &, const char *type_name) noexcept {
+        return WidgetPool::allocate(size, type_name);
+    }
+
+    /**
+     * @brief               Return a widget to the widget pool
+     *
+     * @note                The pool cannot tell the type of the widget from here, so every widget that is allocated from
+     *                      the pool declares its own `operator delete` that passes its `TYPE_NAME` (otherwise the
+     *                      statistics of its type keep counting it after it is deleted)
+     *
+     */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, nullptr);
+    }
 };
 
 /**
@@ -374,10 +468,19 @@ public:
     using callback_t = std::function<void (unsigned *)>;
 #endif
 
-    /** Structure that holds the details necessary to execute a single-event, namely a pointer to the callback and a pointer to the arguments */
+    /** Priorities with which events are dispatched (events with a lower value are dispatched first) */
+    enum event_priority_t : uint8_t {
+        EVENT_PRIORITY_INPUT,
+        EVENT_PRIORITY_NORMAL,
+        EVENT_PRIORITY_STATUS,
+        EVENT_PRIORITY_COUNT
+    };
+
+    /** Structure that holds the details necessary to execute a single-event, namely a pointer to the callback, a pointer to the arguments and its priority */
     struct callback_event_t {
         callback_t cb;
         unsigned *args;
+        event_priority_t priority {EVENT_PRIORITY_INPUT};
     };
 
     /**
@@ -663,6 +766,23 @@ public:
      */
     virtual DrawableWidget *print(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color) = 0;
 
+    /**
+     * @brief               Print a string with a transparent background, without caching its glyphs
+     *
+     * @note                Used for text that changes with every draw (such as the text being typed), whose glyphs would only
+     *                      evict the glyphs of the labels that are drawn repeatedly
+     *
+     * @param text          String to print
+     * @param x             X-coordinate of the bottom-left corner of the text-box (offset from left-edge)
+     * @param x             Y-coordinate of the bottom-left corner of the text-box (offset from top-edge)
+     * @param text_size     Size of the text
+     * @param fg_color      Color of the text
+     *
+     * @return              Pointer to the widget (allows chaining method calls)
+     *
+     */
+    virtual DrawableWidget *print_uncached(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color) = 0;
+
     /**
      * @brief               Print a string with a transparent background
      *
@@ -692,6 +812,52 @@ public:
      * @return              Pointer to the widget (allows chaining method calls)
      */
     virtual DrawableWidget *draw_rgb_bitmap(unsigned x, unsigned y, const uint16_t *data, unsigned width, unsigned height) = 0;
+
+    /**
+     * @brief               Begin streaming colors into a rectangular window, which is filled row by row from its top-left corner
+     *
+     * @warning             The window must lie completely within the display
+     * @warning             No other drawing method may be called until `end_write_window` is called
+     *
+     * @param x             X-coordinate of the top-left corner of the window (offset from left-edge)
+     * @param y             Y-coordinate of the top-left corner of the window (offset from top-edge)
+     * @param w             Width of the window
+     * @param h             Height of the window
+     *
+     * @return              Pointer to the widget (allows chaining method calls)
+     *
+     */
+    virtual DrawableWidget *begin_write_window(unsigned x, unsigned y, unsigned w, unsigned h) = 0;
+
+    /**
+     * @brief               Stream colors into the window opened by `begin_write_window`
+     *
+     * @param colors        Pointer to the array of colors (may be stored in flash)
+     * @param count         Number of colors in the array
+     *
+     * @return              Pointer to the widget (allows chaining method calls)
+     *
+     */
+    virtual DrawableWidget *write_colors(const uint16_t *colors, unsigned count) = 0;
+
+    /**
+     * @brief               Stream a single color repeatedly into the window opened by `begin_write_window`
+     *
+     * @param color         16-bit color to write
+     * @param count         Number of times to write the color
+     *
+     * @return              Pointer to the widget (allows chaining method calls)
+     *
+     */
+    virtual DrawableWidget *write_color_run(uint16_t color, unsigned count) = 0;
+
+    /**
+     * @brief               Finish streaming colors into the window opened by `begin_write_window`
+     *
+     * @return              Pointer to the widget (allows chaining method calls)
+     *
+     */
+    virtual DrawableWidget *end_write_window() = 0;
 };
 
 #endif
@@ -10,6 +10,7 @@
 
 #include "widget.h"
 #include "frame.h"
+#include "childlist.h"
 
 #include "vector"
 #include "algorithm"
@@ -95,13 +96,21 @@ protected:
     unsigned widget_h;
 
     /** List of children of the window */
-    std::vector<BasicWidget *> children;
+    ChildList children;
 
     /** Style information about the window */
     WindowStyle style;
 
 public:
 
+    /** Name of the type (used for the statistics of the widget pool) */
+    constexpr static const char *TYPE_NAME = "Window";
+
+    /** Return the widget to the widget pool, counted against `TYPE_NAME` */
+    static void operator delete(void *ptr, size_t size) noexcept {
+        WidgetPool::release(ptr, size, TYPE_NAME);
+    }
+
     /**
      * @brief               Default constructor disabled (use the `create` method)
      *
@@ -124,6 +133,12 @@ public:
      */
     static Window *create(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height);
 
+    /**
+     * @brief               Destroy the window and all of its children
+     *
+     */
+    ~Window() override;
+
     /**
      * @brief               Get a reference to the style object of the button to change its appearance
      *
@@ -161,6 +176,7 @@ public:
 
     bool propagate_press(unsigned x, unsigned y) override;
     bool propagate_release(unsigned x, unsigned y) override;
+    bool propagate_gesture(const gesture_t &gesture) override;
 
     bool get_visibility() const override;
     void set_visibility(bool new_visibility) override;
@@ -186,21 +202,28 @@ public:
     Window *set_font(const GFXfont *f);
 
     Window *print(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color) override;
+    Window *print_uncached(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color) override;
     Window *print_opaque(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color, uint16_t bg_color) override;
 
     Window *draw_rgb_bitmap(unsigned x, unsigned y, const uint16_t *data, unsigned width, unsigned height);
 
+    Window *begin_write_window(unsigned x, unsigned y, unsigned w, unsigned h) override;
+    Window *write_colors(const uint16_t *colors, unsigned count) override;
+    Window *write_color_run(uint16_t color, unsigned count) override;
+    Window *end_write_window() override;
+
     Window *add_child(BasicWidget *child) override;
     unsigned get_children_count() const override;
 
     Window *send_front(BasicWidget *child, unsigned amt) override;
     Window *send_back(BasicWidget *child, unsigned amt) override;
+    Window *enable_spatial_index() override;
+    void notify_visibility(BasicWidget *child, bool visible) override;
 
     void collect_dirty_widgets(RingQueueInterface<BasicWidget *> *dirty_widgets) override;
     void collect_overlapped_widgets(BasicWidget *dirty, BasicWidget *child, RingQueueInterface<BasicWidget *> *overlapping_widgets) override;
     void collect_underlapped_widgets(BasicWidget *child, RingQueueInterface<BasicWidget *> *overlapping_widgets) override;
 
-
 protected:
 
     /**
@@ -0,0 +1,111 @@
+/**
+ * @file                    bitmapasset.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   This file implements the methods of the `BitmapDecoder` class
+ *
+ */
+
+#include "bitmapasset.h"
+
+BitmapDecoder::BitmapDecoder(const bitmap_asset_t *asset)
+    : asset {asset}
+    , pos {asset->data}
+    , end {asset->data + asset->data_len}
+{}
+
+bool BitmapDecoder::next_span(span_t *span) {
+
+    if (y >= asset->height) {
+        return false;
+    }
+
+    if (remaining == 0 && !read_token()) {
+        return false;
+    }
+
+    span->x = x;
+    span->y = y;
+    span->fill = run;
+
+    if (run) {
+
+        span->color = run_color;
+
+        // a run that starts at the left edge is returned as a rectangle of whole rows
+        if (x == 0 && remaining >= asset->width) {
+            span->w = asset->width;
+            span->h = remaining / asset->width;
+        }
+        else {
+            span->w = min<unsigned>(remaining, asset->width - x);
+            span->h = 1;
+        }
+    }
+    else {
+
+        span->w = min<unsigned>(min<unsigned>(remaining, asset->width - x), SPAN_PIXELS);
+        span->h = 1;
+
+        for (unsigned idx = 0; idx < span->w; ++idx) {
+            span->pixels[idx] = read_pixel();
+        }
+    }
+
+    remaining -= span->w * span->h;
+    advance(span->w * span->h);
+
+    return true;
+}
+
+bool BitmapDecoder::read_token() {
+
+    uint8_t token;
+
+    if (pos >= end) {
+        return false;
+    }
+
+    token = *pos++;
+
+    if (token < BITMAP_RUN_TOKEN) {
+        run = false;
+        remaining = token + 1;
+        return true;
+    }
+
+    run = true;
+
+    if (token == BITMAP_LONG_RUN_TOKEN) {
+        remaining = pos[0] | (pos[1] << 8);
+        pos += 2;
+    }
+    else {
+        remaining = token - BITMAP_RUN_TOKEN + 1;
+    }
+    run_color = read_pixel();
+
+    return true;
+}
+
+uint16_t BitmapDecoder::read_pixel() {
+
+    uint8_t code = *pos++;
+    uint16_t color;
+
+    if (code != BITMAP_ESCAPE_CODE) {
+        return asset->palette[code];
+    }
+
+    color = pos[0] | (pos[1] << 8);
+    pos += 2;
+
+    return color;
+}
+
+void BitmapDecoder::advance(unsigned count) {
+
+    count += x;
+
+    y += count / asset->width;
+    x = count % asset->width;
+}
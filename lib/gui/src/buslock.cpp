@@ -0,0 +1,18 @@
+/**
+ * @file                    buslock.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   This file implements the methods of the `BusLock` class
+ *
+ */
+
+#include "buslock.h"
+
+volatile uint8_t BusLock::depth {0};
+
+// only the main context changes the depth, so the read-modify-write can not be torn by an interrupt that reads it
+
+void BusLock::acquire() { depth = depth + 1; }
+
+void BusLock::release() { depth = depth - 1; }
+
+bool BusLock::is_held() { return depth != 0; }
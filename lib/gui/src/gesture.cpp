@@ -0,0 +1,144 @@
+/**
+ * @file                    gesture.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   This file implements the methods of the `GestureRecognizer` class
+ *
+ */
+
+#include "gesture.h"
+
+bool GestureRecognizer::update(bool touched, unsigned x, unsigned y, uint32_t time, gesture_t *gesture) {
+
+    // the stylus was lifted; report how the touch ended (an ignored touch reports nothing)
+    if (!touched) {
+
+        state_t prev_state = state;
+        state = STATE_IDLE;
+
+        switch (prev_state) {
+
+            case STATE_PRESSED:
+                release_available = true;
+                make_gesture(GESTURE_TAP, time, gesture);
+                return true;
+
+            case STATE_LONG_PRESSED:
+                release_available = true;
+                return false;
+
+            case STATE_DRAGGING: {
+                unsigned speed_x = (vx < 0) ? -vx : vx;
+                unsigned speed_y = (vy < 0) ? -vy : vy;
+
+                release_available = true;
+                make_gesture((speed_x >= SWIPE_THRESH || speed_y >= SWIPE_THRESH) ? GESTURE_SWIPE : GESTURE_DRAG_END, time, gesture);
+                return true;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    // the stylus touched the screen; the touch is ignored if it started too soon after the last one
+    if (state == STATE_IDLE) {
+
+        if (has_started && (time - last_start_time) < (DEBOUNCE_THRESH * 1000UL)) {
+            state = STATE_IGNORED;
+            return false;
+        }
+
+        state = STATE_PRESSED;
+        has_started = true;
+        last_start_time = time;
+
+        start_x = last_x = x;
+        start_y = last_y = y;
+        last_time = time;
+        vx = vy = 0;
+
+        press_available = true;
+        return false;
+    }
+
+    if (state == STATE_IGNORED) {
+        return false;
+    }
+
+    // the velocity is averaged with the previous one, since a single pair of samples is too noisy
+    {
+        uint32_t dt = time - last_time;
+
+        if (dt != 0) {
+            vx = (vx + ((int32_t)(x - last_x) * 1000000L) / (int32_t)dt) / 2;
+            vy = (vy + ((int32_t)(y - last_y) * 1000000L) / (int32_t)dt) / 2;
+        }
+
+        last_x = x;
+        last_y = y;
+        last_time = time;
+    }
+
+    if (state != STATE_DRAGGING) {
+
+        unsigned dist_x = (x > start_x) ? (x - start_x) : (start_x - x);
+        unsigned dist_y = (y > start_y) ? (y - start_y) : (start_y - y);
+
+        if (dist_x >= DRAG_THRESH || dist_y >= DRAG_THRESH) {
+            state = STATE_DRAGGING;
+        }
+        else if (state == STATE_PRESSED && (time - last_start_time) >= (LONG_PRESS_THRESH * 1000UL)) {
+            state = STATE_LONG_PRESSED;
+            make_gesture(GESTURE_LONG_PRESS, time, gesture);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
+
+    make_gesture(GESTURE_DRAG, time, gesture);
+    return true;
+}
+
+bool GestureRecognizer::get_press(unsigned *x, unsigned *y) {
+
+    if (!press_available) {
+        return false;
+    }
+
+    press_available = false;
+    *x = start_x;
+    *y = start_y;
+    return true;
+}
+
+bool GestureRecognizer::get_release(unsigned *x, unsigned *y) {
+
+    if (!release_available) {
+        return false;
+    }
+
+    release_available = false;
+    *x = start_x;
+    *y = start_y;
+    return true;
+}
+
+void GestureRecognizer::make_gesture(gesture_type_t type, uint32_t time, gesture_t *gesture) const {
+
+    uint32_t duration = (time - last_start_time) / 1000;
+
+    gesture->type = type;
+
+    gesture->x = start_x;
+    gesture->y = start_y;
+
+    gesture->dx = (int16_t)(last_x - start_x);
+    gesture->dy = (int16_t)(last_y - start_y);
+
+    gesture->vx = constrain(vx, INT16_MIN, INT16_MAX);
+    gesture->vy = constrain(vy, INT16_MIN, INT16_MAX);
+
+    gesture->duration = (duration > UINT16_MAX) ? UINT16_MAX : duration;
+}
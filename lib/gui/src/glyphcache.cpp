@@ -0,0 +1,229 @@
+/**
+ * @file                    glyphcache.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   This file implements the methods of the `GlyphCache` class
+ *
+ */
+
+#include "cstring"
+
+#include "glyphcache.h"
+
+/*
+ * Layout of an entry in the arena -
+ *
+ *  - for each row of the glyph, the number of runs in the row followed by the length of each run
+ *
+ * The runs of a row alternate between unset and set pixels, starting with unset pixels, and the trailing run of unset
+ * pixels is implied by the width of the glyph. Since a glyph is atmost 255 pixels wide, every run fits in a byte
+ */
+
+bool GlyphCache::print(Adafruit_GFX *display, const GFXfont *font, const char *text, unsigned x, unsigned y, uint16_t color) {
+
+    signed cursor = x;
+
+    if (font == nullptr) {
+        return false;
+    }
+
+    // mirrors the way the display advances its cursor while printing (see `Adafruit_GFX::write`), and leaves the strings
+    // that the display would wrap or break into lines to the display, before anything is drawn
+    for (const char *ptr = text; *ptr != '\0'; ++ptr) {
+
+        uint8_t ch = *ptr;
+
+        if (ch == '\n') {
+            return false;
+        }
+        if (ch == '\r' || ch < font->first || ch > font->last) {
+            continue;
+        }
+
+        const GFXglyph &glyph = font->glyph[ch - font->first];
+
+        if (glyph.width != 0 && glyph.height != 0 && cursor + glyph.xOffset + glyph.width > display->width()) {
+            return false;
+        }
+        cursor += glyph.xAdvance;
+    }
+
+    cursor = x;
+
+    for (const char *ptr = text; *ptr != '\0'; ++ptr) {
+
+        uint8_t ch = *ptr;
+        unsigned idx;
+
+        if (ch == '\r' || ch < font->first || ch > font->last) {
+            continue;
+        }
+
+        const GFXglyph &glyph = font->glyph[ch - font->first];
+
+        if (glyph.width != 0 && glyph.height != 0) {
+
+            idx = find(font, ch);
+
+            if (idx != num_entries) {
+                ++hits;
+            }
+            else {
+                ++misses;
+                idx = insert(font, ch);
+            }
+
+            if (idx != num_entries) {
+                entries[idx].last_used = ++clock;
+                blit(display, glyph, entries[idx], cursor, y, color);
+            }
+            else {
+                display->drawChar(cursor, y, ch, color, color, 1);
+            }
+        }
+
+        cursor += glyph.xAdvance;
+    }
+
+    return true;
+}
+
+void GlyphCache::clear() {
+    num_entries = 0;
+    arena_used = 0;
+}
+
+unsigned GlyphCache::find(const GFXfont *font, uint8_t ch) const {
+
+    for (unsigned idx = 0; idx < num_entries; ++idx) {
+        if (entries[idx].ch == ch && entries[idx].font == font) {
+            return idx;
+        }
+    }
+
+    return num_entries;
+}
+
+unsigned GlyphCache::insert(const GFXfont *font, uint8_t ch) {
+
+    const GFXglyph &glyph = font->glyph[ch - font->first];
+    unsigned size = encode(glyph, font->bitmap, nullptr);
+
+    if (size == 0 || size > ARENA_BYTES) {
+        return num_entries;
+    }
+
+    // make room by evicting the least recently used entries
+    while (num_entries == MAX_ENTRIES || arena_used + size > ARENA_BYTES) {
+
+        unsigned lru = 0;
+        for (unsigned idx = 1; idx < num_entries; ++idx) {
+            if ((int16_t)(entries[idx].last_used - entries[lru].last_used) < 0) {
+                lru = idx;
+            }
+        }
+        evict(lru);
+    }
+
+    entries[num_entries] = {font, (uint16_t)arena_used, (uint16_t)size, 0, ch};
+    encode(glyph, font->bitmap, &arena[arena_used]);
+    arena_used += size;
+
+    return num_entries++;
+}
+
+unsigned GlyphCache::encode(const GFXglyph &glyph, const uint8_t *bitmap, uint8_t *out) {
+
+    // the rows of a glyph are packed without padding, most significant bit first
+    const uint8_t *bits = &bitmap[glyph.bitmapOffset];
+    unsigned bit = 0;
+    unsigned size = 0;
+
+    for (unsigned r = 0; r < glyph.height; ++r) {
+
+        unsigned count_pos = size++;
+        unsigned count = 0;
+        bool set = false;
+        unsigned run = 0;
+
+        for (unsigned c = 0; c <= glyph.width; ++c) {
+
+            bool pixel = false;
+
+            if (c < glyph.width) {
+                pixel = (bits[bit >> 3] >> (7 - (bit & 7))) & 1;
+                ++bit;
+
+                if (pixel == set) {
+                    ++run;
+                    continue;
+                }
+            }
+
+            // the trailing run of unset pixels is not stored
+            if (c == glyph.width && !set) {
+                break;
+            }
+
+            if (out != nullptr) {
+                out[size] = run;
+            }
+            ++size;
+            ++count;
+
+            set = !set;
+            run = 1;
+        }
+
+        if (count > 255) {
+            return 0;
+        }
+        if (out != nullptr) {
+            out[count_pos] = count;
+        }
+    }
+
+    return size;
+}
+
+void GlyphCache::evict(unsigned idx) {
+
+    unsigned start = entries[idx].offset;
+    unsigned size = entries[idx].size;
+
+    memmove(&arena[start], &arena[start + size], arena_used - start - size);
+    arena_used -= size;
+
+    for (unsigned other = idx + 1; other < num_entries; ++other) {
+        entries[other - 1] = entries[other];
+        entries[other - 1].offset -= size;
+    }
+    --num_entries;
+}
+
+void GlyphCache::blit(Adafruit_GFX *display, const GFXglyph &glyph, const entry_t &entry, signed x, signed y, uint16_t color) const {
+
+    const uint8_t *ptr = &arena[entry.offset];
+
+    signed left = x + glyph.xOffset;
+    signed top = y + glyph.yOffset;
+
+    display->startWrite();
+
+    for (unsigned r = 0; r < glyph.height; ++r) {
+
+        unsigned count = *ptr++;
+        signed c = left;
+
+        for (unsigned i = 0; i < count; ++i) {
+
+            unsigned run = *ptr++;
+
+            if (i & 1) {
+                display->writeFastHLine(c, top + r, run, color);
+            }
+            c += run;
+        }
+    }
+
+    display->endWrite();
+}
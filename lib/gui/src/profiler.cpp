@@ -0,0 +1,185 @@
+/**
+ * @file                    profiler.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   This file implements the methods of the `Profiler` class
+ *
+ */
+
+#include "profiler.h"
+
+#ifdef PROFILER_ENABLED
+
+#ifndef ARDUINO
+#include "chrono"
+#endif
+
+/** Names of the zones, in the same order as `profile_zone_t` */
+static const char *const ZONE_NAMES[PROFILE_ZONE_COUNT] {
+    "loop",
+    "read_screen",
+    "propagate_release",
+    "propagate_press",
+    "collect_dirty",
+    "update_dirty",
+    "execute_events",
+    "draw_at",
+    "filter_median",
+    "filter_smoothing",
+    "filter_gate",
+    "View::draw",
+    "Window::draw",
+    "Button::draw",
+    "Label::draw",
+    "Bitmap::draw",
+    "DrawableCanvas::draw",
+    "ColorSelector::draw",
+    "PenSizeSelector::draw",
+    "App::print",
+};
+
+Profiler::zone_stats_t Profiler::stats[PROFILE_ZONE_COUNT];
+uint32_t Profiler::ticks_per_us {1};
+uint32_t Profiler::generation {0};
+
+/**
+ * @brief                   Get the histogram bucket that a duration falls in
+ *
+ *                          Durations below 4us get a bucket each, and every larger power of two is split into two buckets
+ *
+ */
+static unsigned bucket_of(uint32_t us) {
+
+    if (us < 4) {
+        return us;
+    }
+
+    unsigned msb = 31 - __builtin_clz(us);
+    unsigned idx = 2 * msb + ((us >> (msb - 1)) & 1);
+
+    return min(idx, Profiler::NUM_BUCKETS - 1);
+}
+
+/**
+ * @brief                   Get the largest duration that falls in a histogram bucket (inverse of `bucket_of`)
+ *
+ */
+static uint32_t bucket_upper_us(unsigned idx) {
+
+    if (idx < 4) {
+        return idx;
+    }
+
+    unsigned msb = idx / 2;
+    uint32_t base = (uint32_t)1 << msb;
+
+    return (idx & 1) ? (2 * base - 1) : (base + (base >> 1) - 1);
+}
+
+void Profiler::begin() {
+
+#ifdef ARDUINO
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    ticks_per_us = SystemCoreClock / 1000000;
+#else
+    ticks_per_us = 1000;
+#endif
+
+    reset();
+}
+
+void Profiler::reset() {
+
+    for (zone_stats_t &s : stats) {
+        s = {};
+        s.min_us = UINT32_MAX;
+    }
+
+    ++generation;
+}
+
+uint32_t Profiler::get_generation() { return generation; }
+
+Profiler::tick_t Profiler::now() {
+
+#ifdef ARDUINO
+    return DWT->CYCCNT;
+#else
+    using namespace std::chrono;
+    return (tick_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void Profiler::record(profile_zone_t zone, tick_t elapsed) {
+
+    zone_stats_t &s = stats[zone];
+    uint32_t us = elapsed / ticks_per_us;
+    uint16_t &bucket = s.buckets[bucket_of(us)];
+
+    s.count += 1;
+    s.total_us += us;
+    s.min_us = min(s.min_us, us);
+    s.max_us = max(s.max_us, us);
+
+    // halve the whole histogram when a bucket saturates, which preserves the shape of the distribution
+    if (bucket == UINT16_MAX) {
+        for (uint16_t &b : s.buckets) {
+            b >>= 1;
+        }
+    }
+    bucket += 1;
+}
+
+const Profiler::zone_stats_t &Profiler::get_stats(profile_zone_t zone) {
+    return stats[zone];
+}
+
+uint32_t Profiler::get_p99_us(profile_zone_t zone) {
+
+    const zone_stats_t &s = stats[zone];
+    uint32_t total {0};
+    uint32_t seen {0};
+
+    for (uint16_t b : s.buckets) {
+        total += b;
+    }
+
+    for (unsigned idx = 0; idx < NUM_BUCKETS; ++idx) {
+        seen += s.buckets[idx];
+        if (seen * 100 >= total * 99) {
+            return min(bucket_upper_us(idx), s.max_us);
+        }
+    }
+
+    return s.max_us;
+}
+
+void Profiler::report(Print *out) {
+
+    out->println("zone, count, min_us, avg_us, max_us, p99_us");
+
+    for (unsigned zone = 0; zone < PROFILE_ZONE_COUNT; ++zone) {
+
+        const zone_stats_t &s = stats[zone];
+
+        if (s.count == 0) {
+            continue;
+        }
+
+        out->print(ZONE_NAMES[zone]);
+        out->print(", ");
+        out->print(s.count);
+        out->print(", ");
+        out->print(s.min_us);
+        out->print(", ");
+        out->print((uint32_t)(s.total_us / s.count));
+        out->print(", ");
+        out->print(s.max_us);
+        out->print(", ");
+        out->println(get_p99_us((profile_zone_t)zone));
+    }
+}
+
+#endif
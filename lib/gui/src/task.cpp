@@ -0,0 +1,113 @@
+/**
+ * @file                    task.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   This file implements the methods of the `TaskScheduler` class
+ *
+ */
+
+#include "task.h"
+
+bool TaskScheduler::start(task_fn_t fn, unsigned *args) {
+
+    if (num_tasks == CAPACITY) {
+        return false;
+    }
+
+    tasks[num_tasks++] = {fn, args, {}};
+    return true;
+}
+
+bool TaskScheduler::is_running(task_fn_t fn) const {
+
+    for (unsigned idx = 0; idx < num_tasks; ++idx) {
+        if (tasks[idx].fn == fn) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+unsigned TaskScheduler::cancel(task_fn_t fn) {
+
+    unsigned count {0};
+
+    for (unsigned idx = 0; idx < num_tasks; ) {
+
+        if (tasks[idx].fn != fn) {
+            ++idx;
+            continue;
+        }
+
+        // while the tasks are being resumed, their indices must not change, so the slot is only marked
+        if (executing) {
+            tasks[idx].fn = nullptr;
+            ++idx;
+        }
+        else {
+            remove(idx);
+        }
+        ++count;
+    }
+
+    return count;
+}
+
+unsigned TaskScheduler::get_count() const {
+
+    unsigned count {0};
+
+    for (unsigned idx = 0; idx < num_tasks; ++idx) {
+        if (tasks[idx].fn != nullptr) {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+void TaskScheduler::execute() {
+
+    // tasks started by a resumed task are appended after `count`, and are first resumed on the next call
+    // finished and cancelled tasks are only marked, and swept once every task has been resumed
+
+    unsigned count = num_tasks;
+
+    executing = true;
+
+    for (unsigned idx = 0; idx < count; ++idx) {
+
+        if (tasks[idx].fn == nullptr) {
+            continue;
+        }
+
+        if (tasks[idx].fn(&tasks[idx].state, tasks[idx].args) == TASK_DONE) {
+            tasks[idx].fn = nullptr;
+        }
+    }
+
+    executing = false;
+
+    sweep();
+}
+
+void TaskScheduler::remove(unsigned idx) {
+
+    for (unsigned other = idx + 1; other < num_tasks; ++other) {
+        tasks[other - 1] = tasks[other];
+    }
+    --num_tasks;
+}
+
+void TaskScheduler::sweep() {
+
+    unsigned kept {0};
+
+    // keep the order of the remaining tasks, including any that were started while the tasks were resumed
+    for (unsigned idx = 0; idx < num_tasks; ++idx) {
+        if (tasks[idx].fn != nullptr) {
+            tasks[kept++] = tasks[idx];
+        }
+    }
+    num_tasks = kept;
+}
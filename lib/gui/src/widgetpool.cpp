@@ -0,0 +1,150 @@
+/**
+ * @file                    widgetpool.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   This file implements the methods of the `WidgetPool` class
+ *
+ */
+
+#include "cstring"
+#include "new"
+
+#include "widgetpool.h"
+
+alignas(WidgetPool::ALIGNMENT) uint8_t WidgetPool::arena[ARENA_BYTES];
+unsigned WidgetPool::arena_used {0};
+void *WidgetPool::free_lists[NUM_CLASSES] {};
+unsigned WidgetPool::heap_fallbacks {0};
+WidgetPool::type_stats_t WidgetPool::types[MAX_TYPES] {};
+
+void *WidgetPool::allocate(size_t size, const char *type_name) {
+
+    unsigned cls = get_class(size);
+    type_stats_t *type = get_type(type_name);
+    void *ptr = nullptr;
+
+    if (cls != NUM_CLASSES) {
+
+        if (free_lists[cls] != nullptr) {
+            ptr = free_lists[cls];
+            free_lists[cls] = *(void **)ptr;
+        }
+        else if (arena_used + CLASS_SIZES[cls] <= ARENA_BYTES) {
+            ptr = &arena[arena_used];
+            arena_used += CLASS_SIZES[cls];
+        }
+    }
+
+    if (ptr != nullptr) {
+        if (type != nullptr) {
+            ++type->pool_count;
+            type->pool_bytes += CLASS_SIZES[cls];
+        }
+        return ptr;
+    }
+
+    ptr = ::operator new(size, std::nothrow);
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+
+    ++heap_fallbacks;
+    if (type != nullptr) {
+        ++type->heap_count;
+        type->heap_bytes += size;
+    }
+
+    return ptr;
+}
+
+void WidgetPool::release(void *ptr, size_t size, const char *type_name) {
+
+    unsigned cls;
+    type_stats_t *type;
+
+    if (ptr == nullptr) {
+        return;
+    }
+
+    type = get_type(type_name);
+
+    if (ptr < (void *)&arena[0] || ptr >= (void *)&arena[ARENA_BYTES]) {
+        if (type != nullptr) {
+            --type->heap_count;
+            type->heap_bytes -= size;
+        }
+        ::operator delete(ptr);
+        return;
+    }
+
+    cls = get_class(size);
+
+    if (type != nullptr) {
+        --type->pool_count;
+        type->pool_bytes -= CLASS_SIZES[cls];
+    }
+
+    *(void **)ptr = free_lists[cls];
+    free_lists[cls] = ptr;
+}
+
+unsigned WidgetPool::get_arena_used() { return arena_used; }
+
+unsigned WidgetPool::get_heap_fallbacks() { return heap_fallbacks; }
+
+void WidgetPool::report(Print *out) {
+
+    out->print("widget pool: ");
+    out->print(arena_used);
+    out->print("/");
+    out->print(ARENA_BYTES);
+    out->print(" bytes, heap fallbacks: ");
+    out->println(heap_fallbacks);
+
+    out->println("type, pool_count, pool_bytes, heap_count, heap_bytes");
+
+    for (unsigned idx = 0; idx < MAX_TYPES && types[idx].name != nullptr; ++idx) {
+
+        const type_stats_t &t = types[idx];
+
+        out->print(t.name);
+        out->print(", ");
+        out->print(t.pool_count);
+        out->print(", ");
+        out->print(t.pool_bytes);
+        out->print(", ");
+        out->print(t.heap_count);
+        out->print(", ");
+        out->println(t.heap_bytes);
+    }
+}
+
+unsigned WidgetPool::get_class(size_t size) {
+
+    for (unsigned cls = 0; cls < NUM_CLASSES; ++cls) {
+        if (size <= CLASS_SIZES[cls]) {
+            return cls;
+        }
+    }
+
+    return NUM_CLASSES;
+}
+
+WidgetPool::type_stats_t *WidgetPool::get_type(const char *type_name) {
+
+    if (type_name == nullptr) {
+        return nullptr;
+    }
+
+    for (unsigned idx = 0; idx < MAX_TYPES; ++idx) {
+
+        if (types[idx].name == nullptr) {
+            types[idx].name = type_name;
+            return &types[idx];
+        }
+        if (strcmp(types[idx].name, type_name) == 0) {
+            return &types[idx];
+        }
+    }
+
+    return nullptr;
+}
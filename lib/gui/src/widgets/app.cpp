@@ -6,9 +6,12 @@
  */
 
 #include "algorithm"
+#include "cstring"
 
 #include "widgets/app.h"
 #include "widgets/view.h"
+#include "buslock.h"
+#include "profiler.h"
 
 App::App(MCUFRIEND_kbv *display)
 : display {display}
@@ -17,7 +20,8 @@ App::App(MCUFRIEND_kbv *display)
 }
 
 App *App::create(MCUFRIEND_kbv *display) {
-    App *app = new (std::nothrow) App(display);
+    // the app is larger than the largest block of the widget pool, and is only created once
+    App *app = ::new (std::nothrow) App(display);
     return app;
 }
 
@@ -26,11 +30,27 @@ App *App::add_view(View *child) {
     return this;
 }
 
+void App::remove_view(View *child) {
+    views.erase(std::remove(views.begin(), views.end(), child), views.end());
+}
+
 App *App::make_active_view(View *child) {
 
     if (std::find(views.begin(), views.end(), child) == views.end()) {
         return this;
     }
+
+    // the idle time of a view is counted from when it stops being active
+    for (unsigned idx = 0; idx < num_view_entries; ++idx) {
+        if (view_entries[idx].view == active_view || view_entries[idx].view == child) {
+            view_entries[idx].last_active = millis();
+        }
+    }
+    // widgets deferred by the frame budget belong to the previous view and must not be drawn over the new one
+    while (dirty_widgets.get_size() != 0) {
+        dirty_widgets.pop();
+    }
+
     active_view = child;
     active_view->set_dirty(); //todo all my children should be marked as clean (including bounding box and visibility and stuff) (possibly use force_clean method)
     clear();
@@ -38,6 +58,67 @@ App *App::make_active_view(View *child) {
     return this;
 }
 
+App::view_id_t App::register_view(view_factory_t factory, unsigned long idle_timeout) {
+
+    if (num_view_entries == VIEW_FACTORY_CAPACITY) {
+        return 0;
+    }
+
+    view_entries[num_view_entries] = {factory, nullptr, idle_timeout, 0};
+    return ++num_view_entries;
+}
+
+App *App::make_active_view(view_id_t id) {
+
+    View *view = get_view(id);
+
+    if (view == nullptr) {
+        return this;
+    }
+    return make_active_view(view);
+}
+
+View *App::get_view(view_id_t id) {
+
+    view_entry_t *entry;
+
+    if (id == 0 || id > num_view_entries) {
+        return nullptr;
+    }
+    entry = &view_entries[id - 1];
+
+    if (entry->view == nullptr) {
+        entry->view = entry->factory();
+        entry->last_active = millis();
+    }
+
+    return entry->view;
+}
+
+App *App::release_idle_views() {
+
+    unsigned long now = millis();
+
+    for (unsigned idx = 0; idx < num_view_entries; ++idx) {
+
+        view_entry_t &entry = view_entries[idx];
+
+        if (entry.view == nullptr || entry.view == active_view || entry.idle_timeout == 0) {
+            continue;
+        }
+        if ((now - entry.last_active) < entry.idle_timeout) {
+            continue;
+        }
+
+        // the dirty widgets only ever belong to the active view, so none of them can refer to this view
+        remove_view(entry.view);
+        delete entry.view;
+        entry.view = nullptr;
+    }
+
+    return this;
+}
+
 View *App::get_active_view() const {
     return active_view;
 }
@@ -48,28 +129,47 @@ RingQueueInterface<InteractiveWidget::callback_event_t> *App::get_event_queue()
 
 App *App::push_event(const InteractiveWidget::callback_event_t &event) {
     event_queue.push(event);
+    return this;
 }
 
 App *App::execute_event_logic() {
 
-    InteractiveWidget::callback_t cb;
-    unsigned *args;
+    InteractiveWidget::callback_event_t event;
 
+    // the event is popped before its callback runs, since the callback may push an event of a higher priority
     while (event_queue.get_size() != 0) {
 
-        cb = event_queue.front().cb;
-        args = event_queue.front().args;
-
-        cb(args);
-
+        event = event_queue.front();
         event_queue.pop();
+
+        event.cb(event.args);
     }
 
     return this;
 }
 
+App *App::get_event_counters(unsigned *high_water, unsigned *dropped, unsigned *coalesced) {
+
+    *high_water = event_queue.get_high_water();
+    *dropped = event_queue.get_dropped();
+    *coalesced = event_queue.get_coalesced();
+
+    return this;
+}
+
+#ifdef GLYPH_CACHE_ENABLED
+const GlyphCache *App::get_glyph_cache() const {
+    return &glyph_cache;
+}
+#endif
+
 App *App::collect_dirty_widgets() {
 
+    // widgets deferred by the frame budget are still dirty, and would be collected twice
+    if (dirty_widgets.get_size() != 0) {
+        return this;
+    }
+
     if (active_view->get_dirty()) {
         dirty_widgets.push(active_view);
     }
@@ -82,8 +182,16 @@ App *App::collect_dirty_widgets() {
 
 App *App::update_dirty_widgets() {
 
+    unsigned long start = micros();
+    bool throttle = stroke_active && frame_budget != 0;
+
     while (dirty_widgets.get_size() != 0) {
 
+        if (throttle && micros() - start >= frame_budget) {
+            ++budget_overruns;
+            break;
+        }
+
         BasicWidget *dirty;
         BasicWidget *parent;
         BasicWidget *child;
@@ -93,7 +201,19 @@ App *App::update_dirty_widgets() {
 
         if (dirty->get_visibility()) {
 
-            dirty->draw();
+            // a partially dirty widget only redraws what changed, unless it has since become completely dirty
+            if (dirty->get_dirty()) {
+                dirty->draw();
+            }
+            else if (dirty->get_partially_dirty()) {
+                if (!dirty->draw_partial()) {
+                    dirty->draw();
+                }
+            }
+            else {
+                // already redrawn through an earlier entry in the queue
+                continue;
+            }
 
             child = dirty;
             parent = dirty->get_parent();
@@ -126,6 +246,201 @@ App *App::update_dirty_widgets() {
     return this;
 }
 
+App *App::set_phase_interval(schedule_phase_t phase, unsigned long interval_us) {
+    phase_interval[phase] = interval_us;
+    phase_deadline[phase] = micros();
+    return this;
+}
+
+bool App::is_due(schedule_phase_t phase) {
+
+    unsigned long now = micros();
+    unsigned long late = now - phase_deadline[phase];
+
+    // the difference is interpreted as signed so that the comparison survives the overflow of micros()
+    if ((long)late < 0) {
+        return false;
+    }
+
+    if (late >= phase_interval[phase]) {
+        ++deadline_misses[phase];
+        phase_deadline[phase] = now + phase_interval[phase];
+    }
+    else {
+        phase_deadline[phase] += phase_interval[phase];
+    }
+
+    return true;
+}
+
+unsigned long App::get_deadline_misses(schedule_phase_t phase) const {
+    return deadline_misses[phase];
+}
+
+App *App::set_frame_budget(unsigned long budget_us) {
+    frame_budget = budget_us;
+    return this;
+}
+
+unsigned long App::get_budget_overruns() const {
+    return budget_overruns;
+}
+
+App *App::set_stroke_active(bool active) {
+    stroke_active = active;
+    return this;
+}
+
+App::timer_id_t App::set_timeout(InteractiveWidget::callback_t cb, unsigned *args, unsigned long delay_ms) {
+    return push_timer(cb, args, millis() + delay_ms, 0);
+}
+
+App::timer_id_t App::set_interval(InteractiveWidget::callback_t cb, unsigned *args, unsigned long period_ms) {
+    return push_timer(cb, args, millis() + period_ms, period_ms);
+}
+
+App::timer_id_t App::defer(InteractiveWidget::callback_t cb, unsigned *args) {
+    return push_timer(cb, args, millis(), 0);
+}
+
+bool App::cancel_timer(timer_id_t id) {
+
+    for (unsigned idx = 0; idx < num_timers; ++idx) {
+        if (timers[idx].id == id) {
+            remove_timer(idx);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+App *App::execute_timers() {
+
+    unsigned long now = millis();
+
+    // timers created by the callbacks of this pass carry the new pass number, and wait for the next pass
+    ++timer_pass;
+
+    while (num_timers != 0) {
+
+        timer_entry_t top = timers[0];
+
+        if ((long)(now - top.deadline) < 0 || top.pass == timer_pass) {
+            break;
+        }
+
+        remove_timer(0);
+
+        // periodic timers are re-armed before the callback runs, so that the callback may cancel them
+        if (top.period != 0) {
+            top.deadline += top.period;
+            if ((long)(now - top.deadline) >= 0) {
+                top.deadline = now + top.period;
+            }
+            top.pass = timer_pass;
+
+            timers[num_timers] = top;
+            sift_up(num_timers++);
+        }
+
+        top.cb(top.args);
+    }
+
+    return this;
+}
+
+bool App::start_task(task_fn_t fn, unsigned *args) { return tasks.start(fn, args); }
+
+bool App::is_task_running(task_fn_t fn) const { return tasks.is_running(fn); }
+
+unsigned App::cancel_task(task_fn_t fn) { return tasks.cancel(fn); }
+
+App *App::execute_tasks() {
+    tasks.execute();
+    return this;
+}
+
+App::timer_id_t App::push_timer(InteractiveWidget::callback_t cb, unsigned *args, unsigned long deadline, unsigned long period) {
+
+    if (num_timers == TIMER_CAPACITY) {
+        return 0;
+    }
+
+    timer_entry_t &entry = timers[num_timers];
+
+    entry.deadline = deadline;
+    entry.period = period;
+    entry.cb = cb;
+    entry.args = args;
+    entry.id = next_timer_id++;
+    entry.pass = timer_pass;
+
+    if (next_timer_id == 0) {
+        next_timer_id = 1;
+    }
+
+    sift_up(num_timers++);
+
+    return entry.id;
+}
+
+void App::remove_timer(unsigned idx) {
+
+    --num_timers;
+    if (idx == num_timers) {
+        return;
+    }
+
+    timers[idx] = timers[num_timers];
+
+    sift_up(idx);
+    sift_down(idx);
+}
+
+void App::sift_up(unsigned idx) {
+
+    while (idx != 0) {
+
+        unsigned parent = (idx - 1) / 2;
+
+        if (!due_before(timers[idx], timers[parent])) {
+            break;
+        }
+
+        std::swap(timers[idx], timers[parent]);
+        idx = parent;
+    }
+}
+
+void App::sift_down(unsigned idx) {
+
+    for (;;) {
+
+        unsigned smallest = idx;
+        unsigned left = 2 * idx + 1;
+        unsigned right = 2 * idx + 2;
+
+        if (left < num_timers && due_before(timers[left], timers[smallest])) {
+            smallest = left;
+        }
+        if (right < num_timers && due_before(timers[right], timers[smallest])) {
+            smallest = right;
+        }
+
+        if (smallest == idx) {
+            break;
+        }
+
+        std::swap(timers[idx], timers[smallest]);
+        idx = smallest;
+    }
+}
+
+bool App::due_before(const timer_entry_t &a, const timer_entry_t &b) {
+    return (long)(a.deadline - b.deadline) < 0;
+}
+
 // BasicWidget overrides
 
 BasicWidget *App::get_parent() { return nullptr; }
@@ -147,13 +462,17 @@ void App::set_visibility_changed() { return; }
 
 void App::draw() { active_view->draw(); }
 
-void App::clear() { display->fillRect(0, 0, display->width(), display->height(), BLACK); }
+void App::clear() {
+    BusLock::Scope bus;
+    display->fillRect(0, 0, display->width(), display->height(), BLACK);
+}
 
 bool App::get_intersection(unsigned int x, unsigned int y) const { return true; }
 bool App::get_intersection(BasicWidget *other) const { return true; }
 
 bool App::propagate_press(unsigned x, unsigned y) { return active_view->propagate_press(x, y); }
 bool App::propagate_release(unsigned x, unsigned y) { return active_view->propagate_release(x, y); }
+bool App::propagate_gesture(const gesture_t &gesture) { return active_view->propagate_gesture(gesture); }
 
 bool App::get_visibility() const { return true; }
 void App::set_visibility(bool new_visibility) { return; }
@@ -161,12 +480,15 @@ void App::set_visibility(bool new_visibility) { return; }
 // Frame overrides
 
 App *App::set_at(unsigned int x, unsigned int y, uint16_t color) {
+    BusLock::Scope bus;
     display->writePixel(x, y, color);
     return this;
 }
 
 uint16_t App::get_at(unsigned int x, unsigned int y) const {
 
+    BusLock::Scope bus;
+
 #ifdef MCUFRIEND_KBV_H_
     return display->readPixel(x, y);
 #else
@@ -175,36 +497,43 @@ uint16_t App::get_at(unsigned int x, unsigned int y) const {
 }
 
 App *App::draw_line(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1, uint16_t color) {
+    BusLock::Scope bus;
     display->drawLine(x0, y0, x1, y1, color);
     return this;
 }
 
 App *App::draw_rect(unsigned int x0, unsigned int y0, unsigned int w, unsigned int h, uint16_t color) {
+    BusLock::Scope bus;
     display->drawRect(x0, y0, w, h, color);
     return this;
 }
 
 App *App::fill_rect(unsigned int x0, unsigned int y0, unsigned int w, unsigned int h, uint16_t color) {
+    BusLock::Scope bus;
     display->fillRect(x0, y0, w, h, color);
     return this;
 }
 
 App *App::draw_round_rect(unsigned int x, unsigned int y, unsigned int w, unsigned int h, unsigned int r, uint16_t color) {
+    BusLock::Scope bus;
     display->drawRoundRect(x, y, w, h, r, color);
     return this;
 }
 
 App *App::fill_round_rect(unsigned int x, unsigned int y, unsigned int w, unsigned int h, unsigned int r, uint16_t color) {
+    BusLock::Scope bus;
     display->fillRoundRect(x, y, w, h, r, color);
     return this;
 }
 
 App *App::draw_circle(unsigned int x, unsigned int y, unsigned int r, uint16_t color) {
+    BusLock::Scope bus;
     display->drawCircle(x, y, r, color);
     return this;
 }
 
 App *App::fill_circle(unsigned int x, unsigned int y, unsigned int r, uint16_t color) {
+    BusLock::Scope bus;
     display->fillCircle(x, y, r, color);
     return this;
 }
@@ -217,12 +546,40 @@ App *App::get_text_bounds(const char *text, unsigned int text_size, unsigned int
 }
 
 App *App::set_font(const GFXfont *f) {
+
+    if (f == current_font) {
+        return this;
+    }
+
+    current_font = f;
     display->setFont(f);
     return this;
 }
 
 App *App::print(const char *text, unsigned int x, unsigned int y, unsigned int text_size, uint16_t fg_color) {
 
+    PROFILE_ZONE(PROFILE_PRINT_TEXT);
+    BusLock::Scope bus;
+
+#ifdef GLYPH_CACHE_ENABLED
+    if (text_size == 1 && glyph_cache.print(display, current_font, text, x, y, fg_color)) {
+        return this;
+    }
+#endif
+
+    display->setCursor(x, y);
+    display->setTextColor(fg_color);
+    display->setTextSize(text_size);
+
+    display->print(text);
+
+    return this;
+}
+
+App *App::print_uncached(const char *text, unsigned int x, unsigned int y, unsigned int text_size, uint16_t fg_color) {
+
+    BusLock::Scope bus;
+
     display->setCursor(x, y);
     display->setTextColor(fg_color);
     display->setTextSize(text_size);
@@ -235,6 +592,8 @@ App *App::print(const char *text, unsigned int x, unsigned int y, unsigned int t
 App *App::print_opaque(const char *text, unsigned int x, unsigned int y, unsigned int text_size, uint16_t fg_color,
                        uint16_t bg_color) {
 
+    BusLock::Scope bus;
+
     display->setCursor(x, y);
     display->setTextColor(fg_color, bg_color);
     display->setTextSize(text_size);
@@ -246,7 +605,77 @@ App *App::print_opaque(const char *text, unsigned int x, unsigned int y, unsigne
 
 App *App::draw_rgb_bitmap(unsigned x, unsigned y, const uint16_t *data, unsigned width, unsigned height) {
 
-    display->drawRGBBitmap(x, y, data, width, height);
+    // bitmaps that are clipped by the edges of the display are drawn pixel by pixel
+    if (x + width > (unsigned)display->width() || y + height > (unsigned)display->height()) {
+        BusLock::Scope bus;
+        display->drawRGBBitmap(x, y, data, width, height);
+        return this;
+    }
+
+    begin_write_window(x, y, width, height);
+    write_colors(data, width * height);
+    end_write_window();
+
+    return this;
+}
+
+App *App::begin_write_window(unsigned x, unsigned y, unsigned w, unsigned h) {
+
+    // the lock is held until the window is ended, so that the pixels are not interrupted halfway through
+    BusLock::acquire();
+
+    display->setAddrWindow(x, y, x + w - 1, y + h - 1);
+    write_first = true;
+
+    return this;
+}
+
+App *App::write_colors(const uint16_t *colors, unsigned count) {
+
+    uint16_t chunk[WRITE_CHUNK_PIXELS];
+
+    while (count != 0) {
+
+        unsigned len = min(count, WRITE_CHUNK_PIXELS);
+
+        memcpy(chunk, colors, len * sizeof(uint16_t));
+        display->pushColors(chunk, len, write_first);
+
+        write_first = false;
+        colors += len;
+        count -= len;
+    }
+
+    return this;
+}
+
+App *App::write_color_run(uint16_t color, unsigned count) {
+
+    uint16_t chunk[WRITE_CHUNK_PIXELS];
+    unsigned filled = min(count, WRITE_CHUNK_PIXELS);
+
+    for (unsigned idx = 0; idx < filled; ++idx) {
+        chunk[idx] = color;
+    }
+
+    while (count != 0) {
+
+        unsigned len = min(count, WRITE_CHUNK_PIXELS);
+
+        display->pushColors(chunk, len, write_first);
+
+        write_first = false;
+        count -= len;
+    }
+
+    return this;
+}
+
+App *App::end_write_window() {
+
+    display->setAddrWindow(0, 0, display->width() - 1, display->height() - 1);
+    BusLock::release();
+
     return this;
 }
 
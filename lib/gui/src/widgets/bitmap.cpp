@@ -6,20 +6,21 @@
  */
 
 #include "widgets/bitmap.h"
+#include "profiler.h"
 
-Bitmap::Bitmap(Frame *parent, const uint16_t *data, unsigned x, unsigned y, unsigned width, unsigned height)
+Bitmap::Bitmap(Frame *parent, const bitmap_asset_t *asset, unsigned x, unsigned y)
     : parent {parent}
-    , data {data}
+    , asset {asset}
     , widget_x {x}
     , widget_y {y}
     , widget_absolute_x { x + parent->get_absolute_x() }
     , widget_absolute_y { y + parent->get_absolute_x() }
-    , widget_w {width}
-    , widget_h {height}
+    , widget_w {asset->width}
+    , widget_h {asset->height}
 {}
 
-Bitmap *Bitmap::create(Frame *parent, const uint16_t *data, unsigned x, unsigned y, unsigned width, unsigned height) {
-    Bitmap *bitmap = new (std::nothrow) Bitmap(parent, data, x, y, width, height);
+Bitmap *Bitmap::create(Frame *parent, const bitmap_asset_t *asset, unsigned x, unsigned y) {
+    Bitmap *bitmap = new (std::nothrow, TYPE_NAME) Bitmap(parent, asset, x, y);
     if (bitmap != nullptr) {
         parent->add_child(bitmap);
     }
@@ -47,10 +48,27 @@ void Bitmap::set_visibility_changed() { visibility_changed = true; }
 
 void Bitmap::draw() {
 
+    PROFILE_ZONE(PROFILE_DRAW_BITMAP);
+
     dirty = false;
     visibility_changed = false;
 
-    parent->draw_rgb_bitmap(widget_x, widget_y, data, widget_w, widget_h);
+    BitmapDecoder decoder(asset);
+    BitmapDecoder::span_t span;
+
+    // the spans are streamed in order into a single window covering the bitmap, instead of addressing each one separately
+    parent->begin_write_window(widget_x, widget_y, widget_w, widget_h);
+
+    while (decoder.next_span(&span)) {
+        if (span.fill) {
+            parent->write_color_run(span.color, span.w * span.h);
+        }
+        else {
+            parent->write_colors(span.pixels, span.w);
+        }
+    }
+
+    parent->end_write_window();
 }
 
 void Bitmap::clear() {
@@ -108,12 +126,6 @@ bool Bitmap::propagate_press(unsigned x, unsigned y) {
         return true;
     }
 
-    unsigned cur_epoch = millis();
-    if ((cur_epoch - last_press_epoch) < DEBOUNCE_THRESH) {
-        return true;
-    }
-    last_press_epoch = cur_epoch;
-
     dirty = true;
     pressed = true;
 
@@ -155,6 +167,7 @@ void Bitmap::set_visibility(bool new_visibility) {
     visibility_changed = true;
 
     visible = new_visibility;
+    parent->notify_visibility(this, new_visibility);
 }
 
 // InteractiveWidget overrides
@@ -209,7 +222,7 @@ Bitmap *Bitmap::set_interactable(bool new_state) {
     }
 
     dirty = true;
-    new_state = new_state;
+    enabled = new_state;
     return this;
 }
 
@@ -6,6 +6,7 @@
  */
 
 #include "widgets/button.h"
+#include "profiler.h"
 
 Button::Button(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height)
     : parent {parent}
@@ -18,7 +19,7 @@ Button::Button(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned h
 {}
 
 Button *Button::create(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height) {
-    Button *button = new (std::nothrow) Button(parent, x, y, width, height);
+    Button *button = new (std::nothrow, TYPE_NAME) Button(parent, x, y, width, height);
     if (button != nullptr) {
         parent->add_child(button);
     }
@@ -26,7 +27,7 @@ Button *Button::create(Frame *parent, unsigned x, unsigned y, unsigned width, un
 }
 
 Button *Button::create(Frame *parent, unsigned x, unsigned y) {
-    Button *button = new (std::nothrow) Button(parent, x, y, DEFAULT_WIDTH, DEFAULT_HEIGHT);
+    Button *button = new (std::nothrow, TYPE_NAME) Button(parent, x, y, DEFAULT_WIDTH, DEFAULT_HEIGHT);
     if (button != nullptr) {
         parent->add_child(button);
     }
@@ -35,17 +36,66 @@ Button *Button::create(Frame *parent, unsigned x, unsigned y) {
 
 Button *Button::set_message(const char *msg_ptr) {
     dirty = true;
+    layout_valid = false;
     message = msg_ptr;
     return this;
 }
 
-String Button::get_message() const { return message; }
+Button *Button::relabel(const char *msg_ptr) {
+
+    int16_t x1, y1;
+    uint16_t w, h;
+
+    if (message == msg_ptr) {
+        return this;
+    }
+
+    if (dirty || !drawn) {
+        return set_message(msg_ptr);
+    }
+
+    // only the text that is actually on the display needs to be erased, even if the message changes several times
+    if (!label_changed) {
+
+        parent->set_font(font_for_size(style->text_size));
+
+        if (!layout_valid) {
+            update_layout();
+        }
+
+        parent->get_text_bounds(message.c_str(), 1, text_x, text_y, &x1, &y1, &w, &h);
+
+        // the erased area is kept within the border, so that only the background is repainted
+        erase_x = max<signed>(x1, widget_x + style->border_w);
+        erase_y = max<signed>(y1, widget_y + style->border_w);
+        erase_w = max<signed>(0, min<signed>(x1 + w, widget_x + widget_w - style->border_w) - (signed)erase_x);
+        erase_h = max<signed>(0, min<signed>(y1 + h, widget_y + widget_h - style->border_w) - (signed)erase_y);
+
+        label_changed = true;
+    }
+
+    message = msg_ptr;
+    layout_valid = false;
+    partially_dirty = true;
+
+    return this;
+}
+
+const char *Button::get_message() const { return message.c_str(); }
 
 unsigned Button::get_message_len() const { return message.length(); }
 
 ButtonStyle *Button::get_style() {
     dirty = true;
-    return &style;
+    layout_valid = false;
+    return style.get_mutable();
+}
+
+Button *Button::set_style(const ButtonStyle *shared_style) {
+    dirty = true;
+    layout_valid = false;
+    style.set_shared(shared_style);
+    return this;
 }
 
 // BasicWidget overrides
@@ -67,65 +117,62 @@ bool Button::get_visibility_changed() const { return visibility_changed; }
 void Button::set_dirty() { dirty = true; }
 void Button::set_visibility_changed() { visibility_changed = true; }
 
+bool Button::get_partially_dirty() const { return partially_dirty; }
+
 void Button::draw() {
 
+    PROFILE_ZONE(PROFILE_DRAW_BUTTON);
+
     dirty = false;
     visibility_changed = false;
+    partially_dirty = false;
+    label_changed = false;
 
-    if (style.border_radius != 0) {
-        if (style.border_w != 0) {
-            parent->fill_round_rect(
-                    widget_x,
-                    widget_y,
-                    widget_w,
-                    widget_h,
-                    style.border_radius,
-                    (pressed)
-                    ? style.pressed_border_color
-                    : style.border_color
-            );
-        }
-        parent->fill_round_rect(
-                widget_x + style.border_w,
-                widget_y + style.border_w,
-                widget_w - 2*style.border_w,
-                widget_h - 2*style.border_w,
-                style.border_radius,
-                (pressed)
-                ? style.pressed_bg_color
-                : style.bg_color
-        );
+    drawn = true;
+    drawn_pressed = pressed;
+
+    render_background(true);
+    render_text();
+}
+
+bool Button::draw_partial() {
+
+    PROFILE_ZONE(PROFILE_DRAW_BUTTON);
+
+    bool border_changed = style->border_w != 0 && style->border_color != style->pressed_border_color;
+    bool bg_changed = style->bg_color != style->pressed_bg_color;
+    bool fg_changed = style->fg_color != style->pressed_fg_color;
+
+    bool restyled = (pressed != drawn_pressed) && (border_changed || bg_changed || fg_changed);
+
+    partially_dirty = false;
+    drawn_pressed = pressed;
+
+    if (restyled && (border_changed || bg_changed)) {
+        render_background(border_changed);
     }
-    else {
-        if (style.border_w != 0) {
-            parent->fill_rect(
-                    widget_x,
-                    widget_y,
-                    widget_w,
-                    widget_h,
-                    (pressed)
-                    ? style.pressed_border_color
-                    : style.border_color
-            );
-        }
-        parent->fill_rect(
-                widget_x + style.border_w,
-                widget_y + style.border_w,
-                widget_w - 2*style.border_w,
-                widget_h - 2*style.border_w,
-                (pressed)
-                ? style.pressed_bg_color
-                : style.bg_color
-        );
+    else if (label_changed) {
+        parent->fill_rect(erase_x, erase_y, erase_w, erase_h, (pressed) ? style->pressed_bg_color : style->bg_color);
     }
 
-    render_text();
+    // the glyphs are recolored in place, since they cover exactly the same pixels in both states
+    if (restyled || label_changed) {
+        render_text();
+    }
+
+    label_changed = false;
+
+    return true;
 }
 
 void Button::clear() {
 
     dirty = false;
     visibility_changed = false;
+    partially_dirty = false;
+    label_changed = false;
+
+    drawn = false;
 
     parent->fill_rect(widget_x, widget_y, widget_w, widget_h, BLACK);
 }
@@ -177,15 +224,7 @@ bool Button::propagate_press(unsigned x, unsigned y) {
         return true;
     }
 
-    {
-        unsigned cur_epoch = millis();
-        if ((cur_epoch - last_press_epoch) < DEBOUNCE_THRESH) {
-            return true;
-        }
-        last_press_epoch = cur_epoch;
-    }
-
-    dirty = true;
+    set_state_changed();
 
     pressed = true;
     if (event_queue != nullptr && on_press != nullptr) {
@@ -204,7 +243,7 @@ bool Button::propagate_release(unsigned x, unsigned y) {
         return true;
     }
 
-    dirty = true;
+    set_state_changed();
 
     pressed = false;
     if (event_queue != nullptr && on_release != nullptr) {
@@ -226,6 +265,57 @@ void Button::set_visibility(bool new_visibility) {
     visibility_changed = true;
 
     visible = new_visibility;
+    parent->notify_visibility(this, new_visibility);
+}
+
+void Button::render_background(bool with_border) {
+
+    if (style->border_radius != 0) {
+        if (with_border && style->border_w != 0) {
+            parent->fill_round_rect(
+                    widget_x,
+                    widget_y,
+                    widget_w,
+                    widget_h,
+                    style->border_radius,
+                    (pressed)
+                    ? style->pressed_border_color
+                    : style->border_color
+            );
+        }
+        parent->fill_round_rect(
+                widget_x + style->border_w,
+                widget_y + style->border_w,
+                widget_w - 2*style->border_w,
+                widget_h - 2*style->border_w,
+                style->border_radius,
+                (pressed)
+                ? style->pressed_bg_color
+                : style->bg_color
+        );
+    }
+    else {
+        if (with_border && style->border_w != 0) {
+            parent->fill_rect(
+                    widget_x,
+                    widget_y,
+                    widget_w,
+                    widget_h,
+                    (pressed)
+                    ? style->pressed_border_color
+                    : style->border_color
+            );
+        }
+        parent->fill_rect(
+                widget_x + style->border_w,
+                widget_y + style->border_w,
+                widget_w - 2*style->border_w,
+                widget_h - 2*style->border_w,
+                (pressed)
+                ? style->pressed_bg_color
+                : style->bg_color
+        );
+    }
 }
 
 // void Button::render_text() {
@@ -264,45 +354,54 @@ void Button::set_visibility(bool new_visibility) {
 
 void Button::render_text() {
 
-    int16_t x1, y1;
-    uint16_t w1, h1;
-
-    switch (style.text_size) {
-        case 1:
-            parent->set_font(font_1);
-            break;
-        case 2:
-            parent->set_font(font_2);
-            break;
-        case 3:
-            parent->set_font(font_3);
-            break;
-        default:
-            parent->set_font(font_4);
-            break;
-    }
+    parent->set_font(font_for_size(style->text_size));
 
-    parent->get_text_bounds(message.c_str(), 1, 0, 0, &x1, &y1, &w1, &h1);
+    if (!layout_valid) {
+        update_layout();
+    }
 
     parent->print(
             message.c_str(),
-            (style.h_align == ButtonStyle::HorizontalAlignment::CENTER_ALIGN)
-            ? (2*widget_x + widget_w - w1) / 2
-            : (style.h_align == ButtonStyle::HorizontalAlignment::LEFT_ALIGN)
-            ? widget_x + style.border_w
-            : widget_x + widget_w - style.border_w - w1,
-            ((style.v_align == ButtonStyle::VerticalAlignment::MIDDLE_ALIGN)
-            ? (2*widget_y + widget_h - h1) / 2
-            : (style.v_align == ButtonStyle::VerticalAlignment::TOP_ALIGN)
-            ? widget_y + style.border_w
-            : widget_y + widget_h - style.border_w - h1) + h1,
-            1, //style.text_size,
+            text_x,
+            text_y,
+            1, //style->text_size,
             (pressed)
-            ? style.pressed_fg_color
-            : style.fg_color
+            ? style->pressed_fg_color
+            : style->fg_color
     );
 }
 
+void Button::update_layout() {
+
+    int16_t x1, y1;
+
+    parent->get_text_bounds(message.c_str(), 1, 0, 0, &x1, &y1, &text_w, &text_h);
+
+    text_x = (style->h_align == ButtonStyle::HorizontalAlignment::CENTER_ALIGN)
+            ? (2*widget_x + widget_w - text_w) / 2
+            : (style->h_align == ButtonStyle::HorizontalAlignment::LEFT_ALIGN)
+            ? widget_x + style->border_w
+            : widget_x + widget_w - style->border_w - text_w;
+
+    text_y = ((style->v_align == ButtonStyle::VerticalAlignment::MIDDLE_ALIGN)
+            ? (2*widget_y + widget_h - text_h) / 2
+            : (style->v_align == ButtonStyle::VerticalAlignment::TOP_ALIGN)
+            ? widget_y + style->border_w
+            : widget_y + widget_h - style->border_w - text_h) + text_h;
+
+    layout_valid = true;
+}
+
+void Button::set_state_changed() {
+
+    if (dirty || !drawn) {
+        dirty = true;
+        return;
+    }
+
+    partially_dirty = true;
+}
+
 // InteractiveWidget overrides
 
 Button *Button::set_onpress(callback_t callback) {
@@ -355,7 +454,7 @@ Button *Button::set_interactable(bool new_state) {
     }
 
     dirty = true;
-    new_state = new_state;
+    enabled = new_state;
     return this;
 }
 
@@ -363,6 +462,8 @@ bool Button::get_interactable() const { return enabled; }
 
 // Button Style
 
+const ButtonStyle ButtonStyle::DEFAULT {};
+
 ButtonStyle *ButtonStyle::set_horizontal_alignment(ButtonStyle::HorizontalAlignment new_h_align) {
     h_align = new_h_align;
     return this;
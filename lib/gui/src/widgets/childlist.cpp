@@ -0,0 +1,207 @@
+/**
+ * @file                    childlist.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   This file implements the methods of the `ChildList` class
+ *
+ */
+
+#include "algorithm"
+
+#include "widgets/childlist.h"
+
+void ChildList::push_back(BasicWidget *child) {
+
+    children.emplace_back(child);
+
+    lefts.emplace_back(child->get_x());
+    tops.emplace_back(child->get_y());
+    rights.emplace_back(child->get_x() + child->get_width());
+    bottoms.emplace_back(child->get_y() + child->get_height());
+
+    visibility.emplace_back(child->get_visibility());
+
+    if (get_indexed()) {
+        index_child(children.size() - 1);
+    }
+}
+
+unsigned ChildList::find(const BasicWidget *child) const {
+    return std::find(children.begin(), children.end(), child) - children.begin();
+}
+
+void ChildList::move(unsigned cur_z, unsigned new_z) {
+
+    move_entry(children, cur_z, new_z);
+
+    move_entry(lefts, cur_z, new_z);
+    move_entry(tops, cur_z, new_z);
+    move_entry(rights, cur_z, new_z);
+    move_entry(bottoms, cur_z, new_z);
+
+    move_entry(visibility, cur_z, new_z);
+
+    if (get_indexed()) {
+        rebuild_index();
+    }
+}
+
+void ChildList::set_visibility(const BasicWidget *child, bool visible) {
+
+    unsigned idx = find(child);
+
+    if (idx != children.size()) {
+        visibility[idx] = visible;
+    }
+}
+
+void ChildList::enable_index(unsigned width, unsigned height) {
+
+    // bounding boxes include their right and bottom edges, and so does the frame
+    cell_w = (width + GRID_COLS) / GRID_COLS;
+    cell_h = (height + GRID_ROWS) / GRID_ROWS;
+
+    indexed = true;
+    rebuild_index();
+}
+
+bool ChildList::propagate_press(unsigned x, unsigned y) {
+
+    if (!get_indexed()) {
+        for (unsigned idx = 0; idx < children.size(); ++idx) {
+            if (visibility[idx] && contains(idx, x, y) && children[idx]->propagate_press(x, y)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // the lowest set bit is the front-most candidate
+    for (uint32_t mask = get_candidates(x, y); mask != 0; mask &= mask - 1) {
+
+        unsigned idx = __builtin_ctz(mask);
+
+        if (visibility[idx] && contains(idx, x, y) && children[idx]->propagate_press(x, y)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ChildList::propagate_release(unsigned x, unsigned y) {
+
+    if (!get_indexed()) {
+        for (unsigned idx = 0; idx < children.size(); ++idx) {
+            if (visibility[idx] && contains(idx, x, y) && children[idx]->propagate_release(x, y)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    for (uint32_t mask = get_candidates(x, y); mask != 0; mask &= mask - 1) {
+
+        unsigned idx = __builtin_ctz(mask);
+
+        if (visibility[idx] && contains(idx, x, y) && children[idx]->propagate_release(x, y)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool ChildList::propagate_gesture(const gesture_t &gesture) {
+
+    unsigned x = gesture.x;
+    unsigned y = gesture.y;
+
+    if (!get_indexed()) {
+        for (unsigned idx = 0; idx < children.size(); ++idx) {
+            if (visibility[idx] && contains(idx, x, y) && children[idx]->propagate_gesture(gesture)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    for (uint32_t mask = get_candidates(x, y); mask != 0; mask &= mask - 1) {
+
+        unsigned idx = __builtin_ctz(mask);
+
+        if (visibility[idx] && contains(idx, x, y) && children[idx]->propagate_gesture(gesture)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ChildList::collect_overlapping(unsigned begin, unsigned end, signed x0, signed y0, signed x1, signed y1, RingQueueInterface<BasicWidget *> *overlapping_widgets) const {
+
+    for (unsigned idx = end; idx-- > begin; ) {
+
+        // the mirrored state is checked first, so that only the visible children that overlap are asked if they are dirty
+        if (!visibility[idx] || x1 < lefts[idx] || rights[idx] < x0 || y1 < tops[idx] || bottoms[idx] < y0) {
+            continue;
+        }
+
+        BasicWidget *current = children[idx];
+
+        if (current->get_dirty()) {
+            continue;
+        }
+
+        current->set_dirty();
+        overlapping_widgets->push(current);
+    }
+}
+
+bool ChildList::get_indexed() const {
+    return indexed && children.size() <= MAX_INDEXED;
+}
+
+bool ChildList::contains(unsigned idx, unsigned x, unsigned y) const {
+    return lefts[idx] <= (signed)x && (signed)x <= rights[idx]
+           && tops[idx] <= (signed)y && (signed)y <= bottoms[idx];
+}
+
+void ChildList::index_child(unsigned idx) {
+
+    BasicWidget *child = children[idx];
+
+    // points beyond the last cell are clamped into it, so children that extend past the frame are clamped the same way
+    unsigned c0 = min(child->get_x() / cell_w, GRID_COLS - 1);
+    unsigned c1 = min((child->get_x() + child->get_width()) / cell_w, GRID_COLS - 1);
+    unsigned r0 = min(child->get_y() / cell_h, GRID_ROWS - 1);
+    unsigned r1 = min((child->get_y() + child->get_height()) / cell_h, GRID_ROWS - 1);
+
+    for (unsigned r = r0; r <= r1; ++r) {
+        for (unsigned c = c0; c <= c1; ++c) {
+            cells[(r * GRID_COLS) + c] |= (uint32_t)1 << idx;
+        }
+    }
+}
+
+void ChildList::rebuild_index() {
+
+    for (unsigned i = 0; i < GRID_COLS * GRID_ROWS; ++i) {
+        cells[i] = 0;
+    }
+
+    if (children.size() > MAX_INDEXED) {
+        return;
+    }
+
+    for (unsigned idx = 0; idx < children.size(); ++idx) {
+        index_child(idx);
+    }
+}
+
+uint32_t ChildList::get_candidates(unsigned x, unsigned y) const {
+
+    unsigned c = min(x / cell_w, GRID_COLS - 1);
+    unsigned r = min(y / cell_h, GRID_ROWS - 1);
+
+    return cells[(r * GRID_COLS) + c];
+}
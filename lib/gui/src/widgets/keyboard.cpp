@@ -7,6 +7,22 @@
 
 #include "widgets/keyboard.h"
 
+const ButtonStyle Keyboard::KEY_STYLE = [] {
+
+    ButtonStyle style;
+
+    (&style)
+    ->set_bg_color(blend_color(GRAY, BLACK, 100))
+    ->set_pressed_bg_color(blend_color(GRAY, BLACK, 200))
+    ->set_fg_color(WHITE)
+    ->set_pressed_fg_color(WHITE)
+    ->set_border_width(1)
+    ->set_border_radius(2)
+    ->set_text_size(2);
+
+    return style;
+}();
+
 Keyboard::Keyboard(Frame *parent)
 : Window(parent, 0, parent->get_height() - 160, parent->get_width(), 160)
 {
@@ -32,80 +48,50 @@ Keyboard::Keyboard(Frame *parent)
 
     shift
     ->set_message("~")
-    ->get_style()
-    ->set_bg_color(blend_color(GRAY, BLACK, 100))
-    ->set_pressed_bg_color(blend_color(GRAY, BLACK, 200))
-    ->set_fg_color(WHITE)
-    ->set_pressed_fg_color(WHITE)
-    ->set_border_width(1)
-    ->set_border_radius(2)
-    ->set_text_size(2);
+    ->set_style(&KEY_STYLE);
 
     space
     ->set_message(" ")
-    ->get_style()
-    ->set_bg_color(blend_color(GRAY, BLACK, 100))
-    ->set_pressed_bg_color(blend_color(GRAY, BLACK, 200))
-    ->set_fg_color(WHITE)
-    ->set_pressed_fg_color(WHITE)
-    ->set_border_width(1)
-    ->set_border_radius(2)
-    ->set_text_size(2);
+    ->set_style(&KEY_STYLE);
 
     backspace
     ->set_message("<<")
-    ->get_style()
-    ->set_bg_color(blend_color(GRAY, BLACK, 100))
-    ->set_pressed_bg_color(blend_color(GRAY, BLACK, 200))
-    ->set_fg_color(WHITE)
-    ->set_pressed_fg_color(WHITE)
-    ->set_border_width(1)
-    ->set_border_radius(2)
-    ->set_text_size(2);
+    ->set_style(&KEY_STYLE);
 
 
     for (unsigned i = 0, idx = 0; i < NUM_ROWS; ++i) {
         for (unsigned j = 0; j < NUM_KEYS[i]; ++j, ++idx) {
 
-            if (i <= 1) {
-                keys[idx] = Button::create(this, (32 * j) + 1, (32 * i) + 1, 31, 31);
-            }
-            else if (i <= 2) {
-                keys[idx] = Button::create(this, (32 * j) + 17, (32 * i) + 1, 31, 31);
-            }
-            else if (i <= 3) {
-                keys[idx] = Button::create(this, (32 * j) + 17 + 64, (32 * i) + 1, 31, 31);
+            if (i < NUM_ROWS - 1) {
+                keys[idx] = Button::create(this, (KEY_PITCH * j) + ROW_ORIGIN[i], (KEY_PITCH * i) + 1, KEY_SIZE, KEY_SIZE);
             }
             else {
-                keys[idx] = Button::create(this, ((j == 0) ? 32 : (8 * 32) + 1) - 5, (32 * i) + 1, 31, 31);
+                keys[idx] = Button::create(this, ((j == 0) ? 32 : (8 * 32) + 1) - 5, (KEY_PITCH * i) + 1, KEY_SIZE, KEY_SIZE);
             }
 
             keys[idx]
             ->set_message(KEYBOARD_KEYS[0][i][j])
-            ->get_style()
-            ->set_bg_color(blend_color(GRAY, BLACK, 100))
-            ->set_pressed_bg_color(blend_color(GRAY, BLACK, 200))
-            ->set_fg_color(WHITE)
-            ->set_pressed_fg_color(WHITE)
-            ->set_border_width(1)
-            ->set_border_radius(2)
-            ->set_text_size(2);
+            ->set_style(&KEY_STYLE);
         }
     }
 }
 
-void Keyboard::update_keys() {
+void Keyboard::update_keys(unsigned old_shift_i) {
 
-    for (unsigned i = 1, idx = NUM_KEYS[0]; i < (NUM_ROWS-1); ++i) {
+    uint64_t mask = RELABEL_MASK[old_shift_i][shift_i];
+
+    for (unsigned i = 0, idx = 0; i < NUM_ROWS; ++i) {
         for (unsigned j = 0; j < NUM_KEYS[i]; ++j, ++idx) {
-            keys[idx]->set_message(KEYBOARD_KEYS[shift_i][i][j]);
+            if (mask & ((uint64_t)1 << idx)) {
+                keys[idx]->relabel(KEYBOARD_KEYS[shift_i][i][j]);
+            }
         }
     }
 }
 
 Keyboard *Keyboard::create(Frame *parent) {
 
-    Keyboard *keyboard = new (std::nothrow) Keyboard(parent);
+    Keyboard *keyboard = new (std::nothrow, TYPE_NAME) Keyboard(parent);
     if (keyboard != nullptr) {
         parent->add_child(keyboard);
     }
@@ -113,15 +99,22 @@ Keyboard *Keyboard::create(Frame *parent) {
 }
 
 Keyboard *Keyboard::set_shift_index(unsigned new_shift_i) {
+
+    unsigned old_shift_i = shift_i;
+
     shift_i = new_shift_i;
-    update_keys();
-    dirty = true;
+    update_keys(old_shift_i);
+
+    return this;
 }
 
 unsigned Keyboard::get_shift_index() const { return shift_i; }
 
 bool Keyboard::propagate_press(unsigned x, unsigned y) {
 
+    Button *button;
+    unsigned row, col;
+
     if (!get_intersection(x, y)) {
         return false;
     }
@@ -130,14 +123,6 @@ bool Keyboard::propagate_press(unsigned x, unsigned y) {
         return true;
     }
 
-    {
-        unsigned cur_epoch = millis();
-        if ((cur_epoch - last_press_epoch) < DEBOUNCE_THRESH) {
-            return true;
-        }
-        last_press_epoch = cur_epoch;
-    }
-
     x -= widget_x;
     y -= widget_y;
 
@@ -145,53 +130,29 @@ bool Keyboard::propagate_press(unsigned x, unsigned y) {
 
     pressed = true;
 
-    if (shift->propagate_press(x, y)) {
-
-        press_info.shift = 1;
-        if (event_queue != nullptr && on_press != nullptr) {
-            event_queue->push({on_press, (unsigned *)&press_info});
-        }
+    button = find_button(x, y, &row, &col);
+    if (button == nullptr || !button->propagate_press(x, y)) {
         return true;
     }
 
-    if (space->propagate_press(x, y)) {
-
+    if (button == shift) {
+        press_info.shift = 1;
+    }
+    else if (button == space) {
         press_info.key = ' ';
-        if (event_queue != nullptr && on_press != nullptr) {
-            event_queue->push({on_press, (unsigned *)&press_info});
-        }
-        return true;
     }
-
-    if (backspace->propagate_press(x, y)) {
-
+    else if (button == backspace) {
         press_info.backspace = 1;
-        if (event_queue != nullptr && on_press != nullptr) {
-            event_queue->push({on_press, (unsigned *)&press_info});
-        }
-        return true;
     }
-
-    if (exit->propagate_press(x, y)) {
-
+    else if (button == exit) {
         press_info.exit = 1;
-        if (event_queue != nullptr && on_press != nullptr) {
-            event_queue->push({on_press, (unsigned *)&press_info});
-        }
-        return true;
+    }
+    else {
+        press_info.key = KEYBOARD_KEYS[shift_i][row][col][0];
     }
 
-    for (unsigned i = 0, idx = 0; i < NUM_ROWS; ++i) {
-        for (unsigned j = 0; j < NUM_KEYS[i]; ++j, ++idx) {
-            if (keys[idx]->propagate_press(x, y)) {
-
-                press_info.key = KEYBOARD_KEYS[shift_i][i][j][0];
-                if (event_queue != nullptr && on_press != nullptr) {
-                    event_queue->push({on_press, (unsigned *)&press_info});
-                }
-                return true;
-            }
-        }
+    if (event_queue != nullptr && on_press != nullptr) {
+        event_queue->push({on_press, (unsigned *)&press_info});
     }
 
     return true;
@@ -199,6 +160,9 @@ bool Keyboard::propagate_press(unsigned x, unsigned y) {
 
 bool Keyboard::propagate_release(unsigned x, unsigned y) {
 
+    Button *button;
+    unsigned row, col;
+
     if (!get_intersection(x, y)) {
         return false;
     }
@@ -214,60 +178,96 @@ bool Keyboard::propagate_release(unsigned x, unsigned y) {
 
     release_info.special = 0;
 
-    if (shift->propagate_release(x, y)) {
+    button = find_button(x, y, &row, &col);
+    if (button == nullptr || !button->propagate_release(x, y)) {
+        return true;
+    }
+
+    if (button == shift) {
+        unsigned old_shift_i = shift_i;
 
         (++shift_i) %= 3;
-        update_keys();
+        update_keys(old_shift_i);
 
         release_info.shift = 1;
-        if (event_queue != nullptr && on_release != nullptr) {
-            event_queue->push({on_release, (unsigned *)&release_info});
-        }
-        return true;
     }
-
-    if (space->propagate_release(x, y)) {
-
+    else if (button == space) {
         release_info.key = ' ';
-        if (event_queue != nullptr && on_release != nullptr) {
-            event_queue->push({on_release, (unsigned *)&release_info});
-        }
-        return true;
+    }
+    else if (button == backspace) {
+        release_info.backspace = 1;
+    }
+    else if (button == exit) {
+        release_info.exit = 1;
+    }
+    else {
+        release_info.key = KEYBOARD_KEYS[shift_i][row][col][0];
     }
 
-    if (backspace->propagate_release(x, y)) {
+    if (event_queue != nullptr && on_release != nullptr) {
+        event_queue->push({on_release, (unsigned *)&release_info});
+    }
 
-        release_info.backspace = 1;
-        if (event_queue != nullptr && on_release != nullptr) {
-            event_queue->push({on_release, (unsigned *)&release_info});
-        }
-        return true;
+    if (button == exit) {
+        set_visibility(false);
     }
 
-    if (exit->propagate_release(x, y)) {
+    return true;
+}
 
-        release_info.exit = 1;
-        if (event_queue != nullptr && on_release != nullptr) {
-            event_queue->push({on_release, (unsigned *)&release_info});
-        }
+Button *Keyboard::find_button(unsigned x, unsigned y, unsigned *row, unsigned *col) const {
 
-        set_visibility(false);
-        return true;
+    unsigned i, j;
+
+    // key i of a row spans [origin + i * pitch, origin + i * pitch + size], so every pixel of the grid belongs to one key
+    if (y == 0) {
+        return nullptr;
     }
 
-    for (unsigned i = 0, idx = 0; i < NUM_ROWS; ++i) {
-        for (unsigned j = 0; j < NUM_KEYS[i]; ++j, ++idx) {
-            if (keys[idx]->propagate_release(x, y)) {
-                release_info.key = KEYBOARD_KEYS[shift_i][i][j][0];
-                if (event_queue != nullptr && on_release != nullptr) {
-                    event_queue->push({on_release, (unsigned *)&release_info});
-                }
-                return true;
+    i = (y - 1) / KEY_PITCH;
+
+    if (i >= NUM_ROWS) {
+        return nullptr;
+    }
+
+    // the last row holds only a handful of buttons of different widths, which are tested directly
+    if (i == NUM_ROWS - 1) {
+
+        for (Button *button : {exit, space, backspace}) {
+            if (button->get_intersection(x, y)) {
+                return button;
+            }
+        }
+
+        for (j = 0; j < NUM_KEYS[i]; ++j) {
+            if (keys[FIRST_KEY[i] + j]->get_intersection(x, y)) {
+                *row = i;
+                *col = j;
+                return keys[FIRST_KEY[i] + j];
             }
         }
+
+        return nullptr;
     }
 
-    return true;
+    if (shift->get_intersection(x, y)) {
+        return shift;
+    }
+
+    if (x < ROW_ORIGIN[i]) {
+        return nullptr;
+    }
+
+    j = (x - ROW_ORIGIN[i]) / KEY_PITCH;
+
+    if (j >= NUM_KEYS[i]) {
+        return nullptr;
+    }
+
+    *row = i;
+    *col = j;
+
+    return keys[FIRST_KEY[i] + j];
 }
 
 // InteractiveWidget overrides
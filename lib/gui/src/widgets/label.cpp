@@ -6,6 +6,7 @@
  */
 
 #include "widgets/label.h"
+#include "profiler.h"
 
 Label::Label(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height)
     : parent {parent}
@@ -18,7 +19,7 @@ Label::Label(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned hei
 {}
 
 Label *Label::create(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height) {
-    Label *label = new (std::nothrow) Label(parent, x, y, width, height);
+    Label *label = new (std::nothrow, TYPE_NAME) Label(parent, x, y, width, height);
     if (label != nullptr) {
         parent->add_child(label);
     }
@@ -27,6 +28,7 @@ Label *Label::create(Frame *parent, unsigned x, unsigned y, unsigned width, unsi
 
 Label *Label::set_message(const char msg_ptr[]) {
     dirty = true;
+    layout_valid = false;
     message = msg_ptr;
 
     // render_text();
@@ -34,13 +36,18 @@ Label *Label::set_message(const char msg_ptr[]) {
     return this;
 }
 
-String Label::get_message() const { return message; }
+const char *Label::get_message() const { return message.c_str(); }
 
 unsigned Label::get_message_len() const { return message.length(); }
 
 Label *Label::append_to_message(char ch) {
+
+    if (!message.push_back(ch)) {
+        return this;
+    }
+
     dirty = true;
-    message += ch;
+    layout_valid = false;
 
     // render_text();
 
@@ -49,12 +56,13 @@ Label *Label::append_to_message(char ch) {
 
 Label *Label::pop_from_message() {
 
-    if (message.length() <= 0) {
+    if (message.empty()) {
         return this;
     }
 
     dirty = true;
-    message.remove(message.length() - 1);
+    layout_valid = false;
+    message.pop_back();
 
     // render_text();
 
@@ -63,7 +71,15 @@ Label *Label::pop_from_message() {
 
 LabelStyle *Label::get_style() {
     dirty = true;
-    return &style;
+    layout_valid = false;
+    return style.get_mutable();
+}
+
+Label *Label::set_style(const LabelStyle *shared_style) {
+    dirty = true;
+    layout_valid = false;
+    style.set_shared(shared_style);
+    return this;
 }
 
 // BasicWidget overrides
@@ -87,45 +103,47 @@ void Label::set_visibility_changed() { visibility_changed = true; }
 
 void Label::draw() {
 
+    PROFILE_ZONE(PROFILE_DRAW_LABEL);
+
     dirty = false;
     visibility_changed = false;
 
-    if (style.border_radius != 0) {
-        if (style.border_w != 0) {
+    if (style->border_radius != 0) {
+        if (style->border_w != 0) {
             parent->fill_round_rect(
                     widget_x,
                     widget_y,
                     widget_w,
                     widget_h,
-                    style.border_radius,
-                    style.border_color
+                    style->border_radius,
+                    style->border_color
             );
         }
         parent->fill_round_rect(
-                widget_x + style.border_w,
-                widget_y + style.border_w,
-                widget_w - 2*style.border_w,
-                widget_h - 2*style.border_w,
-                style.border_radius,
-                style.bg_color
+                widget_x + style->border_w,
+                widget_y + style->border_w,
+                widget_w - 2*style->border_w,
+                widget_h - 2*style->border_w,
+                style->border_radius,
+                style->bg_color
         );
     }
     else {
-        if (style.border_w != 0) {
+        if (style->border_w != 0) {
             parent->fill_rect(
                     widget_x,
                     widget_y,
                     widget_w,
                     widget_h,
-                    style.border_color
+                    style->border_color
             );
         }
         parent->fill_rect(
-                widget_x + style.border_w,
-                widget_y + style.border_w,
-                widget_w - 2*style.border_w,
-                widget_h - 2*style.border_w,
-                style.bg_color
+                widget_x + style->border_w,
+                widget_y + style->border_w,
+                widget_w - 2*style->border_w,
+                widget_h - 2*style->border_w,
+                style->bg_color
         );
     }
 
@@ -207,6 +225,7 @@ void Label::set_visibility(bool new_visibility) {
     visibility_changed = true;
 
     visible = new_visibility;
+    parent->notify_visibility(this, new_visibility);
 }
 
 // void Label::render_text() {
@@ -244,54 +263,46 @@ void Label::set_visibility(bool new_visibility) {
 
 void Label::render_text() {
 
-    int16_t x1, y1;
-    uint16_t w1, h1;
-
-    switch (style.text_size) {
-        case 1:
-            parent->set_font(font_1);
-            break;
-        case 2:
-            parent->set_font(font_2);
-            break;
-        case 3:
-            parent->set_font(font_3);
-            break;
-        default:
-            parent->set_font(font_4);
-            break;
-    }
+    parent->set_font(font_for_size(style->text_size));
 
-    parent->get_text_bounds(
-            message.c_str(),
-            1,
-            0,
-            0,
-            &x1,
-            &y1,
-            &w1,
-            &h1
-    );
+    if (!layout_valid) {
+        update_layout();
+    }
 
     parent->print(
             message.c_str(),
-            (style.h_align == LabelStyle::HorizontalAlignment::CENTER_ALIGN)
-            ? (2*widget_x + widget_w - w1) / 2
-            : (style.h_align == LabelStyle::HorizontalAlignment::LEFT_ALIGN)
-            ? widget_x + style.border_w
-            : widget_x + widget_w - style.border_w - w1,
-            ((style.v_align == LabelStyle::VerticalAlignment::MIDDLE_ALIGN)
-            ? (2*widget_y + widget_h - h1) / 2
-            : (style.v_align == LabelStyle::VerticalAlignment::TOP_ALIGN)
-            ? widget_y + style.border_w
-            : widget_y + widget_h - style.border_w - h1) + h1,
-            1,// style.text_size,
-            style.fg_color
+            text_x,
+            text_y,
+            1, //style->text_size,
+            style->fg_color
     );
 }
 
+void Label::update_layout() {
+
+    int16_t x1, y1;
+
+    parent->get_text_bounds(message.c_str(), 1, 0, 0, &x1, &y1, &text_w, &text_h);
+
+    text_x = (style->h_align == LabelStyle::HorizontalAlignment::CENTER_ALIGN)
+            ? (2*widget_x + widget_w - text_w) / 2
+            : (style->h_align == LabelStyle::HorizontalAlignment::LEFT_ALIGN)
+            ? widget_x + style->border_w
+            : widget_x + widget_w - style->border_w - text_w;
+
+    text_y = ((style->v_align == LabelStyle::VerticalAlignment::MIDDLE_ALIGN)
+            ? (2*widget_y + widget_h - text_h) / 2
+            : (style->v_align == LabelStyle::VerticalAlignment::TOP_ALIGN)
+            ? widget_y + style->border_w
+            : widget_y + widget_h - style->border_w - text_h) + text_h;
+
+    layout_valid = true;
+}
+
 // Label Style
 
+const LabelStyle LabelStyle::DEFAULT {};
+
 LabelStyle *LabelStyle::set_horizontal_alignment(LabelStyle::HorizontalAlignment new_h_align) {
     h_align = new_h_align;
     return this;
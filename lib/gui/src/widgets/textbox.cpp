@@ -6,19 +6,122 @@
  */
 
 #include "widgets/textbox.h"
+#include "profiler.h"
 
 TextBox::TextBox(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height)
     : Label(parent, x, y, width, height)
 {}
 
 TextBox *TextBox::create(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height) {
-    TextBox *textbox = new (std::nothrow) TextBox(parent, x, y, width, height);
+    TextBox *textbox = new (std::nothrow, TYPE_NAME) TextBox(parent, x, y, width, height);
     if (textbox != nullptr) {
         parent->add_child(textbox);
     }
     return textbox;
 }
 
+TextBox *TextBox::append_to_message(char ch) {
+
+    unsigned old_len = message.length();
+    bool was_dirty = dirty;
+
+    Label::append_to_message(ch);
+
+    if (message.length() != old_len) {
+        set_partially_dirty(was_dirty, old_len);
+    }
+
+    return this;
+}
+
+TextBox *TextBox::pop_from_message() {
+
+    unsigned old_len = message.length();
+    bool was_dirty = dirty;
+
+    Label::pop_from_message();
+
+    if (message.length() != old_len) {
+        set_partially_dirty(was_dirty, old_len);
+    }
+
+    return this;
+}
+
+// Label overrides
+
+bool TextBox::get_partially_dirty() const { return partially_dirty; }
+
+void TextBox::draw() {
+
+    Label::draw();
+
+    partially_dirty = false;
+    drawn = true;
+
+    stable_len = message.length();
+    drawn_text_y = text_y;
+    measure_text(stable_len, &ink_right, &ink_top, &ink_bottom);
+}
+
+bool TextBox::draw_partial() {
+
+    PROFILE_ZONE(PROFILE_DRAW_LABEL);
+
+    unsigned from;
+    unsigned stable_x;
+    int16_t right, top, bottom;
+
+    partially_dirty = false;
+
+    parent->set_font(font_for_size(style->text_size));
+
+    if (!layout_valid) {
+        update_layout();
+    }
+
+    // the baseline depends on the height of the whole text, and the text must be reflowed if it moved
+    if (!drawn || text_y != drawn_text_y) {
+        dirty = true;
+        return false;
+    }
+
+    // erase everything that was drawn after the unchanged characters
+    stable_x = measure_text(stable_len, &right, &top, &bottom);
+    right = min<int16_t>(ink_right, widget_x + widget_w - style->border_w);
+
+    if (right > (int16_t)stable_x && ink_bottom > ink_top) {
+        parent->fill_rect(stable_x, ink_top, right - stable_x, ink_bottom - ink_top, style->bg_color);
+    }
+
+    // the last unchanged glyph is drawn again, since it may overhang into the erased cell
+    from = (stable_len != 0) ? stable_len - 1 : 0;
+
+    // the typed text is arbitrary, and its glyphs would only evict the glyphs of the labels from the cache
+    if (from != message.length()) {
+        parent->print_uncached(
+                message.c_str() + from,
+                measure_text(from, &right, &top, &bottom),
+                text_y,
+                1,
+                style->fg_color
+        );
+    }
+
+    stable_len = message.length();
+    measure_text(stable_len, &ink_right, &ink_top, &ink_bottom);
+
+    return true;
+}
+
+void TextBox::clear() {
+
+    Label::clear();
+
+    partially_dirty = false;
+    drawn = false;
+}
+
 bool TextBox::propagate_press(unsigned x, unsigned y) {
 
     if (!get_intersection(x, y)) {
@@ -29,14 +132,6 @@ bool TextBox::propagate_press(unsigned x, unsigned y) {
         return true;
     }
 
-    {
-        unsigned cur_epoch = millis();
-        if ((cur_epoch - last_press_epoch) < DEBOUNCE_THRESH) {
-            return true;
-        }
-        last_press_epoch = cur_epoch;
-    }
-
     dirty = true;
     pressed = true;
 
@@ -124,3 +219,47 @@ TextBox *TextBox::set_interactable(bool new_state) {
 }
 
 bool TextBox::get_interactable() const { return enabled; }
+
+void TextBox::set_partially_dirty(bool was_dirty, unsigned old_len) {
+
+    // only left-aligned text keeps its unchanged characters in place
+    if (was_dirty || !drawn || style->h_align != LabelStyle::HorizontalAlignment::LEFT_ALIGN) {
+        return;
+    }
+
+    dirty = false;
+    partially_dirty = true;
+    stable_len = min(stable_len, old_len);
+}
+
+unsigned TextBox::measure_text(unsigned len, int16_t *right, int16_t *top, int16_t *bottom) const {
+
+    const GFXfont *font = font_for_size(style->text_size);
+    unsigned x = text_x;
+
+    *right = text_x;
+    *top = text_y;
+    *bottom = text_y;
+
+    // mirrors the way the display advances its cursor while printing (see `Adafruit_GFX::write`)
+    for (unsigned idx = 0; idx < len; ++idx) {
+
+        uint8_t ch = message[idx];
+
+        if (ch < font->first || ch > font->last) {
+            continue;
+        }
+
+        const GFXglyph &glyph = font->glyph[ch - font->first];
+
+        if (glyph.width != 0 && glyph.height != 0) {
+            *right = max<int16_t>(*right, x + glyph.xOffset + glyph.width);
+            *top = min<int16_t>(*top, text_y + glyph.yOffset);
+            *bottom = max<int16_t>(*bottom, text_y + glyph.yOffset + glyph.height);
+        }
+
+        x += glyph.xAdvance;
+    }
+
+    return x;
+}
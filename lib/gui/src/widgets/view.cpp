@@ -5,8 +5,8 @@
  *
  */
 
-#include "algorithm"
 #include "widgets/view.h"
+#include "profiler.h"
 
 View::View(App *app)
     : app {app}
@@ -15,10 +15,16 @@ View::View(App *app)
 }
 
 View *View::create(App *app) {
-    View *view = new View(app);
+    View *view = new (std::nothrow, TYPE_NAME) View(app);
     return view;
 }
 
+View::~View() {
+    for (auto &child : children) {
+        delete child;
+    }
+}
+
 // BasicWidget overrides
 
 App *View::get_parent() { return app; }
@@ -40,6 +46,8 @@ void View::set_visibility_changed() { return; }
 
 void View::draw() {
 
+    PROFILE_ZONE(PROFILE_DRAW_VIEW);
+
     dirty = false;
 
     for (auto it = children.rbegin(); it != children.rend(); ++it) {
@@ -63,22 +71,21 @@ bool View::get_intersection(BasicWidget *other) const { return true; }
 
 bool View::propagate_press(unsigned x, unsigned y) {
 
-    for (auto &child : children) {
-        if (child->get_visibility() && child->propagate_press(x, y)) {
-            break;
-        }
-    }
+    children.propagate_press(x, y);
 
     return true;
 }
 
 bool View::propagate_release(unsigned x, unsigned y) {
 
-    for (auto &child : children) {
-        if (child->get_visibility() && child->propagate_release(x, y)) {
-            break;
-        }
-    }
+    children.propagate_release(x, y);
+
+    return true;
+}
+
+bool View::propagate_gesture(const gesture_t &gesture) {
+
+    children.propagate_gesture(gesture);
 
     return true;
 }
@@ -150,6 +157,11 @@ View *View::print(const char *text, unsigned int x, unsigned int y, unsigned int
     return this;
 }
 
+View *View::print_uncached(const char *text, unsigned int x, unsigned int y, unsigned int text_size, uint16_t fg_color) {
+    app->print_uncached(text, x, y, text_size, fg_color);
+    return this;
+}
+
 View *View::print_opaque(const char *text, unsigned int x, unsigned int y, unsigned int text_size, uint16_t fg_color,
                            uint16_t bg_color) {
     app->print_opaque(text, x, y, text_size, fg_color, bg_color);
@@ -161,9 +173,29 @@ View *View::draw_rgb_bitmap(unsigned x, unsigned y, const uint16_t *data, unsign
     return this;
 }
 
+View *View::begin_write_window(unsigned x, unsigned y, unsigned w, unsigned h) {
+    app->begin_write_window(x, y, w, h);
+    return this;
+}
+
+View *View::write_colors(const uint16_t *colors, unsigned count) {
+    app->write_colors(colors, count);
+    return this;
+}
+
+View *View::write_color_run(uint16_t color, unsigned count) {
+    app->write_color_run(color, count);
+    return this;
+}
+
+View *View::end_write_window() {
+    app->end_write_window();
+    return this;
+}
+
 View *View::add_child(BasicWidget *child) {
 
-    children.emplace_back(child);
+    children.push_back(child);
     return this;
 }
 
@@ -172,14 +204,12 @@ unsigned View::get_children_count() const { return children.size(); }
 View *View::send_front(BasicWidget *child, unsigned amt) {
 
     unsigned cur_z, new_z;
-    std::vector<BasicWidget *>::iterator it;
 
-    it = std::find(children.begin(), children.end(), child);
-    if (it == children.end()) {
+    cur_z = children.find(child);
+    if (cur_z == children.size()) {
         return this;
     }
 
-    cur_z = it - children.begin();
     new_z = (amt == 0)
     ? 0
     : cur_z - min(amt, cur_z);
@@ -188,10 +218,7 @@ View *View::send_front(BasicWidget *child, unsigned amt) {
         return this;
     }
 
-    for (unsigned i = cur_z; i > new_z; --i) {
-        children[i] = children[i - 1];
-    }
-    children[new_z] = child;
+    children.move(cur_z, new_z);
     child->set_dirty();
 
     return this;
@@ -200,14 +227,12 @@ View *View::send_front(BasicWidget *child, unsigned amt) {
 View *View::send_back(BasicWidget *child, unsigned amt) {
 
     unsigned cur_z, new_z;
-    std::vector<BasicWidget *>::iterator it;
 
-    it = std::find(children.begin(), children.end(), child);
-    if (it == children.end()) {
+    cur_z = children.find(child);
+    if (cur_z == children.size()) {
         return this;
     }
 
-    cur_z = it - children.begin();
     new_z = (amt == 0)
     ? children.size() - 1
     : min(children.size() - 1, cur_z + amt);
@@ -216,15 +241,22 @@ View *View::send_back(BasicWidget *child, unsigned amt) {
         return this;
     }
 
-    for (unsigned i = cur_z; i < new_z; ++i) {
-        children[i] = children[i + 1];
-    }
-    children[new_z] = child;
+    children.move(cur_z, new_z);
     child->set_dirty();
 
     return this;
 }
 
+View *View::enable_spatial_index() {
+
+    children.enable_index(app->get_width(), app->get_height());
+    return this;
+}
+
+void View::notify_visibility(BasicWidget *child, bool visible) {
+    children.set_visibility(child, visible);
+}
+
 void View::collect_dirty_widgets(RingQueueInterface<BasicWidget *> *dirty_widgets) {
 
     BasicWidget *child;
@@ -233,7 +265,7 @@ void View::collect_dirty_widgets(RingQueueInterface<BasicWidget *> *dirty_widget
 
         child = *it;
 
-        if (child->get_dirty()) {
+        if (child->get_dirty() || child->get_partially_dirty()) {
             dirty_widgets->push(child);
             continue;
         }
@@ -246,49 +278,31 @@ void View::collect_dirty_widgets(RingQueueInterface<BasicWidget *> *dirty_widget
 
 void View::collect_overlapped_widgets(BasicWidget *dirty, BasicWidget *child, RingQueueInterface<BasicWidget *> *overlapping_widgets) {
 
-    std::vector<BasicWidget *>::reverse_iterator it;
-    BasicWidget *current;
-
-    it = std::find(children.rbegin(), children.rend(), child);
-    if (it == children.rend()) {
+    unsigned child_z = children.find(child);
+    if (child_z == children.size()) {
         return;
     }
 
-    for (++it; it != children.rend(); ++it) {
-        current = *it;
+    // the view covers the whole display, so absolute coordinates are already relative to it
+    signed x0 = dirty->get_absolute_x();
+    signed y0 = dirty->get_absolute_y();
+    signed x1 = x0 + dirty->get_width();
+    signed y1 = y0 + dirty->get_height();
 
-        if (current->get_dirty() || !current->get_visibility()) {
-            continue;
-        }
-
-        // if (dirty->get_intersection(current)) {
-        if (current->get_intersection(dirty)) {
-            current->set_dirty();
-            overlapping_widgets->push(current);
-        }
-    }
+    // only the children in front of `child` can be above `dirty`
+    children.collect_overlapping(0, child_z, x0, y0, x1, y1, overlapping_widgets);
 }
 
 void View::collect_underlapped_widgets(BasicWidget *child, RingQueueInterface<BasicWidget *> *overlapping_widgets) {
 
-    BasicWidget *current;
+    unsigned child_z = children.find(child);
 
-    for (auto it = children.rbegin(); it != children.rend(); ++it) {
-
-        current = *it;
+    // the view covers the whole display, so absolute coordinates are already relative to it
+    signed x0 = child->get_absolute_x();
+    signed y0 = child->get_absolute_y();
+    signed x1 = x0 + child->get_width();
+    signed y1 = y0 + child->get_height();
 
-        if (current == child) {
-            break;
-        }
-
-        if (current->get_dirty() || !current->get_visibility()) {
-            continue;
-        }
-
-        // if (dirty->get_intersection(current)) {
-        if (current->get_intersection(child)) {
-            current->set_dirty();
-            overlapping_widgets->push(current);
-        }
-    }
+    // every child behind `child` (or every child, if it is not in this frame)
+    children.collect_overlapping((child_z == children.size()) ? 0 : child_z + 1, children.size(), x0, y0, x1, y1, overlapping_widgets);
 }
@@ -6,6 +6,7 @@
  */
 
 #include "widgets/window.h"
+#include "profiler.h"
 
 Window::Window(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height)
     : parent {parent}
@@ -18,13 +19,20 @@ Window::Window(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned h
 {}
 
 Window *Window::create(Frame *parent, unsigned x, unsigned y, unsigned width, unsigned height) {
-    Window *window = new Window(parent, x, y, width, height);
+    Window *window = new (std::nothrow, TYPE_NAME) Window(parent, x, y, width, height);
     if (window != nullptr) {
         parent->add_child(window);
     }
     return window;
 }
 
+Window::~Window() {
+
+    for (auto &child : children) {
+        delete child;
+    }
+}
+
 WindowStyle *Window::get_style() {
 
     dirty = true;
@@ -52,6 +60,8 @@ void Window::set_visibility_changed() { visibility_changed = true; }
 
 void Window::draw() {
 
+    PROFILE_ZONE(PROFILE_DRAW_WINDOW);
+
     dirty = false;
     visibility_changed = false;
 
@@ -212,11 +222,7 @@ bool Window::propagate_press(unsigned x, unsigned y) {
     x -= widget_x;
     y -= widget_y;
 
-    for (auto &child : children) {
-        if (child->get_visibility() && child->propagate_press(x, y)) {
-            break;
-        }
-    }
+    children.propagate_press(x, y);
 
     return true;
 }
@@ -230,12 +236,24 @@ bool Window::propagate_release(unsigned x, unsigned y) {
     x -= widget_x;
     y -= widget_y;
 
-    for (auto &child : children) {
-        if (child->get_visibility() && child->propagate_release(x, y)) {
-            break;
-        }
+    children.propagate_release(x, y);
+
+    return true;
+}
+
+bool Window::propagate_gesture(const gesture_t &gesture) {
+
+    gesture_t relative = gesture;
+
+    if (!get_intersection(gesture.x, gesture.y)) {
+        return false;
     }
 
+    relative.x -= widget_x;
+    relative.y -= widget_y;
+
+    children.propagate_gesture(relative);
+
     return true;
 }
 
@@ -251,6 +269,7 @@ void Window::set_visibility(bool new_visibility) {
     visibility_changed = true;
 
     visible = new_visibility;
+    parent->notify_visibility(this, new_visibility);
 }
 
 // Frame overrides
@@ -316,6 +335,11 @@ Window *Window::print(const char *text, unsigned int x, unsigned int y, unsigned
     return this;
 }
 
+Window *Window::print_uncached(const char *text, unsigned int x, unsigned int y, unsigned int text_size, uint16_t fg_color) {
+    parent->print_uncached(text, widget_x + x, widget_y + y, text_size, fg_color);
+    return this;
+}
+
 Window *Window::print_opaque(const char *text, unsigned int x, unsigned int y, unsigned int text_size, uint16_t fg_color,
                           uint16_t bg_color) {
     parent->print_opaque(text, widget_x + x, widget_y + y, text_size, fg_color, bg_color);
@@ -327,9 +351,29 @@ Window *Window::draw_rgb_bitmap(unsigned x, unsigned y, const uint16_t *data, un
     return this;
 }
 
+Window *Window::begin_write_window(unsigned x, unsigned y, unsigned w, unsigned h) {
+    parent->begin_write_window(x + widget_x, y + widget_y, w, h);
+    return this;
+}
+
+Window *Window::write_colors(const uint16_t *colors, unsigned count) {
+    parent->write_colors(colors, count);
+    return this;
+}
+
+Window *Window::write_color_run(uint16_t color, unsigned count) {
+    parent->write_color_run(color, count);
+    return this;
+}
+
+Window *Window::end_write_window() {
+    parent->end_write_window();
+    return this;
+}
+
 Window *Window::add_child(BasicWidget *child) {
 
-    children.emplace_back(child);
+    children.push_back(child);
     return this;
 }
 
@@ -338,14 +382,12 @@ unsigned Window::get_children_count() const { return children.size(); }
 Window *Window::send_front(BasicWidget *child, unsigned amt) {
 
     unsigned cur_z, new_z;
-    std::vector<BasicWidget *>::iterator it;
 
-    it = std::find(children.begin(), children.end(), child);
-    if (it == children.end()) {
+    cur_z = children.find(child);
+    if (cur_z == children.size()) {
         return this;
     }
 
-    cur_z = it - children.begin();
     new_z = (amt == 0)
     ? 0
     : cur_z - min(amt, cur_z);
@@ -354,10 +396,7 @@ Window *Window::send_front(BasicWidget *child, unsigned amt) {
         return this;
     }
 
-    for (unsigned i = cur_z; i > new_z; --i) {
-        children[i] = children[i - 1];
-    }
-    children[new_z] = child;
+    children.move(cur_z, new_z);
     child->set_dirty();
 
     return this;
@@ -366,14 +405,12 @@ Window *Window::send_front(BasicWidget *child, unsigned amt) {
 Window *Window::send_back(BasicWidget *child, unsigned amt) {
 
     unsigned cur_z, new_z;
-    std::vector<BasicWidget *>::iterator it;
 
-    it = std::find(children.begin(), children.end(), child);
-    if (it == children.end()) {
+    cur_z = children.find(child);
+    if (cur_z == children.size()) {
         return this;
     }
 
-    cur_z = it - children.begin();
     new_z = (amt == 0)
     ? children.size() - 1
     : min(children.size() - 1, cur_z + amt);
@@ -382,15 +419,22 @@ Window *Window::send_back(BasicWidget *child, unsigned amt) {
         return this;
     }
 
-    for (unsigned i = cur_z; i < new_z; ++i) {
-        children[i] = children[i + 1];
-    }
-    children[new_z] = child;
+    children.move(cur_z, new_z);
     child->set_dirty();
 
     return this;
 }
 
+Window *Window::enable_spatial_index() {
+
+    children.enable_index(widget_w, widget_h);
+    return this;
+}
+
+void Window::notify_visibility(BasicWidget *child, bool visible) {
+    children.set_visibility(child, visible);
+}
+
 void Window::collect_dirty_widgets(RingQueueInterface<BasicWidget *> *dirty_widgets) {
 
     BasicWidget *child;
@@ -399,7 +443,7 @@ void Window::collect_dirty_widgets(RingQueueInterface<BasicWidget *> *dirty_widg
 
         child = *it;
 
-        if (child->get_dirty()) {
+        if (child->get_dirty() || child->get_partially_dirty()) {
             dirty_widgets->push(child);
             continue;
         }
@@ -412,54 +456,38 @@ void Window::collect_dirty_widgets(RingQueueInterface<BasicWidget *> *dirty_widg
 
 void Window::collect_overlapped_widgets(BasicWidget *dirty, BasicWidget *child, RingQueueInterface<BasicWidget *> *overlapping_widgets) {
 
-    std::vector<BasicWidget *>::reverse_iterator it;
-    BasicWidget *current;
-
-    it = std::find(children.rbegin(), children.rend(), child);
-    if (it == children.rend()) {
+    unsigned child_z = children.find(child);
+    if (child_z == children.size()) {
         return;
     }
 
-    for (++it; it != children.rend(); ++it) {
-        current = *it;
+    // the rectangle is made relative to the window, to match the bounding boxes of the children
+    signed x0 = (signed)dirty->get_absolute_x() - (signed)widget_absolute_x;
+    signed y0 = (signed)dirty->get_absolute_y() - (signed)widget_absolute_y;
+    signed x1 = x0 + dirty->get_width();
+    signed y1 = y0 + dirty->get_height();
 
-        if (current->get_dirty() || !current->get_visibility()) {
-            continue;
-        }
-        // if (dirty->get_intersection(current)) {
-        if (current->get_intersection(dirty)) {
-            current->set_dirty();
-            overlapping_widgets->push(current);
-        }
-    }
+    // only the children in front of `child` can be above `dirty`
+    children.collect_overlapping(0, child_z, x0, y0, x1, y1, overlapping_widgets);
 }
 
 void Window::collect_underlapped_widgets(BasicWidget *child, RingQueueInterface<BasicWidget *> *overlapping_widgets) {
 
-    BasicWidget *current;
-
-    for (auto it = children.rbegin(); it != children.rend(); ++it) {
-
-        current = *it;
+    unsigned child_z = children.find(child);
 
-        if (current == child) {
-            break;
-        }
-
-        if (current->get_dirty() || !current->get_visibility()) {
-            continue;
-        }
+    // the rectangle is made relative to the window, to match the bounding boxes of the children
+    signed x0 = (signed)child->get_absolute_x() - (signed)widget_absolute_x;
+    signed y0 = (signed)child->get_absolute_y() - (signed)widget_absolute_y;
+    signed x1 = x0 + child->get_width();
+    signed y1 = y0 + child->get_height();
 
-        // if (dirty->get_intersection(current)) {
-        if (current->get_intersection(child)) {
-            current->set_dirty();
-            overlapping_widgets->push(current);
-        }
-    }
+    // every child behind `child` (or every child, if it is not in this frame)
+    children.collect_overlapping((child_z == children.size()) ? 0 : child_z + 1, children.size(), x0, y0, x1, y1, overlapping_widgets);
 }
 
 WindowStyle *WindowStyle::set_bg_color(uint16_t new_color) {
     bg_color = new_color;
+    return this;
 }
 
 uint16_t WindowStyle::get_bg_color() const {
@@ -5,6 +5,7 @@
 
 #include "touchscreen_driver.h"
 #include "touchscreen_constants.h"
+#include "touchcalibration.h"
 
 #include "Adafruit_GFX.h"
 
@@ -21,13 +22,186 @@
 #include "widgets/bitmap.h"
 
 #include "bitmaps.h"
+#include "gesture.h"
+#include "layout.h"
+#include "profiler.h"
 
 MCUFRIEND_kbv tft;
 
 Touchscreen ts(XP, YP, XM, YM);
 
+/** Turns the touches into debounced presses and releases, and gestures */
+GestureRecognizer gestures;
+
 App *app;
 
+/** Time after which the information view is destroyed while it is not shown (it is rarely visited and quick to rebuild) */
+constexpr unsigned long INFORMATION_VIEW_IDLE_TIMEOUT = 30000;
+
+/** Time from the start of `setup` until the first frame was drawn (in microseconds) */
+unsigned long boot_to_first_frame_us;
+
+App::view_id_t startup_view_id;
+App::view_id_t main_view_id;
+App::view_id_t connection_view_id;
+App::view_id_t information_view_id;
+
+// styles shared by several widgets (each is built once, widgets point to it instead of holding a copy)
+
+/** Style of the back buttons at the top-left of the views */
+const ButtonStyle BACK_BUTTON_STYLE = [] {
+
+    ButtonStyle style;
+
+    (&style)
+    ->set_text_size(2)
+    ->set_bg_color(RED)
+    ->set_fg_color(BLACK)
+    ->set_pressed_bg_color(blend_color(RED, BLACK, 160))
+    ->set_pressed_fg_color(WHITE)
+    ->set_border_width(0)
+    ->set_border_radius(14);
+
+    return style;
+}();
+
+/** Style of the buttons that open other views from the tools window */
+const ButtonStyle TOOL_BUTTON_STYLE = [] {
+
+    ButtonStyle style;
+
+    style.set_text_size(2);
+
+    return style;
+}();
+
+/** Style of the titles of the views, and other borderless text */
+const LabelStyle TITLE_STYLE = [] {
+
+    LabelStyle style;
+
+    (&style)
+    ->set_text_size(2)
+    ->set_border_width(0)
+    ->set_border_radius(0);
+
+    return style;
+}();
+
+/** Style of the labels above the fields of the connection form */
+const LabelStyle FORM_LABEL_STYLE = [] {
+
+    LabelStyle style;
+
+    (&style)
+    ->set_text_size(2)
+    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::LEFT_ALIGN)
+    ->set_border_radius(0)
+    ->set_border_width(0);
+
+    return style;
+}();
+
+/** Style of the fields of the connection form */
+const LabelStyle FORM_BOX_STYLE = [] {
+
+    LabelStyle style;
+
+    (&style)
+    ->set_text_size(2)
+    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::LEFT_ALIGN)
+    ->set_border_radius(2)
+    ->set_border_width(2)
+    ->set_bg_color(blend_color(BLACK, BLUE, 18));
+
+    return style;
+}();
+
+/** Style of the names in the table of the information view */
+const LabelStyle READONLY_LABEL_STYLE = [] {
+
+    LabelStyle style;
+
+    (&style)
+    ->set_text_size(2)
+    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::RIGHT_ALIGN)
+    ->set_border_radius(0)
+    ->set_border_width(1);
+
+    return style;
+}();
+
+/** Style of the values in the table of the information view */
+const LabelStyle READONLY_BOX_STYLE = [] {
+
+    LabelStyle style;
+
+    (&style)
+    ->set_text_size(2)
+    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::CENTER_ALIGN)
+    ->set_border_radius(0)
+    ->set_border_width(1);
+
+    return style;
+}();
+
+// layouts (every rectangle is relative to its parent, and is computed at compile-time)
+
+/** Number of columns of the display (in the default rotation) */
+constexpr unsigned DISPLAY_W = 320;
+/** Number of rows of the display (in the default rotation) */
+constexpr unsigned DISPLAY_H = 480;
+
+constexpr rect_t BACK_BUTTON_RECT {3, 3, 24, 24};
+constexpr rect_t TITLE_RECT {30, 1, DISPLAY_W - 30 - 10, 27};
+
+/** Area below the title that holds the contents of a view */
+constexpr rect_t BODY_RECT {5, 30, DISPLAY_W - 10, DISPLAY_H - 45};
+
+constexpr rect_t CANVAS_ICON_RECT {30, 30, main_app_bmp2.width, main_app_bmp2.height};
+constexpr rect_t SETTINGS_ICON_RECT = right_of(CANVAS_ICON_RECT, 30, settings_app_bmp.width, settings_app_bmp.height);
+constexpr rect_t INFORMATION_ICON_RECT = right_of(SETTINGS_ICON_RECT, 30, information_app_bmp.width, information_app_bmp.height);
+
+constexpr rect_t CANVAS_RECT {4, 30, DrawableCanvas::WIDTH, DrawableCanvas::HEIGHT};
+constexpr rect_t TOOLS_RECT {5, 345, DISPLAY_W - 10, DISPLAY_H - 345 - 5};
+
+constexpr rect_t COLOR_SELECTOR_RECT {2, 2, ColorSelector::WIDTH, ColorSelector::HEIGHT};
+constexpr rect_t SIZE_SELECTOR_RECT {COLOR_SELECTOR_RECT.right() + 18, 11, PenSizeSelector::WIDTH, PenSizeSelector::HEIGHT};
+
+constexpr rect_t SAVE_BUTTON_RECT {COLOR_SELECTOR_RECT.right() + 3, SIZE_SELECTOR_RECT.bottom() + 3, 64, 30};
+constexpr rect_t LOAD_BUTTON_RECT = right_of(SAVE_BUTTON_RECT, 3);
+constexpr rect_t CONNECTION_BUTTON_RECT = below(SAVE_BUTTON_RECT, 3);
+constexpr rect_t INFORMATION_BUTTON_RECT = right_of(CONNECTION_BUTTON_RECT, 3);
+constexpr rect_t CLEAR_BUTTON_RECT = right_of(LOAD_BUTTON_RECT, 3, 40, CONNECTION_BUTTON_RECT.bottom() - LOAD_BUTTON_RECT.y);
+
+constexpr rect_t SLOT_SELECTION_RECT {16, 16, 280, 100};
+constexpr rect_t SLOT_EXIT_BUTTON_RECT {2, 2, 13, 13};
+/** Rectangle of the first slot button (the others are laid out in a grid from it) */
+constexpr rect_t SLOT_BUTTON_RECT {16, 16, 80, 32};
+constexpr rect_t COMMUNICATION_STATUS_RECT = inset(SLOT_SELECTION_RECT, 14, 12);
+
+/** Area of the connection form that holds the fields */
+constexpr rect_t FORM_RECT = inset(BODY_RECT, 10, 10);
+
+constexpr rect_t SSID_LABEL_RECT {FORM_RECT.x, FORM_RECT.y, FORM_RECT.w, 30};
+constexpr rect_t SSID_BOX_RECT = below(SSID_LABEL_RECT, 3, FORM_RECT.w, 34);
+constexpr rect_t PASS_LABEL_RECT = below(SSID_BOX_RECT, 13, FORM_RECT.w, 30);
+constexpr rect_t PASS_BOX_RECT = below(PASS_LABEL_RECT, 3, FORM_RECT.w, 34);
+constexpr rect_t ADDR_LABEL_RECT = below(PASS_BOX_RECT, 13, FORM_RECT.w, 30);
+constexpr rect_t ADDR_BOX_RECT = below(ADDR_LABEL_RECT, 3, FORM_RECT.w, 34);
+constexpr rect_t CONNECT_BUTTON_RECT = below(ADDR_BOX_RECT, 23, FORM_RECT.w, 40);
+constexpr rect_t STATUS_LABEL_RECT = bottom_of(inset(BODY_RECT, 10, 0), 5, 30);
+
+constexpr rect_t INFORMATION_TITLE_RECT {30, 3, DISPLAY_W - 30 - 10, 25};
+
+constexpr rect_t SSID_READONLY_LABEL_RECT {12, 20, ((BODY_RECT.w - 24) / 2) - 30, 35};
+constexpr rect_t SSID_READONLY_BOX_RECT = right_of(SSID_READONLY_LABEL_RECT, -1, BODY_RECT.w - SSID_READONLY_LABEL_RECT.right() - 12, 35);
+constexpr rect_t IP_ADDR_LABEL_RECT = below(SSID_READONLY_LABEL_RECT, -1);
+constexpr rect_t IP_ADDR_BOX_RECT = below(SSID_READONLY_BOX_RECT, -1);
+
+constexpr rect_t QRCODE_RECT {(BODY_RECT.w - qrcode_bmp.width) / 2, BODY_RECT.h - qrcode_bmp.height - 30, qrcode_bmp.width, qrcode_bmp.height};
+constexpr rect_t WEBSITE_LABEL_RECT = bottom_of(inset(BODY_RECT, 10, 0), 5, 20);
+
 // startup view
 
 View *startup_view;
@@ -72,6 +246,8 @@ struct slot_button_args_t {
     Button *caller;
 };
 
+slot_button_args_t transfer_args;
+
 // connection view
 
 View *connection_view;
@@ -95,6 +271,14 @@ Label *status_label;
 
 Keyboard *keyboard;
 
+constexpr unsigned MAX_WIFI_RETRY = 2;
+constexpr unsigned long CONNECT_STATUS_DELAY = 20;
+
+unsigned wifi_attempts_left;
+
+/** Timer of the next connection attempt (0 while no attempt is pending) */
+App::timer_id_t connect_timer {0};
+
 // information view
 
 View *information_view;
@@ -116,11 +300,15 @@ Label *dumblebots_website_label;
 
 [[noreturn]] void err(const char msg[]);
 
+void calibrate_touchscreen();
+void draw_target(const touch_point_t &target);
+void wait_for_tap(touch_point_t *raw);
 
-void init_startup_view();
-void init_main_view();
-void init_connection_view();
-void init_information_view();
+
+View *init_startup_view();
+View *init_main_view();
+View *init_connection_view();
+View *init_information_view();
 
 
 // main view
@@ -129,6 +317,10 @@ void switch_to_startup(unsigned *args);
 void switch_to_connection(unsigned *args);
 void switch_to_information(unsigned *args);
 void switch_to_main(unsigned *args);
+void switch_back(unsigned *args);
+
+/** View that the back buttons of the connection and information views return to */
+InteractiveWidget::callback_t back_target = switch_to_startup;
 
 void select_color_cb(unsigned *args);
 void select_pen_size_cb(unsigned *args);
@@ -138,6 +330,8 @@ void clear_button_cb(unsigned *args);
 void open_slot_selection(unsigned *args);
 void exit_slot_selection(unsigned *args);
 void slot_selection_cb(unsigned *args);
+task_status_t transfer_task(task_t *task, unsigned *args);
+void set_transfer_controls(bool enabled);
 
 void server_connection_failure_cb(unsigned *args);
 void server_communication_failure_cb(unsigned *args);
@@ -158,98 +352,226 @@ bool verify_server();
 
 void setup() {
 
+    unsigned long boot_start = micros();
+
     Serial.begin(9600);
 
+    PROFILE_BEGIN();
+
     tft.begin(0x9486);
 
     ts.set_dimensions(tft.width(), tft.height());
     ts.set_pressure_bounds(PRESSURE_LO, PRESSURE_RIGHT);
 
+    // the screen is polled from the loop instead if no timer is available
+    if (!ts.begin_sampling()) {
+        Serial.println("Touchscreen sampling timer not available, polling instead");
+    }
+
     app = App::create(&tft);
     if (app == nullptr) {
         err("Error while creating app");
     }
 
-    init_startup_view();
-    init_main_view();
-    init_connection_view();
-    init_information_view();
+    // the layouts of the views are computed at compile-time for this size
+    if (app->get_width() != DISPLAY_W || app->get_height() != DISPLAY_H) {
+        err("Display size does not match the layouts");
+    }
+
+    // the stored calibration is used unless the screen is held down while booting
+    {
+        touch_calibration_t calibration;
+        bool loaded = TouchCalibration::load(&calibration);
+        unsigned x, y;
+
+        if (loaded) {
+            ts.set_calibration(calibration);
+        }
+
+        delay(100);
+        ts.read_screen();
+        while (ts.process_sample());
+
+        if (!loaded || ts.get_raw_position(&x, &y)) {
+            calibrate_touchscreen();
+        }
+    }
+
+    // views are only built when they are first shown, so that the first frame is not delayed by all of them
+    startup_view_id = app->register_view(init_startup_view);
+    main_view_id = app->register_view(init_main_view);
+    connection_view_id = app->register_view(init_connection_view);
+    information_view_id = app->register_view(init_information_view, INFORMATION_VIEW_IDLE_TIMEOUT);
+
+    app
+    ->set_phase_interval(App::PHASE_INPUT, 4000)
+    ->set_phase_interval(App::PHASE_RENDER, 16000)
+    ->set_phase_interval(App::PHASE_BACKGROUND, 10000)
+    ->set_frame_budget(8000);
 
-    app->make_active_view(startup_view);
+    app->make_active_view(startup_view_id);
     app->draw();
+
+    boot_to_first_frame_us = micros() - boot_start;
+
+    Serial.print("boot to first frame (us): ");
+    Serial.println(boot_to_first_frame_us);
 }
 
 void loop() {
 
+    PROFILE_ZONE(PROFILE_LOOP);
+
     bool press, release;
     unsigned px, py, rx, ry;
 
-    ts.read_screen();
+    if (app->is_due(App::PHASE_INPUT)) {
+
+        {
+            PROFILE_ZONE(PROFILE_READ_SCREEN);
+            ts.read_screen();
+        }
+
+        // every sample collected since the last frame is handled, so that strokes do not lose points while rendering
+        // only the samples present at the start are handled, so that a long stroke cannot hold the loop here
+        // presses and releases are debounced by the gesture recognizer, once for every touch rather than in every widget
+        for (unsigned pending = ts.get_pending(); pending != 0 && ts.process_sample(); --pending) {
+
+            gesture_t gesture;
+            bool touched = ts.get_stylus_position(&px, &py);
+
+            if (gestures.update(touched, px, py, ts.get_sample_time(), &gesture)) {
+                app->propagate_gesture(gesture);
+            }
 
-    press = ts.get_press(&px, &py);
-    release = ts.get_release(&rx, &ry);
+            press = gestures.get_press(&px, &py);
+            release = gestures.get_release(&rx, &ry);
 
-    if (release) {
-        app->propagate_release(rx, ry);
+            if (release) {
+                PROFILE_ZONE(PROFILE_PROPAGATE_RELEASE);
+                app->propagate_release(rx, ry);
+            }
+            if (press) {
+                PROFILE_ZONE(PROFILE_PROPAGATE_PRESS);
+                app->propagate_press(px, py);
+            }
+
+            // the canvas must not change while it is being transferred
+            // samples that barely moved are discarded by the touch filter, and are not stamped again
+            if (app->get_active_view() == main_view && !app->is_task_running(transfer_task) && ts.get_stylus_position(&px, &py)) {
+                if (ts.get_stylus_moved()) {
+                    PROFILE_ZONE(PROFILE_DRAW_AT);
+                    canvas->draw_at(px, py);
+                }
+                app->set_stroke_active(true);
+            }
+            else {
+                app->set_stroke_active(false);
+            }
+        }
     }
-    if (press) {
-        app->propagate_press(px, py);
+
+    if (app->is_due(App::PHASE_RENDER)) {
+        {
+            PROFILE_ZONE(PROFILE_COLLECT_DIRTY);
+            app->collect_dirty_widgets();
+        }
+        {
+            PROFILE_ZONE(PROFILE_UPDATE_DIRTY);
+            app->update_dirty_widgets();
+        }
     }
 
-    app
-    ->collect_dirty_widgets()
-    ->update_dirty_widgets()
-    ->execute_event_logic();
+    if (app->is_due(App::PHASE_BACKGROUND)) {
+        PROFILE_ZONE(PROFILE_EXECUTE_EVENTS);
+        app
+        ->execute_event_logic()
+        ->execute_timers()
+        ->execute_tasks()
+        ->release_idle_views();
+    }
 
-    {
-        if (app->get_active_view() == main_view && ts.get_stylus_position(&px, &py)) {
-            canvas->draw_at(px, py);
+#ifdef PROFILER_ENABLED
+    // any byte received over serial requests a report of the statistics collected so far
+    if (Serial.available()) {
+        while (Serial.available()) {
+            Serial.read();
         }
-    }
+        Serial.print("input misses: ");
+        Serial.println(app->get_deadline_misses(App::PHASE_INPUT));
+        Serial.print("render misses: ");
+        Serial.println(app->get_deadline_misses(App::PHASE_RENDER));
+        Serial.print("background misses: ");
+        Serial.println(app->get_deadline_misses(App::PHASE_BACKGROUND));
+        Serial.print("budget overruns: ");
+        Serial.println(app->get_budget_overruns());
+
+        unsigned high_water, dropped, coalesced;
+        app->get_event_counters(&high_water, &dropped, &coalesced);
+
+        Serial.print("event high water: ");
+        Serial.println(high_water);
+        Serial.print("events dropped: ");
+        Serial.println(dropped);
+        Serial.print("events coalesced: ");
+        Serial.println(coalesced);
+
+#ifdef GLYPH_CACHE_ENABLED
+        Serial.print("glyph cache hits: ");
+        Serial.println(app->get_glyph_cache()->get_hits());
+        Serial.print("glyph cache misses: ");
+        Serial.println(app->get_glyph_cache()->get_misses());
+#endif
 
-    delay(1);
+        WidgetPool::report(&Serial);
+
+        ts.report_filter(&Serial);
+
+        Serial.print("boot to first frame (us): ");
+        Serial.println(boot_to_first_frame_us);
+
+        PROFILE_REPORT(&Serial);
+    }
+#endif
 }
 
 /* ----- Start of Init functions ----- */
 
-void init_startup_view() {
+View *init_startup_view() {
 
     startup_view = View::create(app);
     if (startup_view == nullptr) {
         err("Error while creating startup view");
     }
 
-    startup_title = Label::create(startup_view, 30, 1, app->get_width() - 30 - 10, 27);
+    startup_title = Label::create(startup_view, TITLE_RECT.x, TITLE_RECT.y, TITLE_RECT.w, TITLE_RECT.h);
     if (startup_title == nullptr) {
         err("Error while creating startup title");
     }
 
-    apps_window = Window::create(startup_view, 5, 30, app->get_width() - 10, app->get_height() - 45);
+    apps_window = Window::create(startup_view, BODY_RECT.x, BODY_RECT.y, BODY_RECT.w, BODY_RECT.h);
     if (apps_window == nullptr) {
         err("Error while creating apps window");
     }
 
-    canvas_app_icon = Bitmap::create(apps_window, main_app_bmp2, 30, 30, 64, 92);
+    canvas_app_icon = Bitmap::create(apps_window, &main_app_bmp2, CANVAS_ICON_RECT.x, CANVAS_ICON_RECT.y);
     if (canvas_app_icon == nullptr) {
         err("Error while creating canvas app icon");
     }
 
-    settings_app_icon = Bitmap::create(apps_window, settings_app_bmp, canvas_app_icon->get_x() + canvas_app_icon->get_width() + 30, canvas_app_icon->get_y(), 64, 92);
+    settings_app_icon = Bitmap::create(apps_window, &settings_app_bmp, SETTINGS_ICON_RECT.x, SETTINGS_ICON_RECT.y);
     if (settings_app_icon == nullptr) {
         err("Error while creating settings app icon");
     }
 
-    information_app_icon = Bitmap::create(apps_window, information_app_bmp, settings_app_icon->get_x() + settings_app_icon->get_width() + 30, settings_app_icon->get_y(), 64, 92);
+    information_app_icon = Bitmap::create(apps_window, &information_app_bmp, INFORMATION_ICON_RECT.x, INFORMATION_ICON_RECT.y);
     if (information_app_icon == nullptr) {
         err("Error while creating information app icon");
     }
 
     startup_title
     ->set_message("Apps")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_border_width(0)
-    ->set_border_radius(0);
+    ->set_style(&TITLE_STYLE);
 
     apps_window
     ->get_style()
@@ -266,90 +588,94 @@ void init_startup_view() {
     information_app_icon
     ->set_event_queue(app->get_event_queue())
     ->set_onrelease(switch_to_information);
+
+    return startup_view;
 }
 
-void init_main_view() {
+View *init_main_view() {
 
     main_view = View::create(app);
     if (main_view == nullptr) {
         err("Error while creating main view");
     }
 
-    main_back_button = Button::create(main_view, 3, 15 - 12, 24, 24);
+    main_back_button = Button::create(main_view, BACK_BUTTON_RECT.x, BACK_BUTTON_RECT.y, BACK_BUTTON_RECT.w, BACK_BUTTON_RECT.h);
     if (main_back_button == nullptr) {
         err("Error while creating main back button");
     }
 
-    main_title = Label::create(main_view, 30, 1, app->get_width() - 30 - 10, 27);
+    main_title = Label::create(main_view, TITLE_RECT.x, TITLE_RECT.y, TITLE_RECT.w, TITLE_RECT.h);
     if (main_title == nullptr) {
         err("Error while creating main title");
     }
 
-    canvas = DrawableCanvas::create(main_view, 4, 30);
+    canvas = DrawableCanvas::create(main_view, CANVAS_RECT.x, CANVAS_RECT.y);
     if (canvas == nullptr) {
         err("Error while creating canvas");
     }
 
-    tools_window = Window::create(main_view, 5, 345, app->get_width() - 10, app->get_height() - 345 - 5);
+    tools_window = Window::create(main_view, TOOLS_RECT.x, TOOLS_RECT.y, TOOLS_RECT.w, TOOLS_RECT.h);
     if (tools_window == nullptr) {
         err("Error while creating tools window");
     }
 
-    color_selector = ColorSelector::create(tools_window, 2, 2);
+    color_selector = ColorSelector::create(tools_window, COLOR_SELECTOR_RECT.x, COLOR_SELECTOR_RECT.y);
     if (color_selector == nullptr) {
         err("Error while creating color selector");
     }
 
-    size_selector = PenSizeSelector::create(tools_window, color_selector->get_x() + color_selector->get_width() + 18, 11);
+    size_selector = PenSizeSelector::create(tools_window, SIZE_SELECTOR_RECT.x, SIZE_SELECTOR_RECT.y);
     if (size_selector == nullptr) {
         err("Error while creating pen size selector");
     }
 
-    save_button = Button::create(tools_window, color_selector->get_x() + color_selector->get_width() + 3, size_selector->get_y() + size_selector->get_height() + 3, 64, 30);
+    save_button = Button::create(tools_window, SAVE_BUTTON_RECT.x, SAVE_BUTTON_RECT.y, SAVE_BUTTON_RECT.w, SAVE_BUTTON_RECT.h);
     if (save_button == nullptr) {
         err("Error while creating save button");
     }
 
-    load_button = Button::create(tools_window, save_button->get_x() + save_button->get_width() + 3, save_button->get_y(), 64, 30);
+    load_button = Button::create(tools_window, LOAD_BUTTON_RECT.x, LOAD_BUTTON_RECT.y, LOAD_BUTTON_RECT.w, LOAD_BUTTON_RECT.h);
     if (load_button == nullptr) {
         err("Error while creating load button");
     }
 
-    connection_button = Button::create(tools_window, color_selector->get_x() + color_selector->get_width() + 3, save_button->get_y() + save_button->get_height() + 3, 64, 30);
+    connection_button = Button::create(tools_window, CONNECTION_BUTTON_RECT.x, CONNECTION_BUTTON_RECT.y, CONNECTION_BUTTON_RECT.w, CONNECTION_BUTTON_RECT.h);
     if (connection_button == nullptr) {
         err("Error while creating connection button");
     }
 
-    information_button = Button::create(tools_window, connection_button->get_x() + connection_button->get_width() + 3, connection_button->get_y(), 64, 30);
+    information_button = Button::create(tools_window, INFORMATION_BUTTON_RECT.x, INFORMATION_BUTTON_RECT.y, INFORMATION_BUTTON_RECT.w, INFORMATION_BUTTON_RECT.h);
     if (information_button == nullptr) {
         err("Error while creating information button");
     }
 
-    clear_button = Button::create(tools_window, load_button->get_x() + load_button->get_width() + 3, load_button->get_y(), 40, 3 + (30 * 2));
+    clear_button = Button::create(tools_window, CLEAR_BUTTON_RECT.x, CLEAR_BUTTON_RECT.y, CLEAR_BUTTON_RECT.w, CLEAR_BUTTON_RECT.h);
     if (clear_button == nullptr) {
         err("Error while creating clear button");
     }
 
-    slot_selection_window = Window::create(tools_window, 16, 16, 280, 100);
+    slot_selection_window = Window::create(tools_window, SLOT_SELECTION_RECT.x, SLOT_SELECTION_RECT.y, SLOT_SELECTION_RECT.w, SLOT_SELECTION_RECT.h);
     if (slot_selection_window == nullptr) {
         err("Error while creating slot selection window");
     }
 
-    slot_exit_button = Button::create(slot_selection_window, 2, 2, 13, 13);
+    slot_exit_button = Button::create(slot_selection_window, SLOT_EXIT_BUTTON_RECT.x, SLOT_EXIT_BUTTON_RECT.y, SLOT_EXIT_BUTTON_RECT.w, SLOT_EXIT_BUTTON_RECT.h);
     if (slot_exit_button == nullptr) {
         err("Error while creating slot exit button");
     }
 
     for (unsigned c = 0, i = 0; c < 3; ++c) {
         for (unsigned r = 0; r < 2; ++r, ++i) {
-            slot_buttons[i] = Button::create(slot_selection_window, (80 * c) + (5 * c) + 16, (34 * r) + (6 * r) + 16, 80, 32);
+            rect_t rect = grid_cell(SLOT_BUTTON_RECT, c, r, 5, 8);
+
+            slot_buttons[i] = Button::create(slot_selection_window, rect.x, rect.y, rect.w, rect.h);
             if (slot_buttons[i] == nullptr) {
                 err("Error while creating slot buttons");
             }
         }
     }
 
-    communication_status_label = TextBox::create(slot_selection_window, 14, 12, slot_selection_window->get_width() - 28, slot_selection_window->get_height() - 24);
+    communication_status_label = TextBox::create(slot_selection_window, COMMUNICATION_STATUS_RECT.x, COMMUNICATION_STATUS_RECT.y, COMMUNICATION_STATUS_RECT.w, COMMUNICATION_STATUS_RECT.h);
     if (communication_status_label == nullptr) {
         err("Error while creating communication status label");
     }
@@ -358,21 +684,11 @@ void init_main_view() {
     ->set_onrelease(switch_to_startup)
     ->set_event_queue(app->get_event_queue())
     ->set_message("x")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_bg_color(RED)
-    ->set_fg_color(BLACK)
-    ->set_pressed_bg_color(blend_color(RED, BLACK, 160))
-    ->set_pressed_fg_color(WHITE)
-    ->set_border_width(0)
-    ->set_border_radius(14);
+    ->set_style(&BACK_BUTTON_STYLE);
 
     main_title
     ->set_message("Canvas App")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_border_width(0)
-    ->set_border_radius(0);
+    ->set_style(&TITLE_STYLE);
 
     canvas
     ->set_event_queue(app->get_event_queue())
@@ -428,15 +744,13 @@ void init_main_view() {
     ->set_message("WiFi")
     ->set_onrelease(switch_to_connection)
     ->set_event_queue(app->get_event_queue())
-    ->get_style()
-    ->set_text_size(2);
+    ->set_style(&TOOL_BUTTON_STYLE);
 
     information_button
     ->set_message("Info")
     ->set_onrelease(switch_to_information)
     ->set_event_queue(app->get_event_queue())
-    ->get_style()
-    ->set_text_size(2);
+    ->set_style(&TOOL_BUTTON_STYLE);
 
     clear_button
     ->set_message("C")
@@ -500,10 +814,7 @@ void init_main_view() {
     communication_status_label
     ->set_event_queue(app->get_event_queue())
     ->set_onrelease(exit_slot_selection)
-    ->get_style()
-    ->set_text_size(2)
-    ->set_border_radius(0)
-    ->set_border_width(0);
+    ->set_style(&TITLE_STYLE);
 
     tools_window->send_front(slot_selection_window, 0);
 
@@ -513,21 +824,27 @@ void init_main_view() {
     slot_selection_window->set_visibility(false);
     communication_status_label->clear();
     slot_selection_window->clear();
+
+    main_view->enable_spatial_index();
+    tools_window->enable_spatial_index();
+    slot_selection_window->enable_spatial_index();
+
+    return main_view;
 }
 
-void init_connection_view() {
+View *init_connection_view() {
 
     connection_view = View::create(app);
     if (connection_view == nullptr) {
         err("Error while creating connection view");
     }
 
-    connection_back_button = Button::create(connection_view, 3, 15 - 12, 24, 24);
+    connection_back_button = Button::create(connection_view, BACK_BUTTON_RECT.x, BACK_BUTTON_RECT.y, BACK_BUTTON_RECT.w, BACK_BUTTON_RECT.h);
     if (connection_back_button == nullptr) {
         err("Error while creating connection back button");
     }
 
-    connection_title = Label::create(connection_view, 30, 1, app->get_width() - 30 - 10, 27);
+    connection_title = Label::create(connection_view, TITLE_RECT.x, TITLE_RECT.y, TITLE_RECT.w, TITLE_RECT.h);
     if (connection_title == nullptr) {
         err("Error while creating connection title");
     }
@@ -537,84 +854,73 @@ void init_connection_view() {
         err("ERror while creating keyboard");
     }
 
-    connection_form_window = Window::create(connection_view, 5, 30, app->get_width() - 10, app->get_height() - 45);
+    connection_form_window = Window::create(connection_view, BODY_RECT.x, BODY_RECT.y, BODY_RECT.w, BODY_RECT.h);
     if (connection_form_window == nullptr) {
         err("Error while creating connection form window");
     }
 
-    ssid_label = Label::create(connection_form_window, 10, 10, connection_form_window->get_width() - 20, 30);
+    ssid_label = Label::create(connection_form_window, SSID_LABEL_RECT.x, SSID_LABEL_RECT.y, SSID_LABEL_RECT.w, SSID_LABEL_RECT.h);
     if (ssid_label == nullptr) {
         err("Error while creating ssid label");
     }
-    ssid_box = TextBox::create(connection_form_window, 10, 47 - 4, connection_form_window->get_width() - 20, 34);
+    ssid_box = TextBox::create(connection_form_window, SSID_BOX_RECT.x, SSID_BOX_RECT.y, SSID_BOX_RECT.w, SSID_BOX_RECT.h);
     if (ssid_box == nullptr) {
         err("Error while creating ssid box");
     }
 
-    pass_label = Label::create(connection_form_window, 10, 90, connection_form_window->get_width() - 20, 30);
+    pass_label = Label::create(connection_form_window, PASS_LABEL_RECT.x, PASS_LABEL_RECT.y, PASS_LABEL_RECT.w, PASS_LABEL_RECT.h);
     if (pass_label == nullptr) {
         err("Error while creating pass_label");
     }
-    pass_box = TextBox::create(connection_form_window, 10, 127 - 4, connection_form_window->get_width() - 20, 34);
+    pass_box = TextBox::create(connection_form_window, PASS_BOX_RECT.x, PASS_BOX_RECT.y, PASS_BOX_RECT.w, PASS_BOX_RECT.h);
     if (pass_box == nullptr) {
         err("Error while creating pass box");
     }
 
-    addr_label = Label::create(connection_form_window, 10, 170, connection_form_window->get_width() - 20, 30);
+    addr_label = Label::create(connection_form_window, ADDR_LABEL_RECT.x, ADDR_LABEL_RECT.y, ADDR_LABEL_RECT.w, ADDR_LABEL_RECT.h);
     if (addr_label == nullptr) {
         err("Error while creating addr label");
     }
-    addr_box = TextBox::create(connection_form_window, 10, 207 - 4, connection_form_window->get_width() - 20, 34);
+    addr_box = TextBox::create(connection_form_window, ADDR_BOX_RECT.x, ADDR_BOX_RECT.y, ADDR_BOX_RECT.w, ADDR_BOX_RECT.h);
     if (addr_box == nullptr) {
         err("Error while creating addr box");
     }
 
-    connect_button = Button::create(connection_form_window, 10, 260, connection_form_window->get_width() - 20, 40);
+    connect_button = Button::create(connection_form_window, CONNECT_BUTTON_RECT.x, CONNECT_BUTTON_RECT.y, CONNECT_BUTTON_RECT.w, CONNECT_BUTTON_RECT.h);
     if (connect_button == nullptr) {
         err("Error while creating connect button");
     }
 
-    status_label = Label::create(connection_form_window, 10, connection_form_window->get_height() - 30 - 5, connection_form_window->get_width() - 20, 30);
+    status_label = Label::create(connection_form_window, STATUS_LABEL_RECT.x, STATUS_LABEL_RECT.y, STATUS_LABEL_RECT.w, STATUS_LABEL_RECT.h);
     if (status_label == nullptr) {
         err("Error while creating status label");
     }
 
     connection_back_button
-    ->set_onrelease(switch_to_startup)
+    ->set_onrelease(switch_back)
     ->set_event_queue(app->get_event_queue())
     ->set_message("x")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_bg_color(RED)
-    ->set_fg_color(BLACK)
-    ->set_pressed_bg_color(blend_color(RED, BLACK, 160))
-    ->set_pressed_fg_color(WHITE)
-    ->set_border_width(0)
-    ->set_border_radius(14);
+    ->set_style(&BACK_BUTTON_STYLE);
 
     connection_title
     ->set_message("Manage Connection")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_border_width(0)
-    ->set_border_radius(0);
+    ->set_style(&TITLE_STYLE);
 
     keyboard
     ->set_event_queue(app->get_event_queue())
     ->set_visibility(false);
     keyboard->clear();
 
+    connection_view->enable_spatial_index();
+    connection_form_window->enable_spatial_index();
+
     connection_form_window
     ->get_style()
     ->set_border_radius(3);
 
     ssid_label
     ->set_message("WiFi SSID:")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::LEFT_ALIGN)
-    ->set_border_radius(0)
-    ->set_border_width(0);
+    ->set_style(&FORM_LABEL_STYLE);
 
     ssid_box
     ->set_event_queue(app->get_event_queue())
@@ -623,20 +929,11 @@ void init_connection_view() {
 #ifdef DEFAULT_SECRET_SSID
     ->set_message(DEFAULT_SECRET_SSID)
 #endif
-    ->get_style()
-    ->set_text_size(2)
-    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::LEFT_ALIGN)
-    ->set_border_radius(2)
-    ->set_border_width(2)
-    ->set_bg_color(blend_color(BLACK, BLUE, 18));
+    ->set_style(&FORM_BOX_STYLE);
 
     pass_label
     ->set_message("WiFi Password:")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::LEFT_ALIGN)
-    ->set_border_radius(0)
-    ->set_border_width(0);
+    ->set_style(&FORM_LABEL_STYLE);
 
     pass_box
     ->set_event_queue(app->get_event_queue())
@@ -645,20 +942,11 @@ void init_connection_view() {
 #ifdef DEFAULT_SECRET_PASS
     ->set_message(DEFAULT_SECRET_PASS)
 #endif
-    ->get_style()
-    ->set_text_size(2)
-    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::LEFT_ALIGN)
-    ->set_border_radius(2)
-    ->set_border_width(2)
-    ->set_bg_color(blend_color(BLACK, BLUE, 18));
+    ->set_style(&FORM_BOX_STYLE);
 
     addr_label
     ->set_message("Server IP:port")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::LEFT_ALIGN)
-    ->set_border_radius(0)
-    ->set_border_width(0);
+    ->set_style(&FORM_LABEL_STYLE);
 
     addr_box
     ->set_event_queue(app->get_event_queue())
@@ -667,12 +955,7 @@ void init_connection_view() {
 #ifdef DEFAULT_SERVER_ADDR
     ->set_message(DEFAULT_SERVER_ADDR)
 #endif
-    ->get_style()
-    ->set_text_size(2)
-    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::LEFT_ALIGN)
-    ->set_border_radius(2)
-    ->set_border_width(2)
-    ->set_bg_color(blend_color(BLACK, BLUE, 18));
+    ->set_style(&FORM_BOX_STYLE);
 
     connect_button
     ->set_message("Connect")
@@ -706,78 +989,70 @@ void init_connection_view() {
             ->set_fg_color(RED);
         }
     }
+
+    return connection_view;
 }
 
-void init_information_view() {
+View *init_information_view() {
 
     information_view = View::create(app);
     if (information_view == nullptr) {
         err("Error while creating information view");
     }
 
-    information_back_button = Button::create(information_view, 3, 15 - 12, 24, 24);
+    information_back_button = Button::create(information_view, BACK_BUTTON_RECT.x, BACK_BUTTON_RECT.y, BACK_BUTTON_RECT.w, BACK_BUTTON_RECT.h);
     if (information_back_button == nullptr) {
         err("Error while creating information back button");
     }
 
-    information_title = Label::create(information_view, 30, 3, app->get_width() - 30 - 10, 25);
+    information_title = Label::create(information_view, INFORMATION_TITLE_RECT.x, INFORMATION_TITLE_RECT.y, INFORMATION_TITLE_RECT.w, INFORMATION_TITLE_RECT.h);
     if (information_title == nullptr) {
         err("Error while creating information title");
     }
 
-    information_form_window = Window::create(information_view, 5, 30, app->get_width() - 10, app->get_height() - 45);
+    information_form_window = Window::create(information_view, BODY_RECT.x, BODY_RECT.y, BODY_RECT.w, BODY_RECT.h);
     if (information_form_window == nullptr) {
         err("Error while creating information form window");
     }
 
-    ssid_readonly_label = Label::create(information_form_window, 12, 20, (information_form_window->get_width() - 24) / 2 - 30, 35);
+    ssid_readonly_label = Label::create(information_form_window, SSID_READONLY_LABEL_RECT.x, SSID_READONLY_LABEL_RECT.y, SSID_READONLY_LABEL_RECT.w, SSID_READONLY_LABEL_RECT.h);
     if (ssid_readonly_label == nullptr) {
         err("Error while creating ssid readonly label");
     }
 
-    ssid_readonly_box = Label::create(information_form_window, ssid_readonly_label->get_x() + ssid_readonly_label->get_width() - 1, ssid_readonly_label->get_y(), information_form_window->get_width() - ssid_readonly_label->get_x() - ssid_readonly_label->get_width() - 12, 35);
+    ssid_readonly_box = Label::create(information_form_window, SSID_READONLY_BOX_RECT.x, SSID_READONLY_BOX_RECT.y, SSID_READONLY_BOX_RECT.w, SSID_READONLY_BOX_RECT.h);
     if (ssid_readonly_box == nullptr) {
         err("Error while creating ssid readonly label");
     }
 
-    ip_addr_label = Label::create(information_form_window, ssid_readonly_label->get_x(), ssid_readonly_box->get_y() + ssid_readonly_box->get_height() - 1, ssid_readonly_label->get_width(), ssid_readonly_label->get_height());
+    ip_addr_label = Label::create(information_form_window, IP_ADDR_LABEL_RECT.x, IP_ADDR_LABEL_RECT.y, IP_ADDR_LABEL_RECT.w, IP_ADDR_LABEL_RECT.h);
     if (ip_addr_label == nullptr) {
         err("Error while creating ssid readonly label");
     }
 
-    ip_addr_box = Label::create(information_form_window, ssid_readonly_box->get_x(), ip_addr_label->get_y(), ssid_readonly_box->get_width(), ssid_readonly_box->get_height());
+    ip_addr_box = Label::create(information_form_window, IP_ADDR_BOX_RECT.x, IP_ADDR_BOX_RECT.y, IP_ADDR_BOX_RECT.w, IP_ADDR_BOX_RECT.h);
     if (ip_addr_box == nullptr) {
         err("Error while creating ssid readonly label");
     }
 
-    dumblebots_qrcode = Bitmap::create(information_form_window, qrcode_bmp, (information_form_window->get_width() - 135) / 2, information_form_window->get_height() - 135 - 30, 135, 135);
+    dumblebots_qrcode = Bitmap::create(information_form_window, &qrcode_bmp, QRCODE_RECT.x, QRCODE_RECT.y);
     if (dumblebots_qrcode == nullptr) {
         err("Error while creating dumblebots qrcode");
     }
-    dumblebots_website_label = Label::create(information_form_window, 10, information_form_window->get_height() - 25, information_form_window->get_width() - 20, 20);
+    dumblebots_website_label = Label::create(information_form_window, WEBSITE_LABEL_RECT.x, WEBSITE_LABEL_RECT.y, WEBSITE_LABEL_RECT.w, WEBSITE_LABEL_RECT.h);
     if (dumblebots_website_label == nullptr) {
         err("Error while creating dumblebots website label");
     }
 
     information_back_button
-    ->set_onrelease(switch_to_startup)
+    ->set_onrelease(switch_back)
     ->set_event_queue(app->get_event_queue())
     ->set_message("x")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_bg_color(RED)
-    ->set_fg_color(BLACK)
-    ->set_pressed_bg_color(blend_color(RED, BLACK, 160))
-    ->set_pressed_fg_color(WHITE)
-    ->set_border_width(0)
-    ->set_border_radius(14);
+    ->set_style(&BACK_BUTTON_STYLE);
 
     information_title
     ->set_message("Information")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_border_width(0)
-    ->set_border_radius(0);
+    ->set_style(&TITLE_STYLE);
 
     information_form_window
     ->get_style()
@@ -785,33 +1060,17 @@ void init_information_view() {
 
     ssid_readonly_label
     ->set_message("WiFi SSID ")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::RIGHT_ALIGN)
-    ->set_border_radius(0)
-    ->set_border_width(1);
+    ->set_style(&READONLY_LABEL_STYLE);
 
     ssid_readonly_box
-    ->get_style()
-    ->set_text_size(2)
-    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::CENTER_ALIGN)
-    ->set_border_radius(0)
-    ->set_border_width(1);
+    ->set_style(&READONLY_BOX_STYLE);
 
     ip_addr_label
     ->set_message("IP Address ")
-    ->get_style()
-    ->set_text_size(2)
-    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::RIGHT_ALIGN)
-    ->set_border_radius(0)
-    ->set_border_width(1);
+    ->set_style(&READONLY_LABEL_STYLE);
 
     ip_addr_box
-    ->get_style()
-    ->set_text_size(2)
-    ->set_horizontal_alignment(LabelStyle::HorizontalAlignment::CENTER_ALIGN)
-    ->set_border_radius(0)
-    ->set_border_width(1);
+    ->set_style(&READONLY_BOX_STYLE);
 
     dumblebots_website_label
     ->set_message("Powered by https://dumblebots.com")
@@ -821,20 +1080,24 @@ void init_information_view() {
     ->set_border_width(0);
 
     information_form_window->send_back(dumblebots_qrcode, 100);
+
+    return information_view;
 }
 
 /* ----- Start of Callback functions ----- */
 
 void switch_to_startup(unsigned *args) {
-    connection_back_button->set_onrelease(switch_to_startup);
-    information_back_button->set_onrelease(switch_to_startup);
-    app->make_active_view(startup_view);
+    back_target = switch_to_startup;
+    app->make_active_view(startup_view_id);
 }
 
 void switch_to_connection(unsigned *args) {
 
     signed status = WiFi.status();
 
+    // the widgets of a view only exist once it has been built
+    app->get_view(connection_view_id);
+
     if (status == WL_CONNECTED) {
         status_label
         ->set_message("CONNECTED")
@@ -849,7 +1112,7 @@ void switch_to_connection(unsigned *args) {
     }
 
     keyboard->set_visibility(false);
-    app->make_active_view(connection_view);
+    app->make_active_view(connection_view_id);
 }
 
 void switch_to_information(unsigned *args) {
@@ -857,12 +1120,15 @@ void switch_to_information(unsigned *args) {
     signed status = WiFi.status();
     char buffer[64];
 
+    app->get_view(information_view_id);
+
     if (status == WL_CONNECTED) {
 
-        ssid_box->get_message().toCharArray(buffer, sizeof(buffer) / sizeof(buffer[0]), 0);
+        // the status can report a connection before the connection view has been built (e.g. after a reset of the board)
+        app->get_view(connection_view_id);
 
         ssid_readonly_box
-        ->set_message(buffer)
+        ->set_message(ssid_box->get_message())
         ->get_style()
         ->set_fg_color(WHITE);
 
@@ -886,15 +1152,19 @@ void switch_to_information(unsigned *args) {
         ->set_fg_color(RED);
     }
 
-    app->make_active_view(information_view);
+    app->make_active_view(information_view_id);
 }
 
 void switch_to_main(unsigned *args) {
+    app->get_view(main_view_id);
     canvas->set_pen_color(RED);
     size_selector->set_color(RED);
-    connection_back_button->set_onrelease(switch_to_main);
-    information_back_button->set_onrelease(switch_to_main);
-    app->make_active_view(main_view);
+    back_target = switch_to_main;
+    app->make_active_view(main_view_id);
+}
+
+void switch_back(unsigned *args) {
+    back_target(args);
 }
 
 void select_color_cb(unsigned *args) {
@@ -907,6 +1177,12 @@ void select_pen_size_cb(unsigned *args) {
 }
 
 void clear_button_cb(unsigned *args) {
+
+    // a press queued before the transfer disabled the button must not rewrite the rows being transferred
+    if (app->is_task_running(transfer_task)) {
+        return;
+    }
+
     canvas->clear_canvas();
 }
 
@@ -929,16 +1205,52 @@ void exit_slot_selection(unsigned *args) {
 
 void slot_selection_cb(unsigned *args) {
 
+    // only one transfer may be in progress at a time
+    if (app->is_task_running(transfer_task)) {
+        return;
+    }
+
+    // the slot buttons' arguments change when the selection is re-opened, so the transfer works on a copy
+    transfer_args = *(slot_button_args_t *)args;
+
+    canvas->set_args((unsigned *)transfer_args.caller);
+    if (app->start_task(transfer_task, (unsigned *)&transfer_args)) {
+        set_transfer_controls(false);
+    }
+}
+
+task_status_t transfer_task(task_t *task, unsigned *args) {
+
     slot_button_args_t *info = (slot_button_args_t *)args;
+    task_status_t status;
 
-    if (info->caller == save_button) {
-        canvas->set_args((unsigned *)info->caller);
-        canvas->save_to_server(info->number);
+    // the transfer draws on and reads from the screen under the canvas, so it is abandoned if the main view is not shown
+    if (app->get_active_view() != main_view) {
+        canvas->abort_transfer();
+        status = TASK_DONE;
+    }
+    else if (info->caller == save_button) {
+        status = canvas->save_to_server(task, info->number);
     }
     else {
-        canvas->set_args((unsigned *)info->caller);
-        canvas->load_from_server(info->number);
+        status = canvas->load_from_server(task, info->number);
     }
+
+    if (status == TASK_DONE) {
+        set_transfer_controls(true);
+    }
+
+    return status;
+}
+
+void set_transfer_controls(bool enabled) {
+
+    // leaving the main view or clearing the canvas would interfere with a transfer in progress
+
+    main_back_button->set_interactable(enabled);
+    connection_button->set_interactable(enabled);
+    information_button->set_interactable(enabled);
+    clear_button->set_interactable(enabled);
 }
 
 void server_connection_failure_cb(unsigned *args) {
@@ -1040,6 +1352,11 @@ void connect_cb(unsigned *args) {
 
     signed status = WL_IDLE_STATUS;
 
+    // a single chain of attempts runs at a time, since they share the count of attempts left
+    if (connect_timer != 0) {
+        return;
+    }
+
     if (WiFi.status() == WL_NO_MODULE) {
         status_label
         ->set_message("NO WIFI MODULE")
@@ -1054,7 +1371,7 @@ void connect_cb(unsigned *args) {
         ->get_style()
         ->set_fg_color(RED);
 
-        canvas->set_server_addr("", 0);
+        DrawableCanvas::set_server_addr("", 0);
         return;
     }
 
@@ -1065,12 +1382,9 @@ void connect_cb(unsigned *args) {
 
     keyboard->set_visibility(false);
 
-    //!
-    app
-    ->collect_dirty_widgets()
-    ->update_dirty_widgets();
-
-    app->push_event({try_connect, nullptr});
+    // wait for atleast one render phase, so that the status is visible before the first (blocking) attempt
+    wifi_attempts_left = MAX_WIFI_RETRY;
+    connect_timer = app->set_timeout(try_connect, nullptr, CONNECT_STATUS_DELAY);
 }
 
 bool verify_server() {
@@ -1084,13 +1398,15 @@ bool verify_server() {
 
     unsigned server_port;
 
-    addr_box->get_message().toCharArray(addr, sizeof(addr) / sizeof(addr[0]));
     addr_len = addr_box->get_message_len();
 
-    if (addr_len == 0) {
+    if (addr_len == 0 || addr_len >= sizeof(addr)) {
         return false;
     }
 
+    // the address is tokenized in place, so it must be copied out of the textbox
+    memcpy(addr, addr_box->get_message(), addr_len + 1);
+
     delim = strchr(addr, ':');
     if (delim == NULL
         || delim == addr
@@ -1157,36 +1473,31 @@ bool verify_server() {
 
     }
 
-    canvas->set_server_addr(ip, server_port);
+    DrawableCanvas::set_server_addr(ip, server_port);
     return true;
 }
 
 void try_connect(unsigned *args) {
 
-    constexpr static unsigned MAX_WIFI_RETRY = 2;
-
-    char ssid[17];
-    char pass[17];
-
-    ssid_box->get_message().toCharArray(ssid, sizeof(ssid) / sizeof(ssid[0]));
-    pass_box->get_message().toCharArray(pass, sizeof(pass) / sizeof(pass[0]));
-
-    signed status = WL_IDLE_STATUS;
-    unsigned attempts_left = MAX_WIFI_RETRY;
-
-    while (attempts_left--) {
+    constexpr static unsigned long WIFI_RETRY_DELAY = 250;
 
-        status = WiFi.begin(ssid, pass);
+    connect_timer = 0;
 
-        delay(250);
+    // each attempt still blocks inside `WiFi.begin`, only the time between attempts is free for input and redraws
+    if (WiFi.begin(ssid_box->get_message(), pass_box->get_message()) == WL_CONNECTED) {
 
-        if (status == WL_CONNECTED) {
+        status_label
+        ->set_message("CONNECTED")
+        ->get_style()
+        ->set_fg_color(GREEN);
 
-            status_label
-            ->set_message("CONNECTED")
-            ->get_style()
-            ->set_fg_color(GREEN);
+        return;
+    }
 
+    // retry from a timer rather than blocking, so that touch input and redraws continue between attempts
+    if (--wifi_attempts_left != 0) {
+        connect_timer = app->set_timeout(try_connect, nullptr, WIFI_RETRY_DELAY);
+        if (connect_timer != 0) {
             return;
         }
     }
@@ -1199,6 +1510,104 @@ void try_connect(unsigned *args) {
 
 /* ----- ----- */
 
+void calibrate_touchscreen() {
+
+    // targets are placed away from the edges and not on a line, so that the calibration is well conditioned
+
+    constexpr touch_point_t TARGETS[TouchCalibration::NUM_TARGETS] {
+        {DISPLAY_W / 10, DISPLAY_H / 10},
+        {(DISPLAY_W * 9) / 10, DISPLAY_H / 2},
+        {DISPLAY_W / 2, (DISPLAY_H * 9) / 10},
+    };
+
+    // the check target is not part of the fit, so a target that was touched off its mark shows up as an error on it
+
+    constexpr touch_point_t CHECK_TARGET {DISPLAY_W / 2, DISPLAY_H / 2};
+
+    touch_point_t raw[TouchCalibration::NUM_TARGETS];
+    touch_point_t raw_check;
+    touch_calibration_t calibration;
+
+    Serial.println("Calibrating touchscreen");
+
+    for (;;) {
+
+        for (unsigned idx = 0; idx < TouchCalibration::NUM_TARGETS; ++idx) {
+            draw_target(TARGETS[idx]);
+            wait_for_tap(&raw[idx]);
+        }
+
+        if (!TouchCalibration::compute(raw, TARGETS, &calibration)) {
+            Serial.println("Targets were not touched properly, retrying");
+            continue;
+        }
+
+        draw_target(CHECK_TARGET);
+        wait_for_tap(&raw_check);
+
+        if (TouchCalibration::verify(calibration, raw_check, CHECK_TARGET)) {
+            break;
+        }
+
+        Serial.println("Check target missed, retrying");
+    }
+
+    ts.set_calibration(calibration);
+    if (!TouchCalibration::save(calibration)) {
+        Serial.println("Could not store the calibration");
+    }
+
+    app->fill_rect(0, 0, DISPLAY_W, DISPLAY_H, BLACK);
+}
+
+void draw_target(const touch_point_t &target) {
+
+    constexpr unsigned TARGET_SIZE = 10;
+
+    app
+    ->fill_rect(0, 0, DISPLAY_W, DISPLAY_H, BLACK)
+    ->print("Touch the target", 64, DISPLAY_H / 2 - 40, 2, WHITE)
+    ->draw_line(target.x - TARGET_SIZE, target.y, target.x + TARGET_SIZE, target.y, WHITE)
+    ->draw_line(target.x, target.y - TARGET_SIZE, target.x, target.y + TARGET_SIZE, WHITE)
+    ->draw_circle(target.x, target.y, TARGET_SIZE / 2, RED);
+}
+
+void wait_for_tap(touch_point_t *raw) {
+
+    // the raw position is the (filtered) position just before the stylus is lifted, once it has settled on the target
+    // a touch that started before this was called is ignored, and the press and release are consumed so that they do not reach the widgets
+
+    unsigned x, y;
+    bool lifted {!ts.get_raw_position(&x, &y)};
+    bool touched {false};
+
+    for (;;) {
+
+        ts.read_screen();
+
+        while (ts.process_sample()) {
+
+            if (ts.get_raw_position(&x, &y)) {
+                if (lifted) {
+                    raw->x = x;
+                    raw->y = y;
+                    touched = true;
+                }
+            }
+            else if (!lifted) {
+                lifted = true;
+            }
+            else if (touched) {
+                ts.get_press(&x, &y);
+                ts.get_release(&x, &y);
+                return;
+            }
+        }
+
+        delay(4);
+    }
+}
+
 [[noreturn]]
 void err(const char msg[]) {
     Serial.println(msg);
@@ -0,0 +1,157 @@
+/**
+ * @file                    touchcalibration.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Definitions for members of `TouchCalibration` class as given in [touchcalibration.h](touchcalibration.h)
+ *
+ */
+
+#include "touchcalibration.h"
+
+#ifdef ARDUINO
+#include "EEPROM.h"
+#else
+#include "cstdio"
+#endif
+
+bool TouchCalibration::compute(const touch_point_t raw[NUM_TARGETS], const touch_point_t screen[NUM_TARGETS], touch_calibration_t *cal) {
+
+    // solve for the coefficients of each axis with Cramer's rule, using the third target as the origin
+    // the products are kept in 64 bits, since the coefficients are shifted before dividing
+
+    int64_t dx0 = raw[0].x - raw[2].x;
+    int64_t dy0 = raw[0].y - raw[2].y;
+    int64_t dx1 = raw[1].x - raw[2].x;
+    int64_t dy1 = raw[1].y - raw[2].y;
+
+    int64_t det = (dx0 * dy1) - (dx1 * dy0);
+
+    // targets touched (nearly) on a line, or all in one spot, leave the mapping dominated by the noise of the touches
+    if (within(det, MIN_DETERMINANT - 1)) {
+        return false;
+    }
+
+    int64_t sx0 = screen[0].x - screen[2].x;
+    int64_t sx1 = screen[1].x - screen[2].x;
+    int64_t sy0 = screen[0].y - screen[2].y;
+    int64_t sy1 = screen[1].y - screen[2].y;
+
+    int64_t a = (((sx0 * dy1) - (sx1 * dy0)) << FRAC_BITS) / det;
+    int64_t b = (((dx0 * sx1) - (dx1 * sx0)) << FRAC_BITS) / det;
+    int64_t d = (((sy0 * dy1) - (sy1 * dy0)) << FRAC_BITS) / det;
+    int64_t e = (((dx0 * sy1) - (dx1 * sy0)) << FRAC_BITS) / det;
+
+    int64_t c = ((int64_t)screen[2].x << FRAC_BITS) - (a * raw[2].x) - (b * raw[2].y);
+    int64_t f = ((int64_t)screen[2].y << FRAC_BITS) - (d * raw[2].x) - (e * raw[2].y);
+
+    // the coefficients are stored in 32 bits, and a mapping this far from any real panel means a target was missed
+    if (!within(a, MAX_SCALE) || !within(b, MAX_SCALE) || !within(d, MAX_SCALE) || !within(e, MAX_SCALE)) {
+        return false;
+    }
+    if (!within(c, MAX_OFFSET) || !within(f, MAX_OFFSET)) {
+        return false;
+    }
+
+    cal->a = a;
+    cal->b = b;
+    cal->c = c;
+    cal->d = d;
+    cal->e = e;
+    cal->f = f;
+
+    return true;
+}
+
+bool TouchCalibration::verify(const touch_calibration_t &cal, const touch_point_t &raw, const touch_point_t &screen) {
+
+    // the check target is touched by hand as well, so it is only expected to land close to itself
+
+    int32_t x;
+    int32_t y;
+
+    apply(cal, raw.x, raw.y, &x, &y);
+
+    return within(x - screen.x, MAX_CHECK_ERROR) && within(y - screen.y, MAX_CHECK_ERROR);
+}
+
+touch_calibration_t TouchCalibration::from_bounds(unsigned x_begin, unsigned x_end, unsigned y_begin, unsigned y_end, unsigned width, unsigned height) {
+
+    touch_calibration_t cal;
+
+    cal.a = ((int32_t)(width - 1) << FRAC_BITS) / (int32_t)(x_end - x_begin);
+    cal.b = 0;
+    cal.c = -cal.a * (int32_t)x_begin;
+
+    // Y-coordinate is normally flipped
+    cal.d = 0;
+    cal.e = -((int32_t)(height - 1) << FRAC_BITS) / (int32_t)(y_end - y_begin);
+    cal.f = ((int32_t)(height - 1) << FRAC_BITS) - (cal.e * (int32_t)y_begin);
+
+    return cal;
+}
+
+bool TouchCalibration::load(touch_calibration_t *cal) {
+
+    record_t record;
+
+#ifdef ARDUINO
+
+    EEPROM.get(TOUCH_CALIBRATION_ADDRESS, record);
+
+#else
+
+    FILE *file = fopen(TOUCH_CALIBRATION_FILE, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    size_t count = fread(&record, sizeof(record), 1, file);
+    fclose(file);
+
+    if (count != 1) {
+        return false;
+    }
+
+#endif
+
+    if (record.magic != MAGIC || record.checksum != checksum_of(record.cal)) {
+        return false;
+    }
+
+    *cal = record.cal;
+    return true;
+}
+
+bool TouchCalibration::save(const touch_calibration_t &cal) {
+
+    record_t record {MAGIC, cal, checksum_of(cal)};
+
+#ifdef ARDUINO
+
+    // `put` only writes the bytes that changed, so saving the same calibration again does not wear the flash
+    EEPROM.put(TOUCH_CALIBRATION_ADDRESS, record);
+    return true;
+
+#else
+
+    FILE *file = fopen(TOUCH_CALIBRATION_FILE, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    size_t count = fwrite(&record, sizeof(record), 1, file);
+    return (fclose(file) == 0) && (count == 1);
+
+#endif
+}
+
+uint32_t TouchCalibration::checksum_of(const touch_calibration_t &cal) {
+
+    const int32_t words[] {cal.a, cal.b, cal.c, cal.d, cal.e, cal.f};
+    uint32_t sum {MAGIC};
+
+    for (int32_t word : words) {
+        sum = (sum << 5 | sum >> 27) ^ (uint32_t)word;
+    }
+
+    return sum;
+}
@@ -7,17 +7,35 @@
 
 #include "touchscreen_driver.h"
 
+#include "buslock.h"
+
 Touchscreen::Touchscreen(int xp, int yp, int xm, int ym)
     : xp {xp}
     , yp {yp}
     , xm {xm}
     , ym {ym}
     , ts(xp, yp, xm, ym, 300)
+    , calibration {TouchCalibration::from_bounds(XBEGIN, XEND, YBEGIN, YEND, width, height)}
 {}
 
 void Touchscreen::set_dimensions(unsigned new_width, unsigned new_height) {
+
     width = new_width;
     height = new_height;
+
+    // until the touchscreen is calibrated, the range of raw coordinates is mapped onto the whole screen
+    if (!calibrated) {
+        calibration = TouchCalibration::from_bounds(XBEGIN, XEND, YBEGIN, YEND, width, height);
+    }
+}
+
+void Touchscreen::set_calibration(const touch_calibration_t &new_calibration) {
+    calibration = new_calibration;
+    calibrated = true;
+}
+
+const touch_calibration_t &Touchscreen::get_calibration() const {
+    return calibration;
 }
 
 void Touchscreen::set_pressure_bounds(unsigned new_pressure_lo, unsigned new_pressure_hi) {
@@ -69,26 +87,103 @@ bool Touchscreen::get_stylus_position(unsigned *x, unsigned *y) {
     return true;
 }
 
+bool Touchscreen::get_stylus_moved() const {
+    return is_pressed && has_moved;
+}
+
+uint32_t Touchscreen::get_sample_time() const { return sample_time; }
+
+bool Touchscreen::get_raw_position(unsigned *x, unsigned *y) const {
+
+    if (!is_pressed) {
+        return false;
+    }
+
+    *x = raw_x;
+    *y = raw_y;
+    return true;
+}
+
+void Touchscreen::report_filter(Print *out) const {
+    TouchFilter::report(out, sample_rate);
+}
+
+bool Touchscreen::begin_sampling(float rate_hz) {
+
+#ifdef ARDUINO
+
+    // samples are only collected by the timer when it could be started, otherwise `read_screen` keeps polling
+
+    uint8_t type;
+    int8_t channel = FspTimer::get_available_timer(type);
+
+    if (channel < 0) {
+        return false;
+    }
+
+    if (!timer.begin(TIMER_MODE_PERIODIC, type, channel, rate_hz, 0.0f, on_timer, this)) {
+        return false;
+    }
+    if (!timer.setup_overflow_irq() || !timer.open() || !timer.start()) {
+        return false;
+    }
+
+    sampling = true;
+    sample_rate = rate_hz;
+    return true;
+
+#else
+
+    (void)rate_hz;
+    return false;
+
+#endif
+}
+
+void Touchscreen::set_sample_source(sample_source_t new_source) {
+    source = new_source;
+}
+
 void Touchscreen::read_screen() {
 
-    // measure the current state of the screen and update the events accordingly
-    // reset the pins to be digital outputs on completion
+    // while the timer is running, it is the only producer of samples
+
+    if (sampling) {
+        return;
+    }
+
+    collect_sample();
+}
 
+bool Touchscreen::process_sample() {
+
+    // take the oldest sample, filter its coordinates and update the events accordingly
+    // the filter starts over with every touch, so that a new stroke is not pulled towards the end of the last one
+
+    touch_sample_t sample;
     unsigned x;
     unsigned y;
     bool is_pressed_new {false};
 
-    p = ts.getPoint();
-    if (pressure_lo <= p.z && p.z <= pressure_hi) {
+    if (!samples.pop(&sample)) {
+        return false;
+    }
+
+    sample_time = sample.t;
+
+    if (pressure_lo <= sample.z && sample.z <= pressure_hi) {
+
+        has_moved = filter.apply(&sample.x, &sample.y);
 
-        x = p.x;
-        y = p.y;
+        x = raw_x = sample.x;
+        y = raw_y = sample.y;
         convert(&x, &y);
         is_pressed_new = true;
     }
 
     if (!is_pressed_new && is_pressed) { // the screen has been released
 
+        filter.reset();
         is_pressed = false;
         release_available = true;
 
@@ -114,9 +209,72 @@ void Touchscreen::read_screen() {
         cur_y = y;
     }
 
+    return true;
+}
+
+unsigned Touchscreen::get_pending() const { return samples.size(); }
+
+unsigned Touchscreen::get_dropped() const { return samples.get_dropped(); }
+
+unsigned Touchscreen::get_skipped() const { return skipped; }
+
+void Touchscreen::collect_sample() {
+
+    // only the first sample after the stylus is lifted is kept, so that the buffer is not filled while the screen is idle
+    // the flag is only updated once the sample is in the buffer, so that a dropped release is retried with the next sample
+
+    touch_sample_t sample;
+    bool touched;
+
+    if (!take_sample(&sample)) {
+        return;
+    }
+
+    touched = (pressure_lo <= sample.z && sample.z <= pressure_hi);
+    if (!touched && !last_touched) {
+        return;
+    }
+
+    if (samples.push(sample)) {
+        last_touched = touched;
+    }
+}
+
+bool Touchscreen::take_sample(touch_sample_t *sample) {
+
+    // measure the current state of the screen (or ask the simulated screen)
+    // reset the pins to be digital outputs on completion
+
+    if (source != nullptr) {
+        return source(sample);
+    }
+
+    p = ts.getPoint();
     reset_pin_functions();
+
+    sample->x = p.x;
+    sample->y = p.y;
+    sample->z = p.z;
+    sample->t = micros();
+
+    return true;
 }
 
+#ifdef ARDUINO
+void Touchscreen::on_timer(timer_callback_args_t *args) {
+
+    // the touchscreen shares its pins with the display, so nothing can be measured while a primitive is drawing
+
+    Touchscreen *self = (Touchscreen *)args->p_context;
+
+    if (BusLock::is_held()) {
+        self->skipped = self->skipped + 1;
+        return;
+    }
+
+    self->collect_sample();
+}
+#endif
 
 void Touchscreen::reset_pin_functions() {
     pinMode(xp, OUTPUT);
@@ -127,9 +285,11 @@ void Touchscreen::reset_pin_functions() {
 
 void Touchscreen::convert(unsigned *x, unsigned *y) {
 
-    *x = constrain(*x, XBEGIN, XEND);
-    *y = constrain(*y, YBEGIN, YEND);
+    int32_t px;
+    int32_t py;
+
+    TouchCalibration::apply(calibration, *x, *y, &px, &py);
 
-    *x = map(*x, XBEGIN, XEND, 0, width - 1);
-    *y = map(*y, YBEGIN, YEND, height - 1, 0); // Y-coordinate is normally flipped
+    *x = constrain(px, 0, (int32_t)width - 1);
+    *y = constrain(py, 0, (int32_t)height - 1);
 }
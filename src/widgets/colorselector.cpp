@@ -6,6 +6,7 @@
  */
 
 #include "widgets/colorselector.h"
+#include "profiler.h"
 
 ColorSelector::ColorSelector(Frame *parent, unsigned x, unsigned y)
     : parent {parent}
@@ -16,7 +17,7 @@ ColorSelector::ColorSelector(Frame *parent, unsigned x, unsigned y)
 {}
 
 ColorSelector *ColorSelector::create(Frame *parent, unsigned x, unsigned y) {
-    ColorSelector *colorselector = new (std::nothrow) ColorSelector(parent, x, y);
+    ColorSelector *colorselector = new (std::nothrow, TYPE_NAME) ColorSelector(parent, x, y);
     if (colorselector != nullptr) {
         parent->add_child(colorselector);
     }
@@ -65,6 +66,8 @@ void ColorSelector::set_visibility_changed() { visibility_changed = true; }
 
 void ColorSelector::draw() {
 
+    PROFILE_ZONE(PROFILE_DRAW_COLOR_SELECTOR);
+
     unsigned x, y;
 
     dirty = false;
@@ -140,15 +143,6 @@ bool ColorSelector::propagate_press(unsigned x, unsigned y) {
         return true;
     }
 
-    {
-        unsigned cur_epoch = millis();
-        if ((cur_epoch - last_press_epoch) < DEBOUNCE_THRESH) {
-            return true;
-        }
-
-        last_press_epoch = cur_epoch;
-    }
-
     pressed = true;
 
     x -= widget_x;
@@ -231,6 +225,7 @@ void ColorSelector::set_visibility(bool new_visibility) {
     visibility_changed = true;
 
     visible = new_visibility;
+    parent->notify_visibility(this, new_visibility);
 }
 
 // InteractiveWidget overrides
@@ -6,10 +6,15 @@
  */
 
 #include "widgets/drawablecanvas.h"
+#include "profiler.h"
 
 static DrawableCanvas::Compressor::segment_t segments1[(DrawableCanvas::DRAWABLE_W + 1) / 2];
 static DrawableCanvas::Compressor::segment_t segments2[DrawableCanvas::DRAWABLE_H][DrawableCanvas::MAX_INLINE_COMPRESSED_SEGMENTS];
 static WiFiClient sock;
+static DrawableCanvas::BufferedTCPStream stream;
+
+char DrawableCanvas::server_ip[16] {0};
+uint16_t DrawableCanvas::server_port {0};
 
 DrawableCanvas::DrawableCanvas(Frame *parent, unsigned x, unsigned y)
     : parent {parent}
@@ -24,7 +29,7 @@ DrawableCanvas::DrawableCanvas(Frame *parent, unsigned x, unsigned y)
 
 DrawableCanvas *DrawableCanvas::create(Frame *parent, unsigned x, unsigned y) {
 
-    DrawableCanvas *canvas = new (std::nothrow) DrawableCanvas(parent, x, y);
+    DrawableCanvas *canvas = new (std::nothrow, TYPE_NAME) DrawableCanvas(parent, x, y);
     if (canvas == nullptr) {
         return canvas;
     }
@@ -51,14 +56,12 @@ DrawableCanvas *DrawableCanvas::set_pen_color(uint16_t new_color) {
 }
 uint16_t DrawableCanvas::get_pen_color() const { return pen_color; }
 
-DrawableCanvas *DrawableCanvas::set_server_addr(const char *new_server_ip, const uint16_t new_server_port) {
+void DrawableCanvas::set_server_addr(const char *new_server_ip, const uint16_t new_server_port) {
 
     std::memset(server_ip, 0, sizeof(server_ip));
     std::strncpy(server_ip, new_server_ip, 16);
 
     server_port = new_server_port;
-
-    return this;
 }
 
 DrawableCanvas *DrawableCanvas::set_pen_size(uint16_t new_size) {
@@ -173,81 +176,88 @@ DrawableCanvas *DrawableCanvas::reset_event_queue() {
     return this;
 }
 
-bool DrawableCanvas::save_to_server(uint8_t slot) {
+task_status_t DrawableCanvas::save_to_server(task_t *task, uint8_t slot) {
 
     constexpr static unsigned MAX_SEGMENTS = (DRAWABLE_W + 1) / 2;
     uint8_t codes[DRAWABLE_W];
 
-    BufferedTCPStream client;
+    TASK_BEGIN(task);
 
-    if (strnlen(server_ip, 16) == 0 || !client.connect(&sock, server_ip, server_port)) {
+    if (strnlen(server_ip, 16) == 0 || !stream.connect(&sock, server_ip, server_port)) {
 
         if (event_queue != nullptr && on_connection_failure != nullptr) {
-            event_queue->push({on_connection_failure, args});
+            event_queue->push({on_connection_failure, args, InteractiveWidget::EVENT_PRIORITY_STATUS});
         }
-        return false;
+        TASK_EXIT(task);
     }
 
-    client.write((uint8_t *)"\x01", 1);
-    client.write((uint8_t *)&slot, 1);
-    client.write((uint8_t *)&DRAWABLE_H, 2);
-    client.write((uint8_t *)&DRAWABLE_W, 2);
+    stream.write((uint8_t *)"\x01", 1);
+    stream.write((uint8_t *)&slot, 1);
+    stream.write((uint8_t *)&DRAWABLE_H, 2);
+    stream.write((uint8_t *)&DRAWABLE_W, 2);
 
-    if (!client.flag) {
+    if (!stream.flag) {
         if (event_queue != nullptr && on_communication_failure != nullptr) {
-            event_queue->push({on_communication_failure, args});
+            event_queue->push({on_communication_failure, args, InteractiveWidget::EVENT_PRIORITY_STATUS});
         }
-        client.stop();
-        return false;
+        stream.stop();
+        TASK_EXIT(task);
     }
 
-    for (unsigned r = 0; r < DRAWABLE_H; ++r) {
+    for (transfer_row = 0; transfer_row < DRAWABLE_H; ++transfer_row) {
 
-        Compressor::decompress(&compressed_rows[r], codes, DRAWABLE_W);
-        for (unsigned c = compressed_rows[r].pixel_count; c < DRAWABLE_W; ++c) {
-            codes[c] = color_2_code(parent->get_at(widget_x + 1 + c, widget_y + 1 + r));
+        Compressor::decompress(&compressed_rows[transfer_row], codes, DRAWABLE_W);
+        for (unsigned c = compressed_rows[transfer_row].pixel_count; c < DRAWABLE_W; ++c) {
+            codes[c] = color_2_code(parent->get_at(widget_x + 1 + c, widget_y + 1 + transfer_row));
         }
         Compressor::compress(&cur_row, MAX_SEGMENTS, codes, DRAWABLE_W);
 
         if (cur_row.pixel_count == DRAWABLE_W) {
 
             uint8_t segment_count = cur_row.segment_count;
-            client.write(&segment_count, 1);
-            client.write((uint8_t *)(cur_row.segments), sizeof(Compressor::segment_t) * segment_count);
+            stream.write(&segment_count, 1);
+            stream.write((uint8_t *)(cur_row.segments), sizeof(Compressor::segment_t) * segment_count);
         }
         else {
 
-            client.write((uint8_t *)"\x00", 1);
-            client.write(codes, DRAWABLE_W);
+            stream.write((uint8_t *)"\x00", 1);
+            stream.write(codes, DRAWABLE_W);
         }
 
-        if (!client.flag) {
+        if (!stream.flag) {
             if (event_queue != nullptr && on_communication_failure != nullptr) {
-                event_queue->push({on_communication_failure, args});
+                event_queue->push({on_communication_failure, args, InteractiveWidget::EVENT_PRIORITY_STATUS});
             }
-            client.stop();
-            return false;
+            stream.stop();
+            TASK_EXIT(task);
+        }
+
+        if (transfer_row % TRANSFER_ROWS_PER_STEP == TRANSFER_ROWS_PER_STEP - 1) {
+            TASK_YIELD(task);
         }
     }
 
     if (event_queue != nullptr && on_success != nullptr) {
-        event_queue->push({on_success, args});
+        event_queue->push({on_success, args, InteractiveWidget::EVENT_PRIORITY_STATUS});
     }
 
-    client.stop();
-    return true;
+    stream.stop();
+
+    TASK_END(task);
 }
 
-bool DrawableCanvas::load_from_server(uint8_t slot) {
+task_status_t DrawableCanvas::load_from_server(task_t *task, uint8_t slot) {
 
     uint8_t codes[DRAWABLE_W];
 
+    TASK_BEGIN(task);
+
     if (strnlen(server_ip, 16) == 0 || !sock.connect(IPAddress(server_ip), server_port)) {
         if (event_queue != nullptr && on_connection_failure != nullptr) {
-            event_queue->push({on_connection_failure, args});
+            event_queue->push({on_connection_failure, args, InteractiveWidget::EVENT_PRIORITY_STATUS});
         }
         sock.stop();
-        return false;
+        TASK_EXIT(task);
     }
 
     sock.write((uint8_t *)"\x02", 1);
@@ -256,38 +266,56 @@ bool DrawableCanvas::load_from_server(uint8_t slot) {
     sock.write((uint8_t *)&DRAWABLE_W, 2);
     sock.write((uint8_t *)&DRAWABLE_W, 2);
 
-    for (unsigned r = 0; r < DRAWABLE_H; ++r) {
-
-        signed status = sock.readBytes(codes, DRAWABLE_W);
+    for (transfer_row = 0; transfer_row < DRAWABLE_H; ++transfer_row) {
 
-        if (status != DRAWABLE_W) {
+        if (sock.readBytes(codes, DRAWABLE_W) != DRAWABLE_W) {
             if (event_queue != nullptr && on_communication_failure != nullptr) {
-                event_queue->push({on_communication_failure, args});
+                event_queue->push({on_communication_failure, args, InteractiveWidget::EVENT_PRIORITY_STATUS});
             }
 
             sock.stop();
-            return false;
+            TASK_EXIT(task);
         }
 
-        if (r % 10 == 0) {
+        if (transfer_row % 10 == 0) {
             sock.write("\x00", 1);
         }
 
         for (unsigned c = 0; c < DRAWABLE_W; ++c) {
-            parent->set_at(widget_x + 1 + c, widget_y + 1 + r, code_2_color(codes[c]));
+            parent->set_at(widget_x + 1 + c, widget_y + 1 + transfer_row, code_2_color(codes[c]));
+        }
+        Compressor::compress(&compressed_rows[transfer_row], MAX_INLINE_COMPRESSED_SEGMENTS, codes, DRAWABLE_W);
+
+        if (transfer_row % TRANSFER_ROWS_PER_STEP == TRANSFER_ROWS_PER_STEP - 1) {
+            TASK_YIELD(task);
         }
-        Compressor::compress(&compressed_rows[r], MAX_INLINE_COMPRESSED_SEGMENTS, codes, DRAWABLE_W);
     }
 
     if (event_queue != nullptr && on_success != nullptr) {
-        event_queue->push({on_success, args});
+        event_queue->push({on_success, args, InteractiveWidget::EVENT_PRIORITY_STATUS});
     }
 
     sock.write("\x00", 1);
     sock.flush();
 
     sock.stop();
-    return true;
+
+    TASK_END(task);
+}
+
+DrawableCanvas *DrawableCanvas::abort_transfer() {
+
+    // the buffered bytes are dropped rather than flushed, so that the server sees an interrupted transfer
+
+    stream.size = 0;
+    stream.client = nullptr;
+    sock.stop();
+
+    if (event_queue != nullptr && on_communication_failure != nullptr) {
+        event_queue->push({on_communication_failure, args, InteractiveWidget::EVENT_PRIORITY_STATUS});
+    }
+
+    return this;
 }
 
 // BasicWidget overrides
@@ -311,6 +339,8 @@ void DrawableCanvas::set_visibility_changed() { visibility_changed = true; }
 
 void DrawableCanvas::draw() {
 
+    PROFILE_ZONE(PROFILE_DRAW_CANVAS);
+
     dirty = false;
     visibility_changed = false;
 
@@ -391,6 +421,7 @@ void DrawableCanvas::set_visibility(bool new_visibility) {
     dirty = true;
     visibility_changed = true;
     visible = new_visibility;
+    parent->notify_visibility(this, new_visibility);
 }
 
 void DrawableCanvas::reset_compressed() {
@@ -6,6 +6,7 @@
  */
 
 #include "widgets/pensizeselector.h"
+#include "profiler.h"
 
 PenSizeSelector::PenSizeSelector(Frame *parent, unsigned x, unsigned y)
     : parent {parent}
@@ -16,7 +17,7 @@ PenSizeSelector::PenSizeSelector(Frame *parent, unsigned x, unsigned y)
 {}
 
 PenSizeSelector *PenSizeSelector::create(Frame *parent, unsigned x, unsigned y) {
-    PenSizeSelector *pensizeselector = new (std::nothrow) PenSizeSelector(parent, x, y);
+    PenSizeSelector *pensizeselector = new (std::nothrow, TYPE_NAME) PenSizeSelector(parent, x, y);
     if (pensizeselector != nullptr) {
         parent->add_child(pensizeselector);
     }
@@ -87,6 +88,8 @@ void PenSizeSelector::set_visibility_changed() { visibility_changed = true; }
 
 void PenSizeSelector::draw() {
 
+    PROFILE_ZONE(PROFILE_DRAW_PEN_SIZE_SELECTOR);
+
     unsigned x, y, s;
 
     dirty = false;
@@ -245,6 +248,7 @@ void PenSizeSelector::set_visibility(bool new_visibility) {
     visibility_changed = true;
 
     visible = new_visibility;
+    parent->notify_visibility(this, new_visibility);
 }
 
 // InteractiveWidget overrides
@@ -0,0 +1,92 @@
+/**
+ * @file                    Adafruit_GFX.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Stand-in for the parts of the Adafruit GFX library used by the code under test on the host (env:native)
+ *
+ *                          `drawChar` renders custom fonts pixel by pixel in the same way as the library, so that tests can
+ *                          compare other ways of drawing text against it
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TEST_ADAFRUIT_GFX_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TEST_ADAFRUIT_GFX_H__
+
+#include "Arduino.h"
+
+#define PROGMEM
+
+/** Layout of a glyph in a custom font (same as the library) */
+typedef struct {
+    uint16_t bitmapOffset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+} GFXglyph;
+
+/** Layout of a custom font (same as the library) */
+typedef struct {
+    uint8_t *bitmap;
+    GFXglyph *glyph;
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance;
+} GFXfont;
+
+class Adafruit_GFX {
+
+protected:
+
+    int16_t _width;
+    int16_t _height;
+
+public:
+
+    Adafruit_GFX(int16_t w, int16_t h) : _width(w), _height(h) {}
+    virtual ~Adafruit_GFX() = default;
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void startWrite() {}
+    virtual void endWrite() {}
+
+    virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+
+    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+        for (int16_t i = 0; i < w; ++i) {
+            writePixel(x + i, y, color);
+        }
+    }
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    void setFont(const GFXfont *f) { font = f; }
+
+    /** Draw a glyph of the current font (custom fonts are always drawn with a transparent background) */
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+
+        const GFXglyph &glyph = font->glyph[c - font->first];
+        const uint8_t *bitmap = &font->bitmap[glyph.bitmapOffset];
+        unsigned bit = 0;
+
+        startWrite();
+
+        for (unsigned r = 0; r < glyph.height; ++r) {
+            for (unsigned col = 0; col < glyph.width; ++col, ++bit) {
+                if ((bitmap[bit >> 3] >> (7 - (bit & 7))) & 1) {
+                    writePixel(x + glyph.xOffset + col, y + glyph.yOffset + r, color);
+                }
+            }
+        }
+
+        endWrite();
+    }
+
+protected:
+
+    const GFXfont *font {nullptr};
+};
+
+#endif
@@ -0,0 +1,61 @@
+/**
+ * @file                    Arduino.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Stand-in for the parts of the Arduino core used by the code under test on the host (env:native)
+ *
+ *                          Time only advances when a test moves `host_micros` (or calls `delay`), so that every test is
+ *                          deterministic
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TEST_ARDUINO_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TEST_ARDUINO_H__
+
+#include "cstdint"
+#include "cstddef"
+#include "cstdio"
+#include "cstring"
+
+#define OUTPUT 1
+#define INPUT 0
+
+/** Current time of the host clock (in microseconds) */
+inline unsigned long host_micros {0};
+
+inline unsigned long micros() { return host_micros; }
+inline unsigned long millis() { return host_micros / 1000; }
+inline void delay(unsigned long ms) { host_micros += ms * 1000; }
+
+inline void pinMode(int, int) {}
+
+template <typename T, typename L>
+auto min(const T &a, const L &b) -> decltype((b < a) ? b : a) { return (b < a) ? b : a; }
+
+template <typename T, typename L>
+auto max(const T &a, const L &b) -> decltype((b < a) ? b : a) { return (a < b) ? b : a; }
+
+template <typename T, typename L, typename H>
+auto constrain(const T &x, const L &lo, const H &hi) -> decltype((x < lo) ? lo : ((x > hi) ? hi : x)) {
+    return (x < lo) ? lo : ((x > hi) ? hi : x);
+}
+
+/**
+ * @brief                   Output stream that prints to the standard output
+ *
+ */
+class Print {
+
+public:
+
+    size_t print(const char *s) { return printf("%s", s); }
+    size_t print(unsigned long v) { return printf("%lu", v); }
+    size_t print(long v) { return printf("%ld", v); }
+    size_t print(unsigned v) { return printf("%u", v); }
+    size_t print(int v) { return printf("%d", v); }
+
+    size_t println() { return printf("\n"); }
+    template <typename T>
+    size_t println(T v) { return print(v) + println(); }
+};
+
+#endif
@@ -0,0 +1,34 @@
+/**
+ * @file                    TouchScreen.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Stand-in for the Adafruit TouchScreen library on the host (env:native)
+ *
+ *                          Tests replace the touchscreen with `Touchscreen::set_sample_source`, so the panel itself is
+ *                          never measured
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TEST_TOUCHSCREEN_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TEST_TOUCHSCREEN_H__
+
+#include "Arduino.h"
+
+class TSPoint {
+
+public:
+
+    int16_t x {0};
+    int16_t y {0};
+    int16_t z {0};
+};
+
+class TouchScreen {
+
+public:
+
+    TouchScreen(uint8_t, uint8_t, uint8_t, uint8_t, uint16_t) {}
+
+    TSPoint getPoint() { return {}; }
+};
+
+#endif
@@ -0,0 +1,128 @@
+/**
+ * @file                    hostframe.h
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Declares the `HostFrame` class, which stands in for the app as the root of the widgets under test on
+ *                          the host (env:native)
+ *
+ */
+
+#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TEST_HOSTFRAME_H__
+#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_TEST_HOSTFRAME_H__
+
+#include "widgets/frame.h"
+#include "widgets/childlist.h"
+
+/**
+ * @brief                   Root frame that covers the whole display, passes events on to its children and draws nothing
+ *
+ */
+class HostFrame : public Frame {
+
+protected:
+
+    unsigned widget_w;
+    unsigned widget_h;
+
+    ChildList children;
+
+public:
+
+    HostFrame(unsigned width, unsigned height) : widget_w(width), widget_h(height) {}
+
+    ~HostFrame() {
+        for (BasicWidget *child : children) {
+            delete child;
+        }
+    }
+
+    // BasicWidget overrides
+
+    BasicWidget *get_parent() override { return nullptr; }
+
+    unsigned get_x() const override { return 0; }
+    unsigned get_y() const override { return 0; }
+    unsigned get_absolute_x() const override { return 0; }
+    unsigned get_absolute_y() const override { return 0; }
+    unsigned get_width() const override { return widget_w; }
+    unsigned get_height() const override { return widget_h; }
+
+    bool get_dirty() const override { return false; }
+    bool get_visibility_changed() const override { return false; }
+    void set_dirty() override {}
+    void set_visibility_changed() override {}
+
+    void draw() override {}
+    void clear() override {}
+
+    bool get_intersection(unsigned x, unsigned y) const override { return x <= widget_w && y <= widget_h; }
+    bool get_intersection(BasicWidget *other) const override { return true; }
+
+    bool propagate_press(unsigned x, unsigned y) override { return children.propagate_press(x, y); }
+    bool propagate_release(unsigned x, unsigned y) override { return children.propagate_release(x, y); }
+
+    bool get_visibility() const override { return true; }
+    void set_visibility(bool new_visibility) override {}
+
+    bool is_frame() const override { return true; }
+
+    // Frame overrides
+
+    HostFrame *add_child(BasicWidget *child) override {
+        children.push_back(child);
+        return this;
+    }
+
+    unsigned get_children_count() const override { return children.size(); }
+
+    HostFrame *send_front(BasicWidget *child, unsigned amt) override { return this; }
+    HostFrame *send_back(BasicWidget *child, unsigned amt) override { return this; }
+
+    HostFrame *enable_spatial_index() override {
+        children.enable_index(widget_w, widget_h);
+        return this;
+    }
+
+    void notify_visibility(BasicWidget *child, bool visible) override {
+        children.set_visibility(child, visible);
+    }
+
+    void collect_dirty_widgets(RingQueueInterface<BasicWidget *> *dirty_widgets) override {}
+    void collect_overlapped_widgets(BasicWidget *dirty, BasicWidget *child, RingQueueInterface<BasicWidget *> *overlapping_widgets) override {}
+    void collect_underlapped_widgets(BasicWidget *child, RingQueueInterface<BasicWidget *> *overlapping_widgets) override {}
+
+    // DrawableWidget overrides
+
+    HostFrame *set_at(unsigned x, unsigned y, uint16_t color) override { return this; }
+    uint16_t get_at(unsigned x, unsigned y) const override { return 0; }
+
+    HostFrame *draw_line(unsigned x0, unsigned y0, unsigned x1, unsigned y1, uint16_t color) override { return this; }
+    HostFrame *draw_rect(unsigned x, unsigned y, unsigned w, unsigned h, uint16_t color) override { return this; }
+    HostFrame *fill_rect(unsigned x, unsigned y, unsigned w, unsigned h, uint16_t color) override { return this; }
+    HostFrame *draw_round_rect(unsigned x, unsigned y, unsigned w, unsigned h, unsigned r, uint16_t color) override { return this; }
+    HostFrame *fill_round_rect(unsigned x, unsigned y, unsigned w, unsigned h, unsigned r, uint16_t color) override { return this; }
+    HostFrame *draw_circle(unsigned x, unsigned y, unsigned r, uint16_t color) override { return this; }
+    HostFrame *fill_circle(unsigned x, unsigned y, unsigned r, uint16_t color) override { return this; }
+
+    HostFrame *get_text_bounds(const char *text, unsigned text_size, unsigned x, unsigned y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) override {
+        *x1 = x;
+        *y1 = y;
+        *w = 0;
+        *h = 0;
+        return this;
+    }
+
+    HostFrame *set_font(const GFXfont *f) override { return this; }
+
+    HostFrame *print(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color) override { return this; }
+    HostFrame *print_uncached(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color) override { return this; }
+    HostFrame *print_opaque(const char *text, unsigned x, unsigned y, unsigned text_size, uint16_t fg_color, uint16_t bg_color) override { return this; }
+
+    HostFrame *draw_rgb_bitmap(unsigned x, unsigned y, const uint16_t *data, unsigned width, unsigned height) override { return this; }
+
+    HostFrame *begin_write_window(unsigned x, unsigned y, unsigned w, unsigned h) override { return this; }
+    HostFrame *write_colors(const uint16_t *colors, unsigned count) override { return this; }
+    HostFrame *write_color_run(uint16_t color, unsigned count) override { return this; }
+    HostFrame *end_write_window() override { return this; }
+};
+
+#endif
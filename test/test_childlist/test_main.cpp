@@ -0,0 +1,359 @@
+/**
+ * @file                    test_main.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Tests of the dispatch and overlap tests of the `ChildList` class with 200 children, comparing the
+ *                          mirrored bounding boxes and visibility against asking every child in turn (as the frames used to)
+ *
+ */
+
+#include "unity.h"
+
+#include "chrono"
+#include "random"
+
+#include "widgetpool.cpp"
+#include "widgets/childlist.cpp"
+
+/**
+ * @brief                   Widget with a fixed bounding box that counts how often its state is read
+ *
+ */
+static ChildList *children;
+
+class FakeWidget : public BasicWidget {
+
+public:
+
+    /** Number of calls to `get_dirty` and `get_visibility` on all fake widgets */
+    static unsigned long flag_reads;
+    /** Number of calls to `get_intersection` on all fake widgets */
+    static unsigned long intersection_tests;
+    /** Last fake widget that accepted a press */
+    static FakeWidget *last_pressed;
+
+    unsigned widget_x {0};
+    unsigned widget_y {0};
+    unsigned widget_w {0};
+    unsigned widget_h {0};
+
+    bool visible {true};
+    bool dirty {false};
+
+    void place(unsigned x, unsigned y, unsigned w, unsigned h) {
+        widget_x = x;
+        widget_y = y;
+        widget_w = w;
+        widget_h = h;
+    }
+
+    BasicWidget *get_parent() override { return nullptr; }
+
+    unsigned get_x() const override { return widget_x; }
+    unsigned get_y() const override { return widget_y; }
+    unsigned get_absolute_x() const override { return widget_x; }
+    unsigned get_absolute_y() const override { return widget_y; }
+    unsigned get_width() const override { return widget_w; }
+    unsigned get_height() const override { return widget_h; }
+
+    bool get_dirty() const override {
+        ++flag_reads;
+        return dirty;
+    }
+    bool get_visibility_changed() const override { return false; }
+    void set_dirty() override { dirty = true; }
+    void set_visibility_changed() override {}
+
+    void draw() override {}
+    void clear() override {}
+
+    bool get_intersection(unsigned x, unsigned y) const override {
+        return widget_x <= x && x <= widget_x + widget_w && widget_y <= y && y <= widget_y + widget_h;
+    }
+
+    bool get_intersection(BasicWidget *other) const override {
+
+        unsigned x0 = other->get_absolute_x();
+        unsigned y0 = other->get_absolute_y();
+
+        ++intersection_tests;
+        return x0 <= widget_x + widget_w && widget_x <= x0 + other->get_width()
+               && y0 <= widget_y + widget_h && widget_y <= y0 + other->get_height();
+    }
+
+    bool propagate_press(unsigned x, unsigned y) override {
+        last_pressed = this;
+        return true;
+    }
+    bool propagate_release(unsigned x, unsigned y) override { return true; }
+
+    bool get_visibility() const override {
+        ++flag_reads;
+        return visible;
+    }
+    void set_visibility(bool new_visibility) override {
+        visible = new_visibility;
+        children->set_visibility(this, new_visibility);
+    }
+};
+
+unsigned long FakeWidget::flag_reads {0};
+unsigned long FakeWidget::intersection_tests {0};
+FakeWidget *FakeWidget::last_pressed {nullptr};
+
+/** Number of children in the list (two layers of a 10x10 grid, well beyond `ChildList::MAX_INDEXED`) */
+constexpr unsigned NUM_CHILDREN = 200;
+/** Number of children in each layer */
+constexpr unsigned LAYER_SIZE = NUM_CHILDREN / 2;
+
+constexpr unsigned CELL_W = 32;
+constexpr unsigned CELL_H = 24;
+
+static FakeWidget widgets[NUM_CHILDREN];
+
+/**
+ * @brief                   Collect the overlapping children by asking every child in turn, as `View` and `Window` did before
+ *                          the bounding boxes were mirrored
+ *
+ */
+static void collect_by_asking(FakeWidget *dirty, RingQueueInterface<BasicWidget *> *overlapping_widgets) {
+
+    for (unsigned idx = NUM_CHILDREN; idx-- > 0; ) {
+
+        BasicWidget *current = (*children)[idx];
+
+        if (current->get_dirty() || !current->get_visibility()) {
+            continue;
+        }
+        if (current->get_intersection(dirty)) {
+            current->set_dirty();
+            overlapping_widgets->push(current);
+        }
+    }
+}
+
+static void clear_dirty() {
+    for (FakeWidget &widget : widgets) {
+        widget.dirty = false;
+    }
+}
+
+void setUp() {
+
+    // the front layer (lower Z-index) covers the same cells as the back layer, and every seventh child is hidden
+    for (unsigned idx = 0; idx < NUM_CHILDREN; ++idx) {
+
+        unsigned cell = idx % LAYER_SIZE;
+
+        widgets[idx].place((cell % 10) * CELL_W, (cell / 10) * CELL_H, CELL_W - 1, CELL_H - 1);
+        widgets[idx].visible = (idx % 7) != 0;
+        widgets[idx].dirty = false;
+    }
+
+    children = new ChildList();
+    for (FakeWidget &widget : widgets) {
+        children->push_back(&widget);
+    }
+}
+
+void tearDown() {
+    delete children;
+}
+
+/**
+ * @brief                   A press reaches the front-most visible child under it, and hidden children are skipped
+ *
+ */
+void test_press_reaches_front_visible() {
+
+    for (unsigned cell = 0; cell < LAYER_SIZE; ++cell) {
+
+        unsigned x = (cell % 10) * CELL_W + CELL_W / 2;
+        unsigned y = (cell / 10) * CELL_H + CELL_H / 2;
+
+        FakeWidget *front = &widgets[cell];
+        FakeWidget *back = &widgets[cell + LAYER_SIZE];
+        FakeWidget *expected = front->visible ? front : (back->visible ? back : nullptr);
+
+        FakeWidget::last_pressed = nullptr;
+
+        TEST_ASSERT_EQUAL(expected != nullptr, children->propagate_press(x, y));
+        TEST_ASSERT_TRUE(FakeWidget::last_pressed == expected);
+    }
+}
+
+/**
+ * @brief                   A child that is hidden or shown after it was added no longer receives presses, or receives them
+ *                          again, without the list asking it for its visibility
+ *
+ */
+void test_press_follows_visibility() {
+
+    unsigned x = CELL_W + CELL_W / 2;
+    unsigned y = CELL_H / 2;
+
+    FakeWidget *front = &widgets[1];
+    FakeWidget *back = &widgets[1 + LAYER_SIZE];
+
+    FakeWidget::flag_reads = 0;
+
+    TEST_ASSERT_TRUE(children->propagate_press(x, y));
+    TEST_ASSERT_TRUE(FakeWidget::last_pressed == front);
+
+    front->set_visibility(false);
+    TEST_ASSERT_TRUE(children->propagate_press(x, y));
+    TEST_ASSERT_TRUE(FakeWidget::last_pressed == back);
+
+    back->set_visibility(false);
+    TEST_ASSERT_FALSE(children->propagate_press(x, y));
+
+    front->set_visibility(true);
+    TEST_ASSERT_TRUE(children->propagate_press(x, y));
+    TEST_ASSERT_TRUE(FakeWidget::last_pressed == front);
+
+    TEST_ASSERT_EQUAL_UINT(0, FakeWidget::flag_reads);
+}
+
+/**
+ * @brief                   The mirrored bounding boxes collect the same children, in the same order, as asking every child
+ *
+ */
+void test_collect_matches_asking() {
+
+    std::mt19937 rng(46);
+    FakeWidget dirty;
+
+    for (unsigned round = 0; round < 500; ++round) {
+
+        dirty.place(rng() % 320, rng() % 240, 1 + rng() % 80, 1 + rng() % 80);
+
+        RingQueue<BasicWidget *, NUM_CHILDREN> expected;
+        RingQueue<BasicWidget *, NUM_CHILDREN> actual;
+
+        clear_dirty();
+        collect_by_asking(&dirty, &expected);
+
+        clear_dirty();
+        children->collect_overlapping(0, NUM_CHILDREN, dirty.widget_x, dirty.widget_y,
+                                      dirty.widget_x + dirty.widget_w, dirty.widget_y + dirty.widget_h, &actual);
+
+        TEST_ASSERT_EQUAL_UINT(expected.get_size(), actual.get_size());
+        while (expected.get_size() != 0) {
+            TEST_ASSERT_TRUE(expected.front() == actual.front());
+            expected.pop();
+            actual.pop();
+        }
+    }
+}
+
+/**
+ * @brief                   Measures the cost of collecting the children that overlap a small rectangle, and how many dirty
+ *                          flags are still read through virtual calls (the visibility is mirrored)
+ *
+ */
+void test_overlap_cost() {
+
+    using clock = std::chrono::steady_clock;
+
+    constexpr unsigned ROUNDS = 20000;
+
+    std::mt19937 rng(46);
+    FakeWidget rects[64];
+    unsigned long collected {0};
+
+    for (FakeWidget &rect : rects) {
+        rect.place(rng() % 320, rng() % 240, 40, 40);
+    }
+
+    FakeWidget::flag_reads = 0;
+    FakeWidget::intersection_tests = 0;
+
+    clock::time_point start = clock::now();
+    for (unsigned round = 0; round < ROUNDS; ++round) {
+
+        RingQueue<BasicWidget *, NUM_CHILDREN> queue;
+
+        clear_dirty();
+        collect_by_asking(&rects[round % 64], &queue);
+        collected += queue.get_size();
+    }
+    double asking_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / ROUNDS;
+
+    unsigned long asking_calls = FakeWidget::flag_reads + FakeWidget::intersection_tests;
+
+    FakeWidget::flag_reads = 0;
+    FakeWidget::intersection_tests = 0;
+
+    start = clock::now();
+    for (unsigned round = 0; round < ROUNDS; ++round) {
+
+        RingQueue<BasicWidget *, NUM_CHILDREN> queue;
+        FakeWidget &rect = rects[round % 64];
+
+        clear_dirty();
+        children->collect_overlapping(0, NUM_CHILDREN, rect.widget_x, rect.widget_y,
+                                      rect.widget_x + rect.widget_w, rect.widget_y + rect.widget_h, &queue);
+    }
+    double mirrored_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / ROUNDS;
+
+    unsigned long mirrored_calls = FakeWidget::flag_reads + FakeWidget::intersection_tests;
+
+    printf("asking every child: %.1f ns per collection (%.1f virtual calls)\n",
+           asking_ns, (double)asking_calls / ROUNDS);
+    printf("mirrored boxes: %.1f ns per collection (%.1f virtual calls, all dirty flag reads)\n",
+           mirrored_ns, (double)mirrored_calls / ROUNDS);
+    printf("children collected: %.1f per collection\n", (double)collected / ROUNDS);
+
+    // the dirty flag is only read for visible children whose box overlaps (one read each)
+    TEST_ASSERT_EQUAL_UINT(0, FakeWidget::intersection_tests);
+    TEST_ASSERT_EQUAL_UINT(collected, mirrored_calls);
+    TEST_ASSERT_TRUE(mirrored_calls * 10 < asking_calls);
+    TEST_ASSERT_LESS_THAN(asking_ns, mirrored_ns);
+}
+
+/**
+ * @brief                   Measures the cost of dispatching a press through 200 children (beyond the spatial index, so the
+ *                          boxes are scanned in Z-order)
+ *
+ */
+void test_press_cost() {
+
+    using clock = std::chrono::steady_clock;
+
+    constexpr unsigned ROUNDS = 200;
+
+    unsigned presses {0};
+    unsigned accepted {0};
+
+    // the cells further down the grid are covered by later children, so those presses scan most of the list
+    FakeWidget::flag_reads = 0;
+
+    clock::time_point start = clock::now();
+    for (unsigned round = 0; round < ROUNDS; ++round) {
+        for (unsigned y = 0; y < 240; y += 3) {
+            for (unsigned x = 0; x < 320; x += 3) {
+                accepted += children->propagate_press(x, y);
+                ++presses;
+            }
+        }
+    }
+    double press_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / presses;
+
+    printf("press: %.1f ns per press (%.2f flag reads, %u of %u accepted)\n",
+           press_ns, (double)FakeWidget::flag_reads / presses, accepted, presses);
+
+    // the visibility of the children under the press is read from the mirror, not from the children
+    TEST_ASSERT_EQUAL_UINT(0, FakeWidget::flag_reads);
+}
+
+int main() {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_press_reaches_front_visible);
+    RUN_TEST(test_press_follows_visibility);
+    RUN_TEST(test_collect_matches_asking);
+    RUN_TEST(test_overlap_cost);
+    RUN_TEST(test_press_cost);
+
+    return UNITY_END();
+}
@@ -0,0 +1,224 @@
+/**
+ * @file                    test_main.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Tests of the `GlyphCache` class, which compare the cached glyphs against the glyphs drawn pixel by
+ *                          pixel, and measure the hit rate while the shift key of the keyboard is toggled
+ *
+ */
+
+#include "unity.h"
+
+#include "glyphcache.cpp"
+
+#include "Fonts/PlusJakartaSans9pt7b.h"
+
+/** Font of the keys of the keyboard (text size 2) */
+static const GFXfont *const KEY_FONT = &PlusJakartaSans_SemiBold9pt7b;
+
+/** Labels of the keys in each shift position (mirrors `Keyboard::KEYBOARD_KEYS`, one key per character) */
+static const char *const KEY_LAYERS[3] {
+    "1234567890" "qwertyuiop" "asdfghjkl" "zxcvbnm" ",.",
+    "1234567890" "QWERTYUIOP" "ASDFGHJKL" "ZXCVBNM" ",.",
+    "1234567890" "+=/_<>[]{}" "@#$%^&*()" "-'\":;!?" ",.",
+};
+
+/**
+ * @brief                   Display that stores its pixels in RAM, and counts the calls made to draw them
+ *
+ */
+class FakeDisplay : public Adafruit_GFX {
+
+public:
+
+    constexpr static unsigned WIDTH = 320;
+    constexpr static unsigned HEIGHT = 240;
+
+    uint16_t pixels[HEIGHT][WIDTH];
+
+    unsigned pixel_writes {0};
+    unsigned line_writes {0};
+
+    FakeDisplay() : Adafruit_GFX(WIDTH, HEIGHT) { clear(); }
+
+    void clear() {
+        memset(pixels, 0, sizeof(pixels));
+        pixel_writes = 0;
+        line_writes = 0;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (x >= 0 && y >= 0 && x < (int16_t)WIDTH && y < (int16_t)HEIGHT) {
+            pixels[y][x] = color;
+        }
+    }
+
+    void writePixel(int16_t x, int16_t y, uint16_t color) override {
+        ++pixel_writes;
+        drawPixel(x, y, color);
+    }
+
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+        ++line_writes;
+        for (int16_t i = 0; i < w; ++i) {
+            drawPixel(x + i, y, color);
+        }
+    }
+};
+
+static FakeDisplay cached;
+static FakeDisplay reference;
+
+/**
+ * @brief                   Print a string glyph by glyph, in the same way as the display
+ *
+ */
+static void print_reference(FakeDisplay *display, const GFXfont *font, const char *text, unsigned x, unsigned y, uint16_t color) {
+
+    display->setFont(font);
+
+    for (const char *ptr = text; *ptr != '\0'; ++ptr) {
+
+        const GFXglyph &glyph = font->glyph[*ptr - font->first];
+
+        if (glyph.width != 0 && glyph.height != 0) {
+            display->drawChar(x, y, *ptr, color, color, 1);
+        }
+        x += glyph.xAdvance;
+    }
+}
+
+static void assert_same_pixels() {
+    TEST_ASSERT_EQUAL_INT(0, memcmp(cached.pixels, reference.pixels, sizeof(cached.pixels)));
+}
+
+void setUp() {
+    cached.clear();
+    reference.clear();
+}
+
+void tearDown() {}
+
+/**
+ * @brief                   Glyphs drawn from the cache are identical to the glyphs drawn pixel by pixel, with far fewer writes
+ *
+ */
+void test_cached_glyphs_match_font() {
+
+    GlyphCache cache;
+
+    const char *const text = "Save slot 3, then Load it again!";
+
+    // the first print encodes the glyphs, the second one draws them from the cache
+    for (unsigned pass = 0; pass < 2; ++pass) {
+
+        setUp();
+
+        TEST_ASSERT_TRUE(cache.print(&cached, KEY_FONT, text, 4, 40, 0xFFFF));
+        print_reference(&reference, KEY_FONT, text, 4, 40, 0xFFFF);
+
+        assert_same_pixels();
+    }
+
+    TEST_ASSERT_LESS_THAN(reference.pixel_writes, cached.line_writes);
+    TEST_ASSERT_EQUAL_UINT(0, cached.pixel_writes);
+
+    printf("%u pixel writes replaced by %u line writes\n", reference.pixel_writes, cached.line_writes);
+}
+
+/**
+ * @brief                   Toggling shift repeatedly only misses on the first appearance of each glyph
+ *
+ */
+void test_shift_toggle_hit_rate() {
+
+    GlyphCache cache;
+    unsigned distinct {0};
+    char key[2] {};
+
+    bool seen[128] {};
+
+    // the keyboard is drawn in the first position, and shift is then toggled back and forth 20 times
+    for (unsigned toggle = 0; toggle <= 20; ++toggle) {
+
+        const char *layer = KEY_LAYERS[toggle % 2];
+
+        for (unsigned idx = 0; layer[idx] != '\0'; ++idx) {
+
+            key[0] = layer[idx];
+            TEST_ASSERT_TRUE(cache.print(&cached, KEY_FONT, key, 32 * (idx % 10), 32 * (1 + idx / 10), 0xFFFF));
+
+            if (!seen[(uint8_t)key[0]]) {
+                seen[(uint8_t)key[0]] = true;
+                ++distinct;
+            }
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT(distinct, cache.get_misses());
+
+    printf("%lu hits, %lu misses (%lu%% hit rate) over 21 layers of %u keys\n",
+           cache.get_hits(), cache.get_misses(),
+           100 * cache.get_hits() / (cache.get_hits() + cache.get_misses()),
+           (unsigned)strlen(KEY_LAYERS[0]));
+}
+
+/**
+ * @brief                   A working set larger than the arena evicts glyphs, but every glyph is still drawn correctly
+ *
+ */
+void test_eviction_keeps_glyphs_correct() {
+
+    GlyphCache cache;
+
+    for (unsigned round = 0; round < 3; ++round) {
+        for (unsigned layer = 0; layer < 3; ++layer) {
+
+            char row[11] {};
+
+            setUp();
+
+            // the keys are printed in rows of 10, which fit on the display
+            for (unsigned idx = 0; idx < strlen(KEY_LAYERS[layer]); idx += 10) {
+
+                strncpy(row, &KEY_LAYERS[layer][idx], 10);
+
+                TEST_ASSERT_TRUE(cache.print(&cached, KEY_FONT, row, 0, 20 * (1 + idx / 10), 0x1234));
+                print_reference(&reference, KEY_FONT, row, 0, 20 * (1 + idx / 10), 0x1234);
+            }
+
+            assert_same_pixels();
+        }
+    }
+
+    // all three positions do not fit in the default arena, so each round misses on some glyphs again
+    TEST_ASSERT_GREATER_THAN(70, cache.get_misses());
+}
+
+/**
+ * @brief                   Strings that the display would wrap or break into lines are left to the display, and nothing is
+ *                          drawn for them
+ *
+ */
+void test_wrapped_text_is_left_to_display() {
+
+    GlyphCache cache;
+
+    TEST_ASSERT_FALSE(cache.print(&cached, KEY_FONT, "abc", FakeDisplay::WIDTH - 10, 40, 0xFFFF));
+    TEST_ASSERT_FALSE(cache.print(&cached, KEY_FONT, "ab\ncd", 0, 40, 0xFFFF));
+    TEST_ASSERT_FALSE(cache.print(&cached, nullptr, "abc", 0, 40, 0xFFFF));
+
+    assert_same_pixels();
+    TEST_ASSERT_EQUAL_UINT(0, cache.get_hits() + cache.get_misses());
+}
+
+int main() {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_cached_glyphs_match_font);
+    RUN_TEST(test_shift_toggle_hit_rate);
+    RUN_TEST(test_eviction_keeps_glyphs_correct);
+    RUN_TEST(test_wrapped_text_is_left_to_display);
+
+    return UNITY_END();
+}
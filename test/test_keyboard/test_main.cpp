@@ -0,0 +1,152 @@
+/**
+ * @file                    test_main.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Tests of the dispatch of touches to the keys of the `Keyboard` class, comparing the lookup from the
+ *                          geometry of the grid against testing every button in turn (as the keyboard used to)
+ *
+ */
+
+#include "unity.h"
+
+#include "chrono"
+
+#include "widgetpool.cpp"
+#include "widgets/childlist.cpp"
+#include "widgets/window.cpp"
+#include "widgets/button.cpp"
+#include "widgets/keyboard.cpp"
+
+#include "hostframe.h"
+
+/**
+ * @brief                   Exposes the lookups of a keyboard to the tests
+ *
+ */
+class KeyboardProbe : public Keyboard {
+
+public:
+
+    /** Number of intersection tests made by the last call to `scan_buttons` */
+    unsigned tests {0};
+
+    KeyboardProbe(Frame *parent) : Keyboard(parent) {}
+
+    Button *lookup(unsigned x, unsigned y) const {
+
+        unsigned row, col;
+        return find_button(x, y, &row, &col);
+    }
+
+    /**
+     * @brief               Find the button under a point by testing every button in turn, in the order used before the lookup
+     *                      from the geometry of the grid
+     *
+     */
+    Button *scan_buttons(unsigned x, unsigned y) {
+
+        tests = 0;
+
+        for (Button *button : {shift, space, backspace, exit}) {
+            ++tests;
+            if (button->get_intersection(x, y)) {
+                return button;
+            }
+        }
+
+        for (Button *key : keys) {
+            ++tests;
+            if (key->get_intersection(x, y)) {
+                return key;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+static HostFrame *root;
+static KeyboardProbe *keyboard;
+
+void setUp() {
+
+    root = new (std::nothrow, "HostFrame") HostFrame(320, 240);
+    keyboard = new (std::nothrow, "Keyboard") KeyboardProbe(root);
+    root->add_child(keyboard);
+}
+
+void tearDown() {
+    delete root;
+}
+
+/**
+ * @brief                   The lookup finds the same button as testing every button, at every point of the keyboard
+ *
+ */
+void test_lookup_matches_scan() {
+
+    for (unsigned y = 0; y <= keyboard->get_height(); ++y) {
+        for (unsigned x = 0; x <= keyboard->get_width(); ++x) {
+            if (keyboard->lookup(x, y) != keyboard->scan_buttons(x, y)) {
+                printf("mismatch at (%u, %u)\n", x, y);
+                TEST_ASSERT_TRUE(false);
+            }
+        }
+    }
+}
+
+/**
+ * @brief                   Measures the cost of finding the button under every point of the keyboard, with both lookups
+ *
+ */
+void test_dispatch_cost() {
+
+    using clock = std::chrono::steady_clock;
+
+    constexpr unsigned ROUNDS = 20;
+
+    const unsigned w = keyboard->get_width() + 1;
+    const unsigned h = keyboard->get_height() + 1;
+    const unsigned lookups = ROUNDS * w * h;
+
+    uintptr_t sink {0};
+    unsigned long total_tests {0};
+    unsigned max_tests {0};
+
+    clock::time_point start = clock::now();
+    for (unsigned round = 0; round < ROUNDS; ++round) {
+        for (unsigned y = 0; y < h; ++y) {
+            for (unsigned x = 0; x < w; ++x) {
+                sink += (uintptr_t)keyboard->scan_buttons(x, y);
+                total_tests += keyboard->tests;
+                max_tests = max(max_tests, keyboard->tests);
+            }
+        }
+    }
+    double scan_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / lookups;
+
+    start = clock::now();
+    for (unsigned round = 0; round < ROUNDS; ++round) {
+        for (unsigned y = 0; y < h; ++y) {
+            for (unsigned x = 0; x < w; ++x) {
+                sink += (uintptr_t)keyboard->lookup(x, y);
+            }
+        }
+    }
+    double lookup_ns = std::chrono::duration<double, std::nano>(clock::now() - start).count() / lookups;
+
+    printf("scan: %.1f ns per touch (%.1f intersection tests on average, %u at most)\n",
+           scan_ns, (double)total_tests / lookups, max_tests);
+    printf("lookup: %.1f ns per touch (%u)\n", lookup_ns, (unsigned)(sink & 1));
+
+    TEST_ASSERT_LESS_THAN(scan_ns, lookup_ns);
+}
+
+int main() {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_lookup_matches_scan);
+    RUN_TEST(test_dispatch_cost);
+
+    return UNITY_END();
+}
@@ -0,0 +1,326 @@
+/**
+ * @file                    test_main.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Tests of the `TaskScheduler` class, with several tasks running at once on a host clock that only
+ *                          advances when the test moves it
+ *
+ */
+
+#include "unity.h"
+
+#include "task.cpp"
+
+/** Order in which the steps of all tasks ran (each step appends one character) */
+static char trace[64];
+static unsigned trace_len;
+
+/** Flag awaited by `waiter_task` */
+static bool ready;
+
+/** Scheduler used by tasks that start or cancel other tasks */
+static TaskScheduler *current;
+
+static void step(char c) {
+    trace[trace_len++] = c;
+    trace[trace_len] = '\0';
+}
+
+/**
+ * @brief                   Records its argument three times, yielding between the steps
+ *
+ */
+static task_status_t yielding_task(task_t *task, unsigned *args) {
+
+    TASK_BEGIN(task);
+
+    step((char)args[0]);
+    TASK_YIELD(task);
+    step((char)args[0]);
+    TASK_YIELD(task);
+    step((char)args[0]);
+
+    TASK_END(task);
+}
+
+/**
+ * @brief                   Records 'S', sleeps for 10 ms and records 's'
+ *
+ */
+static task_status_t sleeping_task(task_t *task, unsigned *args) {
+
+    TASK_BEGIN(task);
+
+    step('S');
+    TASK_SLEEP(task, 10);
+    step('s');
+
+    TASK_END(task);
+}
+
+/**
+ * @brief                   Records 'W', waits until `ready` is set and records 'w'
+ *
+ */
+static task_status_t waiter_task(task_t *task, unsigned *args) {
+
+    TASK_BEGIN(task);
+
+    step('W');
+    TASK_AWAIT(task, ready);
+    step('w');
+
+    TASK_END(task);
+}
+
+static unsigned arg_x[] {'x'};
+static unsigned arg_y[] {'y'};
+
+/**
+ * @brief                   Starts a `yielding_task` and finishes immediately
+ *
+ */
+static task_status_t spawning_task(task_t *task, unsigned *args) {
+
+    step('P');
+    current->start(yielding_task, arg_x);
+    return TASK_DONE;
+}
+
+/**
+ * @brief                   Cancels every `yielding_task` and finishes immediately
+ *
+ */
+static task_status_t cancelling_task(task_t *task, unsigned *args) {
+
+    step('C');
+    current->cancel(yielding_task);
+    return TASK_DONE;
+}
+
+/**
+ * @brief                   Cancels every `waiter_task` and finishes immediately
+ *
+ */
+static task_status_t waiter_cancelling_task(task_t *task, unsigned *args) {
+
+    step('C');
+    current->cancel(waiter_task);
+    return TASK_DONE;
+}
+
+/**
+ * @brief                   Cancels every `waiter_task` each time it is resumed, and never finishes
+ *
+ */
+static task_status_t waiter_cancelling_loop(task_t *task, unsigned *args) {
+
+    step('L');
+    current->cancel(waiter_task);
+    return TASK_RUNNING;
+}
+
+void setUp() {
+    trace_len = 0;
+    trace[0] = '\0';
+    ready = false;
+    host_micros = 0;
+}
+
+void tearDown() {}
+
+/**
+ * @brief                   Every running task is resumed once per call, in the order in which the tasks were started
+ *
+ */
+void test_tasks_interleave() {
+
+    TaskScheduler tasks;
+
+    TEST_ASSERT_TRUE(tasks.start(yielding_task, arg_x));
+    TEST_ASSERT_TRUE(tasks.start(sleeping_task, nullptr));
+    TEST_ASSERT_TRUE(tasks.start(yielding_task, arg_y));
+    TEST_ASSERT_TRUE(tasks.start(waiter_task, nullptr));
+
+    // nothing runs until the scheduler is executed
+    TEST_ASSERT_EQUAL_STRING("", trace);
+
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("xSyW", trace);
+
+    host_micros += 5000;
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("xSyWxy", trace);
+
+    // the yielding tasks finish, the sleeping task wakes up 10 ms after it slept
+    host_micros += 5000;
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("xSyWxyxsy", trace);
+    TEST_ASSERT_EQUAL_UINT(1, tasks.get_count());
+    TEST_ASSERT_TRUE(tasks.is_running(waiter_task));
+    TEST_ASSERT_FALSE(tasks.is_running(yielding_task));
+
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("xSyWxyxsy", trace);
+
+    ready = true;
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("xSyWxyxsyw", trace);
+    TEST_ASSERT_EQUAL_UINT(0, tasks.get_count());
+}
+
+/**
+ * @brief                   A task can not be started once the table is full, until another task finishes
+ *
+ */
+void test_capacity() {
+
+    TaskScheduler tasks;
+
+    for (unsigned idx = 0; idx < TaskScheduler::CAPACITY; ++idx) {
+        TEST_ASSERT_TRUE(tasks.start(waiter_task, nullptr));
+    }
+
+    TEST_ASSERT_FALSE(tasks.start(yielding_task, arg_x));
+    TEST_ASSERT_EQUAL_UINT(TaskScheduler::CAPACITY, tasks.get_count());
+
+    ready = true;
+    tasks.execute();
+    TEST_ASSERT_EQUAL_UINT(0, tasks.get_count());
+    TEST_ASSERT_TRUE(tasks.start(yielding_task, arg_x));
+}
+
+/**
+ * @brief                   A cancelled task is never resumed again, and the other tasks keep their order
+ *
+ */
+void test_cancel() {
+
+    TaskScheduler tasks;
+
+    tasks.start(yielding_task, arg_x);
+    tasks.start(sleeping_task, nullptr);
+    tasks.start(yielding_task, arg_y);
+
+    tasks.execute();
+    TEST_ASSERT_EQUAL_UINT(2, tasks.cancel(yielding_task));
+    TEST_ASSERT_EQUAL_UINT(0, tasks.cancel(yielding_task));
+    TEST_ASSERT_FALSE(tasks.is_running(yielding_task));
+
+    host_micros += 10000;
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("xSys", trace);
+    TEST_ASSERT_EQUAL_UINT(0, tasks.get_count());
+}
+
+/**
+ * @brief                   A task started by another task is first resumed on the next call, and a task cancelled by another
+ *                          task is not resumed in the same call
+ *
+ */
+void test_tasks_started_and_cancelled_by_tasks() {
+
+    TaskScheduler tasks;
+    current = &tasks;
+
+    tasks.start(spawning_task, nullptr);
+    tasks.start(yielding_task, arg_y);
+
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("Py", trace);
+    TEST_ASSERT_EQUAL_UINT(2, tasks.get_count());
+
+    tasks.start(cancelling_task, nullptr);
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("PyyxC", trace);
+    TEST_ASSERT_EQUAL_UINT(0, tasks.get_count());
+
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("PyyxC", trace);
+}
+
+/**
+ * @brief                   A task that cancels a task started before it does not disturb the tasks started after it, whether
+ *                          it finishes or keeps running
+ *
+ */
+void test_task_cancels_earlier_task() {
+
+    TaskScheduler tasks;
+    current = &tasks;
+
+    tasks.start(waiter_task, nullptr);
+    tasks.start(waiter_cancelling_task, nullptr);
+    tasks.start(yielding_task, arg_y);
+
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("WCy", trace);
+    TEST_ASSERT_EQUAL_UINT(1, tasks.get_count());
+    TEST_ASSERT_TRUE(tasks.is_running(yielding_task));
+    TEST_ASSERT_FALSE(tasks.is_running(waiter_cancelling_task));
+    TEST_ASSERT_FALSE(tasks.is_running(waiter_task));
+
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("WCyy", trace);
+
+    trace_len = 0;
+    trace[0] = '\0';
+
+    tasks.start(waiter_task, nullptr);
+    tasks.start(waiter_cancelling_loop, nullptr);
+    tasks.start(sleeping_task, nullptr);
+
+    // the order is now [yielding, waiter, loop, sleeping]
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("yWLS", trace);
+    TEST_ASSERT_EQUAL_UINT(2, tasks.get_count());
+    TEST_ASSERT_TRUE(tasks.is_running(waiter_cancelling_loop));
+    TEST_ASSERT_TRUE(tasks.is_running(sleeping_task));
+
+    host_micros += 10000;
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("yWLSLs", trace);
+    TEST_ASSERT_EQUAL_UINT(1, tasks.get_count());
+}
+
+/**
+ * @brief                   Cancels itself, but asks to be resumed again
+ *
+ */
+static task_status_t self_cancelling_task(task_t *task, unsigned *args) {
+
+    step('X');
+    current->cancel(self_cancelling_task);
+    return TASK_RUNNING;
+}
+
+/**
+ * @brief                   A task that cancels itself is not resumed again, even if it asks to be
+ *
+ */
+void test_task_cancels_itself() {
+
+    TaskScheduler tasks;
+    current = &tasks;
+
+    tasks.start(self_cancelling_task, nullptr);
+    tasks.start(yielding_task, arg_y);
+
+    tasks.execute();
+    tasks.execute();
+    TEST_ASSERT_EQUAL_STRING("Xyy", trace);
+    TEST_ASSERT_EQUAL_UINT(1, tasks.get_count());
+}
+
+int main() {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_tasks_interleave);
+    RUN_TEST(test_capacity);
+    RUN_TEST(test_cancel);
+    RUN_TEST(test_tasks_started_and_cancelled_by_tasks);
+    RUN_TEST(test_task_cancels_earlier_task);
+    RUN_TEST(test_task_cancels_itself);
+
+    return UNITY_END();
+}
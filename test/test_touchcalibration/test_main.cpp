@@ -0,0 +1,227 @@
+/**
+ * @file                    test_main.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Tests of the `TouchCalibration` class, with a file standing in for the EEPROM
+ *
+ */
+
+#define TOUCH_CALIBRATION_FILE "test_touchcalibration.bin"
+
+#include "unity.h"
+
+#include "cstdlib"
+
+#include "touchcalibration.cpp"
+
+constexpr int32_t DISPLAY_W = 320;
+constexpr int32_t DISPLAY_H = 480;
+
+/** Targets used by the app (see `calibrate_touchscreen`) */
+static const touch_point_t TARGETS[TouchCalibration::NUM_TARGETS] {
+    {DISPLAY_W / 10, DISPLAY_H / 10},
+    {(DISPLAY_W * 9) / 10, DISPLAY_H / 2},
+    {DISPLAY_W / 2, (DISPLAY_H * 9) / 10},
+};
+
+/** Check target used by the app, which is not part of the fit */
+static const touch_point_t CHECK_TARGET {DISPLAY_W / 2, DISPLAY_H / 2};
+
+/**
+ * @brief                   Simulated panel, slightly rotated against the display and with the Y-axis flipped (about 2 raw
+ *                          units per pixel, like the panel of the app)
+ *
+ */
+static touch_point_t to_raw(int32_t x, int32_t y) {
+    return {180 + (x * 21) / 10 + y / 20, 950 - (y * 17) / 10 + x / 25};
+}
+
+static void touch_targets(touch_point_t raw[TouchCalibration::NUM_TARGETS]) {
+    for (unsigned idx = 0; idx < TouchCalibration::NUM_TARGETS; ++idx) {
+        raw[idx] = to_raw(TARGETS[idx].x, TARGETS[idx].y);
+    }
+}
+
+void setUp() {
+    remove(TOUCH_CALIBRATION_FILE);
+}
+
+void tearDown() {
+    remove(TOUCH_CALIBRATION_FILE);
+}
+
+/**
+ * @brief                   The calibration of a rotated panel maps every point of the display back onto itself
+ *
+ */
+void test_compute_rotated_panel() {
+
+    touch_point_t raw[TouchCalibration::NUM_TARGETS];
+    touch_calibration_t cal;
+    int32_t worst {0};
+
+    touch_targets(raw);
+
+    TEST_ASSERT_TRUE(TouchCalibration::compute(raw, TARGETS, &cal));
+    TEST_ASSERT_TRUE(TouchCalibration::verify(cal, to_raw(CHECK_TARGET.x, CHECK_TARGET.y), CHECK_TARGET));
+
+    for (int32_t y = 0; y < DISPLAY_H; y += 4) {
+        for (int32_t x = 0; x < DISPLAY_W; x += 4) {
+
+            touch_point_t p = to_raw(x, y);
+            int32_t px;
+            int32_t py;
+
+            TouchCalibration::apply(cal, p.x, p.y, &px, &py);
+
+            worst = max(worst, max(abs(px - x), abs(py - y)));
+        }
+    }
+
+    printf("largest error over the display: %d pixels\n", (int)worst);
+    TEST_ASSERT_TRUE(worst <= 1);
+}
+
+/**
+ * @brief                   Targets touched on a line, nearly on a line or all in one spot are rejected, and the calibration
+ *                          is left unchanged
+ *
+ */
+void test_compute_rejects_degenerate_targets() {
+
+    const touch_point_t on_line[] {{200, 200}, {400, 400}, {600, 600}};
+    const touch_point_t nearly_on_line[] {{200, 200}, {400, 400}, {600, 601}};
+    const touch_point_t one_spot[] {{500, 500}, {530, 500}, {500, 530}};
+
+    touch_calibration_t cal {1, 2, 3, 4, 5, 6};
+
+    TEST_ASSERT_FALSE(TouchCalibration::compute(on_line, TARGETS, &cal));
+    TEST_ASSERT_FALSE(TouchCalibration::compute(nearly_on_line, TARGETS, &cal));
+    TEST_ASSERT_FALSE(TouchCalibration::compute(one_spot, TARGETS, &cal));
+
+    TEST_ASSERT_EQUAL_INT(1, cal.a);
+    TEST_ASSERT_EQUAL_INT(6, cal.f);
+}
+
+/**
+ * @brief                   Targets that are far enough apart, but give a mapping far from any real panel, are rejected
+ *
+ */
+void test_compute_rejects_out_of_bounds_coefficients() {
+
+    // the determinant is large enough, but the Y-axis spans only 12 raw units (16 pixels per raw unit)
+    const touch_point_t flat[] {{200, 500}, {800, 500}, {500, 512}};
+    // the scale is sane, but the targets were touched far beyond the range of the panel
+    const touch_point_t far_away[] {{-20000, -20000}, {-19400, -20000}, {-19700, -19400}};
+
+    touch_calibration_t cal;
+
+    TEST_ASSERT_FALSE(TouchCalibration::compute(flat, TARGETS, &cal));
+    TEST_ASSERT_FALSE(TouchCalibration::compute(far_away, TARGETS, &cal));
+}
+
+/**
+ * @brief                   A check target that is touched close to its mark passes verification, and one that is missed
+ *                          by 10 pixels fails it
+ *
+ */
+void test_verify_rejects_missed_check_target() {
+
+    touch_point_t raw[TouchCalibration::NUM_TARGETS];
+    touch_calibration_t cal;
+
+    touch_targets(raw);
+    TEST_ASSERT_TRUE(TouchCalibration::compute(raw, TARGETS, &cal));
+
+    TEST_ASSERT_TRUE(TouchCalibration::verify(cal, to_raw(CHECK_TARGET.x + 5, CHECK_TARGET.y - 5), CHECK_TARGET));
+
+    TEST_ASSERT_FALSE(TouchCalibration::verify(cal, to_raw(CHECK_TARGET.x + 10, CHECK_TARGET.y), CHECK_TARGET));
+    TEST_ASSERT_FALSE(TouchCalibration::verify(cal, to_raw(CHECK_TARGET.x, CHECK_TARGET.y - 10), CHECK_TARGET));
+}
+
+/**
+ * @brief                   A target of the fit that is touched off its mark still gives a calibration (which maps it back
+ *                          onto itself), but the check target then fails verification even when it is touched accurately
+ *
+ */
+void test_verify_rejects_missed_fit_target() {
+
+    touch_point_t raw[TouchCalibration::NUM_TARGETS];
+    touch_calibration_t cal;
+
+    touch_targets(raw);
+    raw[1] = to_raw(TARGETS[1].x - 30, TARGETS[1].y);
+
+    TEST_ASSERT_TRUE(TouchCalibration::compute(raw, TARGETS, &cal));
+    TEST_ASSERT_FALSE(TouchCalibration::verify(cal, to_raw(CHECK_TARGET.x, CHECK_TARGET.y), CHECK_TARGET));
+}
+
+/**
+ * @brief                   A stored calibration is loaded back unchanged
+ *
+ */
+void test_save_then_load() {
+
+    touch_point_t raw[TouchCalibration::NUM_TARGETS];
+    touch_calibration_t saved;
+    touch_calibration_t loaded;
+
+    touch_targets(raw);
+    TEST_ASSERT_TRUE(TouchCalibration::compute(raw, TARGETS, &saved));
+
+    TEST_ASSERT_FALSE(TouchCalibration::load(&loaded));
+    TEST_ASSERT_TRUE(TouchCalibration::save(saved));
+    TEST_ASSERT_TRUE(TouchCalibration::load(&loaded));
+
+    TEST_ASSERT_EQUAL(0, memcmp(&saved, &loaded, sizeof(saved)));
+}
+
+/**
+ * @brief                   A record that was corrupted or only partially written is not loaded
+ *
+ */
+void test_load_rejects_damaged_record() {
+
+    touch_calibration_t cal = TouchCalibration::from_bounds(177, 863, 121, 950, DISPLAY_W, DISPLAY_H);
+    touch_calibration_t loaded {1, 2, 3, 4, 5, 6};
+    uint8_t bytes[64];
+    size_t size;
+    FILE *file;
+
+    TEST_ASSERT_TRUE(TouchCalibration::save(cal));
+
+    file = fopen(TOUCH_CALIBRATION_FILE, "rb");
+    size = fread(bytes, 1, sizeof(bytes), file);
+    fclose(file);
+
+    // one coefficient is changed
+    bytes[8] ^= 0x01;
+    file = fopen(TOUCH_CALIBRATION_FILE, "wb");
+    fwrite(bytes, 1, size, file);
+    fclose(file);
+
+    TEST_ASSERT_FALSE(TouchCalibration::load(&loaded));
+
+    // the record is cut short
+    bytes[8] ^= 0x01;
+    file = fopen(TOUCH_CALIBRATION_FILE, "wb");
+    fwrite(bytes, 1, size - 1, file);
+    fclose(file);
+
+    TEST_ASSERT_FALSE(TouchCalibration::load(&loaded));
+    TEST_ASSERT_EQUAL_INT(1, loaded.a);
+}
+
+int main() {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_compute_rotated_panel);
+    RUN_TEST(test_compute_rejects_degenerate_targets);
+    RUN_TEST(test_compute_rejects_out_of_bounds_coefficients);
+    RUN_TEST(test_verify_rejects_missed_check_target);
+    RUN_TEST(test_verify_rejects_missed_fit_target);
+    RUN_TEST(test_save_then_load);
+    RUN_TEST(test_load_rejects_damaged_record);
+
+    return UNITY_END();
+}
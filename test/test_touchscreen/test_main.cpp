@@ -0,0 +1,200 @@
+/**
+ * @file                    test_main.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Tests of the buffer of samples of the `Touchscreen` class, fed from a simulated touchscreen
+ *
+ */
+
+#include "unity.h"
+
+#include "touchcalibration.cpp"
+#include "touchscreen_driver.cpp"
+
+/** Raw pressure of a simulated touch (within the default pressure bounds) */
+constexpr uint16_t TOUCHED = 300;
+/** Raw pressure while nothing touches the simulated screen */
+constexpr uint16_t LIFTED = 0;
+
+/** Pressure of the next measurement of the simulated touchscreen */
+static uint16_t sim_z;
+/** Number of measurements taken from the simulated touchscreen */
+static unsigned sim_count;
+
+/**
+ * @brief                   Simulated touchscreen, touched at a fixed point whenever `sim_z` is within the pressure bounds
+ *
+ */
+static bool sim_source(touch_sample_t *sample) {
+
+    sample->x = 500;
+    sample->y = 500;
+    sample->z = sim_z;
+    sample->t = micros();
+
+    host_micros += 4000;
+    ++sim_count;
+
+    return true;
+}
+
+/**
+ * @brief                   Exposes the capacity of the buffer of samples to the tests
+ *
+ */
+class TouchscreenProbe : public Touchscreen {
+
+public:
+
+    using Touchscreen::SAMPLE_CAPACITY;
+
+    TouchscreenProbe() : Touchscreen(0, 1, 2, 3) {}
+};
+
+static TouchscreenProbe *ts;
+
+/**
+ * @brief                   Take a number of measurements with the same pressure
+ *
+ */
+static void read(unsigned count, uint16_t z) {
+
+    sim_z = z;
+    for (unsigned i = 0; i < count; ++i) {
+        ts->read_screen();
+    }
+}
+
+/**
+ * @brief                   Process every pending sample, counting the presses and releases that become available
+ *
+ */
+static void drain(unsigned *presses, unsigned *releases) {
+
+    unsigned x, y;
+
+    while (ts->process_sample()) {
+        *presses += ts->get_press(&x, &y);
+        *releases += ts->get_release(&x, &y);
+    }
+}
+
+void setUp() {
+
+    ts = new TouchscreenProbe();
+    ts->set_dimensions(320, 480);
+    ts->set_sample_source(sim_source);
+
+    sim_count = 0;
+    host_micros = 0;
+}
+
+void tearDown() {
+    delete ts;
+}
+
+/**
+ * @brief                   Samples taken while the buffer is full are dropped and counted, and the rest are kept in order
+ *
+ */
+void test_drop_count_when_full() {
+
+    unsigned presses {0};
+    unsigned releases {0};
+
+    read(TouchscreenProbe::SAMPLE_CAPACITY + 10, TOUCHED);
+
+    TEST_ASSERT_EQUAL_UINT(TouchscreenProbe::SAMPLE_CAPACITY, ts->get_pending());
+    TEST_ASSERT_EQUAL_UINT(10, ts->get_dropped());
+
+    // the oldest sample is processed first
+    TEST_ASSERT_TRUE(ts->process_sample());
+    TEST_ASSERT_EQUAL_UINT(0, ts->get_sample_time());
+    TEST_ASSERT_EQUAL_UINT(TouchscreenProbe::SAMPLE_CAPACITY - 1, ts->get_pending());
+
+    // a freed entry is reused, and nothing more is dropped
+    read(1, TOUCHED);
+    TEST_ASSERT_EQUAL_UINT(TouchscreenProbe::SAMPLE_CAPACITY, ts->get_pending());
+    TEST_ASSERT_EQUAL_UINT(10, ts->get_dropped());
+
+    drain(&presses, &releases);
+
+    TEST_ASSERT_EQUAL_UINT(0, ts->get_pending());
+    TEST_ASSERT_EQUAL_UINT(0, releases);
+}
+
+/**
+ * @brief                   Only the first measurement after the stylus is lifted is kept, which produces exactly one release
+ *
+ */
+void test_single_release_after_lift() {
+
+    unsigned presses {0};
+    unsigned releases {0};
+    unsigned x, y;
+
+    read(5, TOUCHED);
+    read(20, LIFTED);
+
+    TEST_ASSERT_EQUAL_UINT(25, sim_count);
+    TEST_ASSERT_EQUAL_UINT(6, ts->get_pending());
+
+    drain(&presses, &releases);
+
+    TEST_ASSERT_EQUAL_UINT(1, presses);
+    TEST_ASSERT_EQUAL_UINT(1, releases);
+    TEST_ASSERT_FALSE(ts->get_stylus_position(&x, &y));
+
+    // the idle screen does not fill the buffer
+    read(100, LIFTED);
+    TEST_ASSERT_EQUAL_UINT(0, ts->get_pending());
+
+    // the next touch is pressed and released again
+    read(3, TOUCHED);
+    read(3, LIFTED);
+    drain(&presses, &releases);
+
+    TEST_ASSERT_EQUAL_UINT(2, presses);
+    TEST_ASSERT_EQUAL_UINT(2, releases);
+}
+
+/**
+ * @brief                   A lift that was dropped because the buffer was full is kept with the next measurement, so the
+ *                          release is not lost (and is still only reported once)
+ *
+ */
+void test_dropped_lift_is_retried() {
+
+    unsigned presses {0};
+    unsigned releases {0};
+    unsigned x, y;
+
+    read(TouchscreenProbe::SAMPLE_CAPACITY, TOUCHED);
+    read(1, LIFTED);
+
+    TEST_ASSERT_EQUAL_UINT(1, ts->get_dropped());
+
+    // the press must be consumed before the next sample is processed, as in the loop
+    TEST_ASSERT_TRUE(ts->process_sample());
+    presses += ts->get_press(&x, &y);
+
+    read(5, LIFTED);
+
+    TEST_ASSERT_EQUAL_UINT(TouchscreenProbe::SAMPLE_CAPACITY, ts->get_pending());
+    TEST_ASSERT_EQUAL_UINT(1, ts->get_dropped());
+
+    drain(&presses, &releases);
+
+    TEST_ASSERT_EQUAL_UINT(1, presses);
+    TEST_ASSERT_EQUAL_UINT(1, releases);
+}
+
+int main() {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_drop_count_when_full);
+    RUN_TEST(test_single_release_after_lift);
+    RUN_TEST(test_dropped_lift_is_retried);
+
+    return UNITY_END();
+}
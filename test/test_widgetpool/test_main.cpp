@@ -0,0 +1,119 @@
+/**
+ * @file                    test_main.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Tests of the statistics of the `WidgetPool` class, which must follow the objects that are alive
+ *
+ */
+
+#include "unity.h"
+
+#include "widgetpool.cpp"
+#include "sharedstyle.h"
+
+/**
+ * @brief                   Exposes the statistics of each type to the tests
+ *
+ */
+class WidgetPoolProbe : public WidgetPool {
+
+public:
+
+    static const type_stats_t *find(const char *type_name) {
+        return get_type(type_name);
+    }
+};
+
+/**
+ * @brief                   Style that is only used to copy through `SharedStyle`
+ *
+ */
+struct ProbeStyle {
+
+    constexpr static const char *TYPE_NAME = "ProbeStyle";
+
+    uint32_t words[7];
+};
+
+static const ProbeStyle PROBE_STYLE {};
+
+void setUp() {}
+
+void tearDown() {}
+
+/**
+ * @brief                   Objects released from the arena are subtracted from the statistics of their type, and their
+ *                          blocks are reused
+ *
+ */
+void test_release_from_arena() {
+
+    void *a = WidgetPool::allocate(100, "Probe");
+    void *b = WidgetPool::allocate(100, "Probe");
+    unsigned used = WidgetPool::get_arena_used();
+
+    TEST_ASSERT_EQUAL_UINT(2, WidgetPoolProbe::find("Probe")->pool_count);
+    TEST_ASSERT_EQUAL_UINT(2 * 112, WidgetPoolProbe::find("Probe")->pool_bytes);
+
+    WidgetPool::release(a, 100, "Probe");
+
+    TEST_ASSERT_EQUAL_UINT(1, WidgetPoolProbe::find("Probe")->pool_count);
+    TEST_ASSERT_EQUAL_UINT(112, WidgetPoolProbe::find("Probe")->pool_bytes);
+
+    // the freed block is taken again, without carving a new one
+    TEST_ASSERT_TRUE(WidgetPool::allocate(100, "Probe") == a);
+    TEST_ASSERT_EQUAL_UINT(used, WidgetPool::get_arena_used());
+
+    WidgetPool::release(a, 100, "Probe");
+    WidgetPool::release(b, 100, "Probe");
+
+    TEST_ASSERT_EQUAL_UINT(0, WidgetPoolProbe::find("Probe")->pool_count);
+    TEST_ASSERT_EQUAL_UINT(0, WidgetPoolProbe::find("Probe")->pool_bytes);
+}
+
+/**
+ * @brief                   Objects that fell back to the heap are subtracted from the heap statistics of their type
+ *
+ */
+void test_release_from_heap() {
+
+    void *big = WidgetPool::allocate(2048, "Big");
+
+    TEST_ASSERT_EQUAL_UINT(1, WidgetPoolProbe::find("Big")->heap_count);
+    TEST_ASSERT_EQUAL_UINT(2048, WidgetPoolProbe::find("Big")->heap_bytes);
+
+    WidgetPool::release(big, 2048, "Big");
+
+    TEST_ASSERT_EQUAL_UINT(0, WidgetPoolProbe::find("Big")->heap_count);
+    TEST_ASSERT_EQUAL_UINT(0, WidgetPoolProbe::find("Big")->heap_bytes);
+    TEST_ASSERT_EQUAL_UINT(0, WidgetPoolProbe::find("Big")->pool_count);
+}
+
+/**
+ * @brief                   A style copied by `get_mutable` is counted until the reference is pointed back to a shared style
+ *
+ */
+void test_style_copy_is_released() {
+
+    SharedStyle<ProbeStyle> style {&PROBE_STYLE};
+
+    style.get_mutable();
+    style.get_mutable();
+
+    TEST_ASSERT_EQUAL_UINT(1, WidgetPoolProbe::find("ProbeStyle")->pool_count);
+
+    style.set_shared(&PROBE_STYLE);
+
+    TEST_ASSERT_EQUAL_UINT(0, WidgetPoolProbe::find("ProbeStyle")->pool_count);
+    TEST_ASSERT_EQUAL_UINT(0, WidgetPoolProbe::find("ProbeStyle")->pool_bytes);
+}
+
+int main() {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_release_from_arena);
+    RUN_TEST(test_release_from_heap);
+    RUN_TEST(test_style_copy_is_released);
+
+    return UNITY_END();
+}
@@ -0,0 +1,303 @@
+/**
+ * @file                    bitmapconv.cpp
+ * @author                  Aditya Agarwal (aditya.agarwal@dumblebots.com)
+ * @brief                   Host tool that converts raw RGB565 bitmaps into compressed bitmap assets (see `lib/gui/include/bitmapasset.h`)
+ *
+ *                          The input is a C header of raw RGB565 arrays, in the form produced by most image converters -
+ *
+ *                              const uint16_t name[] PROGMEM = {0x0,0xffff,...};
+ *
+ *                          Each array to convert is named on the command line along with its dimensions. The generated
+ *                          header (written to standard output) defines a `bitmap_asset_t` with the same name for each of them.
+ *                          Arrays that are not named are left out.
+ *
+ *                          Build and run (from the root of the repository) -
+ *
+ *                              g++ -std=c++17 -O2 -o bitmapconv tools/bitmapconv/bitmapconv.cpp
+ *                              ./bitmapconv tools/bitmapconv/bitmaps_rgb565.h qrcode_bmp:135x135 ... > include/bitmaps.h
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/** Must match the constants in `bitmapasset.h` */
+constexpr unsigned ESCAPE_CODE = 0xFF;
+constexpr unsigned RUN_TOKEN = 0x80;
+constexpr unsigned LONG_RUN_TOKEN = 0xFF;
+
+constexpr unsigned MAX_LITERAL = RUN_TOKEN;
+constexpr unsigned MAX_SHORT_RUN = LONG_RUN_TOKEN - RUN_TOKEN;
+constexpr unsigned MAX_LONG_RUN = UINT16_MAX;
+
+struct image_t {
+    std::string name;
+    unsigned width;
+    unsigned height;
+    std::vector<uint16_t> pixels;
+};
+
+/**
+ * @brief                   Parse all raw RGB565 arrays in a header, keyed by their names
+ *
+ */
+static bool parse_arrays(const char *path, std::map<std::string, std::vector<uint16_t>> &arrays) {
+
+    std::ifstream file(path);
+    std::stringstream ss;
+    std::string text;
+
+    if (!file) {
+        return false;
+    }
+
+    ss << file.rdbuf();
+    text = ss.str();
+
+    for (size_t pos = 0; (pos = text.find("uint16_t", pos)) != std::string::npos; ) {
+
+        size_t name_begin = text.find_first_not_of(" \t", pos + 8);
+        size_t name_end = text.find('[', name_begin);
+        size_t open = text.find('{', name_end);
+        size_t close = text.find('}', open);
+
+        if (name_end == std::string::npos || open == std::string::npos || close == std::string::npos) {
+            break;
+        }
+
+        std::string name = text.substr(name_begin, name_end - name_begin);
+        std::vector<uint16_t> &pixels = arrays[name];
+        std::stringstream values(text.substr(open + 1, close - open - 1));
+
+        for (std::string value; std::getline(values, value, ','); ) {
+            if (value.find_first_not_of(" \t\r\n") != std::string::npos) {
+                pixels.push_back((uint16_t)std::stoul(value, nullptr, 0));
+            }
+        }
+
+        pos = close;
+    }
+
+    return true;
+}
+
+/**
+ * @brief                   Build the palette of an image, made of its most frequent colors
+ *
+ */
+static std::vector<uint16_t> build_palette(const std::vector<uint16_t> &pixels) {
+
+    std::map<uint16_t, unsigned> counts;
+    std::vector<std::pair<unsigned, uint16_t>> by_count;
+    std::vector<uint16_t> palette;
+
+    for (uint16_t color : pixels) {
+        ++counts[color];
+    }
+    for (auto &entry : counts) {
+        by_count.emplace_back(entry.second, entry.first);
+    }
+
+    std::sort(by_count.begin(), by_count.end(), [](auto &a, auto &b) {
+        return (a.first != b.first) ? (a.first > b.first) : (a.second < b.second);
+    });
+
+    for (size_t idx = 0; idx < by_count.size() && idx < ESCAPE_CODE; ++idx) {
+        palette.push_back(by_count[idx].second);
+    }
+
+    return palette;
+}
+
+/**
+ * @brief                   Encode an image into a stream of tokens
+ *
+ */
+static std::vector<uint8_t> encode(const std::vector<uint16_t> &pixels, const std::vector<uint16_t> &palette) {
+
+    std::map<uint16_t, uint8_t> codes;
+    std::vector<uint8_t> out;
+    size_t literal_pos = 0;
+    unsigned literal_len = 0;
+
+    for (size_t idx = 0; idx < palette.size(); ++idx) {
+        codes[palette[idx]] = (uint8_t)idx;
+    }
+
+    auto put_pixel = [&](uint16_t color) {
+        auto it = codes.find(color);
+        if (it != codes.end()) {
+            out.push_back(it->second);
+        }
+        else {
+            out.push_back(ESCAPE_CODE);
+            out.push_back(color & 0xFF);
+            out.push_back(color >> 8);
+        }
+    };
+
+    for (size_t idx = 0; idx < pixels.size(); ) {
+
+        size_t run = 1;
+        while (idx + run < pixels.size() && pixels[idx + run] == pixels[idx] && run < MAX_LONG_RUN) {
+            ++run;
+        }
+
+        // runs of two or more pixels never cost more than the same pixels in a literal
+        if (run >= 2) {
+
+            if (run <= MAX_SHORT_RUN) {
+                out.push_back(RUN_TOKEN + run - 1);
+            }
+            else {
+                out.push_back(LONG_RUN_TOKEN);
+                out.push_back(run & 0xFF);
+                out.push_back(run >> 8);
+            }
+            put_pixel(pixels[idx]);
+
+            literal_len = 0;
+            idx += run;
+            continue;
+        }
+
+        if (literal_len == 0 || literal_len == MAX_LITERAL) {
+            literal_pos = out.size();
+            literal_len = 0;
+            out.push_back(0);
+        }
+        out[literal_pos] = literal_len++;
+        put_pixel(pixels[idx++]);
+    }
+
+    return out;
+}
+
+/**
+ * @brief                   Decode a stream of tokens (used to verify the output of the encoder)
+ *
+ */
+static std::vector<uint16_t> decode(const std::vector<uint8_t> &data, const std::vector<uint16_t> &palette) {
+
+    std::vector<uint16_t> pixels;
+    size_t pos = 0;
+
+    auto get_pixel = [&]() -> uint16_t {
+        uint8_t code = data[pos++];
+        if (code != ESCAPE_CODE) {
+            return palette[code];
+        }
+        pos += 2;
+        return data[pos - 2] | (data[pos - 1] << 8);
+    };
+
+    while (pos < data.size()) {
+
+        uint8_t token = data[pos++];
+
+        if (token < RUN_TOKEN) {
+            for (unsigned idx = 0; idx <= token; ++idx) {
+                pixels.push_back(get_pixel());
+            }
+            continue;
+        }
+
+        unsigned run = token - RUN_TOKEN + 1;
+        if (token == LONG_RUN_TOKEN) {
+            run = data[pos] | (data[pos + 1] << 8);
+            pos += 2;
+        }
+        pixels.insert(pixels.end(), run, get_pixel());
+    }
+
+    return pixels;
+}
+
+static void write_asset(const image_t &image, const std::vector<uint16_t> &palette, const std::vector<uint8_t> &data) {
+
+    printf("const uint16_t %s_palette[] PROGMEM = {", image.name.c_str());
+    for (size_t idx = 0; idx < palette.size(); ++idx) {
+        printf("%s0x%x", (idx == 0) ? "" : ",", palette[idx]);
+    }
+    printf("};\n");
+
+    printf("const uint8_t %s_data[] PROGMEM = {", image.name.c_str());
+    for (size_t idx = 0; idx < data.size(); ++idx) {
+        printf("%s0x%x", (idx == 0) ? "" : ",", data[idx]);
+    }
+    printf("};\n");
+
+    printf("constexpr bitmap_asset_t %s {%u, %u, %s_palette, %s_data, %zu};\n\n",
+           image.name.c_str(), image.width, image.height, image.name.c_str(), image.name.c_str(), data.size());
+}
+
+int main(int argc, char **argv) {
+
+    std::map<std::string, std::vector<uint16_t>> arrays;
+    std::vector<image_t> images;
+
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <input.h> <name>:<width>x<height> [...] > <output.h>\n", argv[0]);
+        return 1;
+    }
+
+    if (!parse_arrays(argv[1], arrays)) {
+        fprintf(stderr, "could not read %s\n", argv[1]);
+        return 1;
+    }
+
+    for (int arg = 2; arg < argc; ++arg) {
+
+        image_t image;
+        std::string spec = argv[arg];
+        size_t colon = spec.find(':');
+
+        if (colon == std::string::npos || sscanf(spec.c_str() + colon + 1, "%ux%u", &image.width, &image.height) != 2) {
+            fprintf(stderr, "invalid bitmap %s (expected <name>:<width>x<height>)\n", spec.c_str());
+            return 1;
+        }
+        image.name = spec.substr(0, colon);
+
+        auto it = arrays.find(image.name);
+        if (it == arrays.end() || it->second.size() != (size_t)image.width * image.height) {
+            fprintf(stderr, "array %s does not exist or does not have %u pixels\n", image.name.c_str(), image.width * image.height);
+            return 1;
+        }
+        image.pixels = it->second;
+
+        images.push_back(image);
+    }
+
+    printf("/**\n");
+    printf(" * @file                    bitmaps.h\n");
+    printf(" * @brief                   Bitmaps used by the app, compressed by `tools/bitmapconv` (generated, do not edit)\n");
+    printf(" *\n");
+    printf(" */\n\n");
+    printf("#ifndef __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_BITMAPS_H__\n");
+    printf("#define __ARDUINO_WIFI_TFT_LCD_CANVAS_APP_BITMAPS_H__\n\n");
+    printf("#include \"bitmapasset.h\"\n\n");
+
+    for (const image_t &image : images) {
+
+        std::vector<uint16_t> palette = build_palette(image.pixels);
+        std::vector<uint8_t> data = encode(image.pixels, palette);
+
+        if (decode(data, palette) != image.pixels) {
+            fprintf(stderr, "%s: encoded stream does not decode to the original pixels\n", image.name.c_str());
+            return 1;
+        }
+
+        fprintf(stderr, "%s: %zu -> %zu bytes\n", image.name.c_str(), 2 * image.pixels.size(), 2 * palette.size() + data.size());
+        write_asset(image, palette, data);
+    }
+
+    printf("#endif\n");
+
+    return 0;
+}